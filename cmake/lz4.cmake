@@ -0,0 +1,56 @@
+# Copyright 2020 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# The CMakeLists.txt for lz4 lives in build/cmake and doesn't export the
+# include directory of its static target, so `_gRPC_LZ4_INCLUDE_DIR` should
+# be set for gRPC to find lz4frame.h.
+
+if(gRPC_LZ4_PROVIDER STREQUAL "module")
+  if(NOT LZ4_ROOT_DIR)
+    set(LZ4_ROOT_DIR ${CMAKE_CURRENT_SOURCE_DIR}/third_party/lz4)
+  endif()
+  if(EXISTS "${LZ4_ROOT_DIR}/build/cmake/CMakeLists.txt")
+    set(LZ4_BUILD_CLI OFF CACHE BOOL "Build lz4 program")
+    set(LZ4_BUILD_LEGACY_LZ4C OFF CACHE BOOL "Build lz4c program")
+    set(BUILD_STATIC_LIBS ON CACHE BOOL "Build static libraries")
+    add_subdirectory(${LZ4_ROOT_DIR}/build/cmake third_party/lz4)
+
+    if(TARGET lz4_static)
+      set(_gRPC_LZ4_LIBRARIES lz4_static)
+      set(_gRPC_LZ4_INCLUDE_DIR "${LZ4_ROOT_DIR}/lib")
+      if(gRPC_INSTALL AND _gRPC_INSTALL_SUPPORTED_FROM_MODULE)
+        install(TARGETS lz4_static EXPORT gRPCTargets
+          RUNTIME DESTINATION ${gRPC_INSTALL_BINDIR}
+          LIBRARY DESTINATION ${gRPC_INSTALL_LIBDIR}
+          ARCHIVE DESTINATION ${gRPC_INSTALL_LIBDIR})
+      endif()
+    endif()
+  else()
+    message(WARNING "gRPC_LZ4_PROVIDER is \"module\" but LZ4_ROOT_DIR is wrong")
+  endif()
+  if(gRPC_INSTALL AND NOT _gRPC_INSTALL_SUPPORTED_FROM_MODULE)
+    message(WARNING "gRPC_INSTALL will be forced to FALSE because gRPC_LZ4_PROVIDER is \"module\"  and CMake version (${CMAKE_VERSION}) is less than 3.13.")
+    set(gRPC_INSTALL FALSE)
+  endif()
+elseif(gRPC_LZ4_PROVIDER STREQUAL "package")
+  # lz4 ships no CMake package config on most distributions, so locate the
+  # header and library directly. Set LZ4_ROOT to search a custom prefix.
+  find_path(LZ4_INCLUDE_DIR lz4frame.h HINTS ${LZ4_ROOT} PATH_SUFFIXES include)
+  find_library(LZ4_LIBRARY NAMES lz4 HINTS ${LZ4_ROOT} PATH_SUFFIXES lib)
+  if(NOT LZ4_INCLUDE_DIR OR NOT LZ4_LIBRARY)
+    message(FATAL_ERROR "gRPC_LZ4_PROVIDER is \"package\" but lz4 was not found")
+  endif()
+  set(_gRPC_LZ4_LIBRARIES ${LZ4_LIBRARY})
+  set(_gRPC_LZ4_INCLUDE_DIR ${LZ4_INCLUDE_DIR})
+endif()
@@ -608,13 +608,17 @@
         'src/core/lib/channel/handshaker.cc',
         'src/core/lib/channel/handshaker_registry.cc',
         'src/core/lib/channel/status_util.cc',
+        'src/core/lib/compression/adaptive_compression.cc',
         'src/core/lib/compression/compression.cc',
         'src/core/lib/compression/compression_args.cc',
         'src/core/lib/compression/compression_internal.cc',
+        'src/core/lib/compression/context_pool.cc',
         'src/core/lib/compression/message_compress.cc',
         'src/core/lib/compression/stream_compression.cc',
         'src/core/lib/compression/stream_compression_gzip.cc',
         'src/core/lib/compression/stream_compression_identity.cc',
+        'src/core/lib/compression/stream_compression_zstd.cc',
+        'src/core/lib/compression/zstd_dictionary.cc',
         'src/core/lib/debug/stats.cc',
         'src/core/lib/debug/stats_data.cc',
         'src/core/lib/debug/trace.cc',
@@ -1092,13 +1096,17 @@
         'src/core/lib/channel/handshaker.cc',
         'src/core/lib/channel/handshaker_registry.cc',
         'src/core/lib/channel/status_util.cc',
+        'src/core/lib/compression/adaptive_compression.cc',
         'src/core/lib/compression/compression.cc',
         'src/core/lib/compression/compression_args.cc',
         'src/core/lib/compression/compression_internal.cc',
+        'src/core/lib/compression/context_pool.cc',
         'src/core/lib/compression/message_compress.cc',
         'src/core/lib/compression/stream_compression.cc',
         'src/core/lib/compression/stream_compression_gzip.cc',
         'src/core/lib/compression/stream_compression_identity.cc',
+        'src/core/lib/compression/stream_compression_zstd.cc',
+        'src/core/lib/compression/zstd_dictionary.cc',
         'src/core/lib/debug/stats.cc',
         'src/core/lib/debug/stats_data.cc',
         'src/core/lib/debug/trace.cc',
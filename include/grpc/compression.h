@@ -24,6 +24,7 @@
 #include <stdlib.h>
 
 #include <grpc/impl/codegen/compression_types.h>
+#include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/slice.h>
 
 #ifdef __cplusplus
@@ -68,6 +69,24 @@ GRPCAPI void grpc_compression_options_disable_algorithm(
 GRPCAPI int grpc_compression_options_is_algorithm_enabled(
     const grpc_compression_options* opts, grpc_compression_algorithm algorithm);
 
+/** A trained zstd dictionary, digested for compression and decompression. */
+typedef struct grpc_zstd_dictionary grpc_zstd_dictionary;
+
+/** Loads the zstd dictionary of \a size bytes at \a data, as produced by
+ * `zstd --train`. Dictionaries are cached process-wide by their ID, so loading
+ * the same dictionary again returns a new reference to the cached one. Returns
+ * NULL if \a data is not a zstd dictionary or has no ID. */
+GRPCAPI grpc_zstd_dictionary* grpc_zstd_dictionary_create(const void* data,
+                                                          size_t size);
+
+GRPCAPI void grpc_zstd_dictionary_ref(grpc_zstd_dictionary* dictionary);
+
+GRPCAPI void grpc_zstd_dictionary_unref(grpc_zstd_dictionary* dictionary);
+
+/** Fetch a vtable for a grpc_channel_arg that points to a grpc_zstd_dictionary.
+ * See GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_PREFIX. */
+GRPCAPI const grpc_arg_pointer_vtable* grpc_zstd_dictionary_arg_vtable(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -276,6 +276,22 @@ GRPCAPI grpc_call_error grpc_call_start_batch(grpc_call* call,
     functionality. Instead, use grpc_auth_context. */
 GRPCAPI char* grpc_call_get_peer(grpc_call* call);
 
+/** EXPERIMENTAL. Compresses \a message, an uncompressed byte buffer, as \a
+    call compresses the messages it sends: with the algorithm, level, zstd
+    dictionary and minimum message size that the call settled on when it sent
+    its initial metadata.
+    Returns 1 and sets \a *compressed to a new byte buffer, which the call
+    sends as it is. Returns 0 if the call does not compress this message, which
+    can then be sent with GRPC_WRITE_NO_COMPRESS so that the call does not try
+    again. Returns -1 if the call has not sent its initial metadata yet, has no
+    compression filter, or \a message is compressed already: the call then
+    decides as it sends the message.
+    Can be called from any thread, concurrently with the call's operations, so
+    that a message is compressed while the ones before it are sent. */
+GRPCAPI int grpc_call_compress_message(grpc_call* call,
+                                       grpc_byte_buffer* message,
+                                       grpc_byte_buffer** compressed);
+
 struct census_context;
 
 /** Set census context for a call; Must be called before first call to
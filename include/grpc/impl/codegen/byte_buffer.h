@@ -38,11 +38,48 @@ GRPCAPI grpc_byte_buffer* grpc_raw_byte_buffer_create(grpc_slice* slices,
  * \a nslices). The \a compression argument defines the compression algorithm
  * used to generate the data in \a slices.
  *
+ * Sending the buffer on a call that compresses messages with \a compression
+ * puts \a slices on the wire as they are, without compressing them again, so
+ * data compressed once can be sent on any number of calls through
+ * grpc_byte_buffer_copy. Other calls decompress it before sending it.
+ *
  * Increases the reference count for all \a slices processed. The user is
  * responsible for invoking grpc_byte_buffer_destroy on the returned instance.*/
 GRPCAPI grpc_byte_buffer* grpc_raw_compressed_byte_buffer_create(
     grpc_slice* slices, size_t nslices, grpc_compression_algorithm compression);
 
+struct grpc_byte_buffer_compressor;
+typedef struct grpc_byte_buffer_compressor grpc_byte_buffer_compressor;
+
+/** EXPERIMENTAL. Returns a compressor building a *compressed* RAW byte buffer
+ * out of data that is written to it a piece at a time, such as while a message
+ * is serialized, so that the data is never held uncompressed in full. Returns
+ * NULL if \a compression is not a message compression algorithm.
+ *
+ * zstd frames are compressed at \a zstd_level (see
+ * GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL), with windows no larger than
+ * 2^zstd_window_log_max bytes when it is positive.
+ *
+ * The buffer must only be sent on calls that compress messages with \a
+ * compression: other calls decompress it again before sending it, and so do
+ * calls whose channel caps zstd windows below the buffer's, or does not
+ * compress messages to local peers. */
+GRPCAPI grpc_byte_buffer_compressor* grpc_byte_buffer_compressor_create(
+    grpc_compression_algorithm compression, int zstd_level,
+    int zstd_window_log_max);
+
+/** EXPERIMENTAL. Compresses the next \a length bytes of data, from \a data,
+ * which can be reused as soon as this returns. Returns 1 upon success, 0
+ * otherwise. */
+GRPCAPI int grpc_byte_buffer_compressor_write(
+    grpc_byte_buffer_compressor* compressor, const void* data, size_t length);
+
+/** EXPERIMENTAL. Destroys \a compressor, returning the compressed byte buffer,
+ * or NULL if compressing the data failed. The user is responsible for invoking
+ * grpc_byte_buffer_destroy on the returned instance. */
+GRPCAPI grpc_byte_buffer* grpc_byte_buffer_compressor_finish(
+    grpc_byte_buffer_compressor* compressor);
+
 /** Copies input byte buffer \a bb.
  *
  * Increases the reference count of all the source slices. The user is
@@ -60,6 +97,10 @@ struct grpc_byte_buffer_reader;
 typedef struct grpc_byte_buffer_reader grpc_byte_buffer_reader;
 
 /** Initialize \a reader to read over \a buffer.
+ * Compressed buffers are decompressed a slice at a time as they are read, so
+ * data that turns out to be corrupt, or to decompress to more than the
+ * channel's GRPC_ARG_MAX_RECEIVE_DECOMPRESSED_MESSAGE_LENGTH, can end the
+ * reading early: see grpc_byte_buffer_reader_failed.
  * Returns 1 upon success, 0 otherwise. */
 GRPCAPI int grpc_byte_buffer_reader_init(grpc_byte_buffer_reader* reader,
                                          grpc_byte_buffer* buffer);
@@ -82,15 +123,29 @@ GRPCAPI int grpc_byte_buffer_reader_next(grpc_byte_buffer_reader* reader,
  * NOTE: Do not use this function unless the caller can guarantee that the
  *       underlying grpc_byte_buffer outlasts the use of the slice. This is only
  *       safe when the underlying grpc_byte_buffer remains immutable while slice
- *       is being accessed. */
+ *       is being accessed. When the buffer is compressed, the slice is only
+ *       valid until the next call on \a reader. */
 GRPCAPI int grpc_byte_buffer_reader_peek(grpc_byte_buffer_reader* reader,
                                          grpc_slice** slice);
 
-/** Merge all data from \a reader into single slice */
+/** Returns 1 if \a reader stopped before the end of the data because the rest
+ * of it could not be decompressed, 0 otherwise. */
+GRPCAPI int grpc_byte_buffer_reader_failed(grpc_byte_buffer_reader* reader);
+
+/** Returns 1 if \a reader failed because the decompressed data is longer than
+ * GRPC_ARG_MAX_RECEIVE_DECOMPRESSED_MESSAGE_LENGTH allows, rather than because
+ * it is corrupt, 0 otherwise. */
+GRPCAPI int grpc_byte_buffer_reader_exceeded_limit(
+    grpc_byte_buffer_reader* reader);
+
+/** Merge all data from \a reader into single slice. Returns an empty slice if
+ * the data could not be decompressed, which grpc_byte_buffer_reader_failed
+ * then reports. */
 GRPCAPI grpc_slice
 grpc_byte_buffer_reader_readall(grpc_byte_buffer_reader* reader);
 
-/** Returns a RAW byte buffer instance from the output of \a reader. */
+/** Returns a RAW byte buffer instance from the output of \a reader, or NULL if
+ * the data could not be decompressed. */
 GRPCAPI grpc_byte_buffer* grpc_raw_byte_buffer_from_reader(
     grpc_byte_buffer_reader* reader);
 
@@ -24,15 +24,21 @@ extern "C" {
 #endif
 
 struct grpc_byte_buffer;
+struct grpc_byte_buffer_reader_decompressor;
 
 struct grpc_byte_buffer_reader {
   struct grpc_byte_buffer* buffer_in;
+  /** The buffer the slices are read from: buffer_in itself when it is not
+   * compressed. Compressed buffers are decompressed as they are read, and
+   * have no buffer_out. */
   struct grpc_byte_buffer* buffer_out;
   /** Different current objects correspond to different types of byte buffers */
   union grpc_byte_buffer_reader_current {
     /** Index into a slice buffer's array of slices */
     unsigned index;
   } current;
+  /** Decompression state of compressed buffers */
+  struct grpc_byte_buffer_reader_decompressor* decompressor;
 };
 
 #ifdef __cplusplus
@@ -30,6 +30,16 @@ extern "C" {
 #define GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY \
   "grpc-internal-encoding-request"
 
+/** To be used as initial metadata key for the request of a concrete zstd
+ * compression level. Its value is the level as a decimal integer; negative
+ * values select zstd's fast levels. Only meaningful when the call compresses
+ * with GRPC_COMPRESS_ZSTD. */
+#define GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY \
+  "grpc-internal-zstd-level-request"
+
+/** zstd level used when neither the channel nor the call specifies one. */
+#define GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL 5
+
 /** To be used in channel arguments.
  *
  * \addtogroup grpc_arg_keys
@@ -41,6 +51,97 @@ extern "C" {
 /** Default compression level for the channel.
  * Its value is an int from the \a grpc_compression_level enum. */
 #define GRPC_COMPRESSION_CHANNEL_DEFAULT_LEVEL "grpc.default_compression_level"
+/** Compression level used for messages compressed with GRPC_COMPRESS_ZSTD on
+ * the channel, unless overridden per call. Its value is an int in zstd's level
+ * range: negative values select the fast levels, 1 to 19 the regular ones.
+ * Out of range values are clamped. Defaults to 5. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL "grpc.zstd_compression_level"
+/** If true, the channel picks the level of each zstd message at run time,
+ * starting from GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL. The level goes up while
+ * the connection is bandwidth-limited and down while compression is the
+ * bottleneck, down to sending messages uncompressed. Calls that set their own
+ * zstd level keep it. Its value is an int used as a boolean. Defaults to
+ * false. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL_AUTO \
+  "grpc.zstd_compression_level_auto"
+/** Maximum number of zstd worker threads compressing a single large message.
+ * The sending thread waits for the workers, so this cuts the latency of huge
+ * messages rather than saving CPU. The output remains a standard zstd frame.
+ * Its value is an int. Defaults to 0, which compresses every message on the
+ * sending thread. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_WORKERS "grpc.zstd_compression_workers"
+/** Messages of at least this many bytes are compressed on the worker threads
+ * allowed by GRPC_COMPRESSION_CHANNEL_ZSTD_WORKERS; smaller ones would fit in
+ * a single zstd job anyway. Its value is an int. Defaults to 16 MB. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_WORKERS_MIN_MESSAGE_SIZE \
+  "grpc.zstd_compression_workers_min_message_size"
+/** Base 2 logarithm of the largest zstd window the channel uses and accepts.
+ * zstd messages are compressed with a window of that size, or of the message
+ * size if smaller, which bounds the memory compressing them takes. Received
+ * zstd messages needing a larger window fail to decompress, like corrupt ones,
+ * rather than making the receiver allocate it. Its value is an int from 10 to
+ * 27. Defaults to 0, which keeps zstd's windows, of up to 128 MB. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_WINDOW_LOG_MAX "grpc.zstd_window_log_max"
+/** Messages of at least this many bytes are compressed, and decompressed on
+ * receipt, on the executor's threads rather than inline. Sending releases the
+ * call combiner while compressing, so the call's other operations proceed,
+ * and receiving hands the application a decompressed message instead of
+ * decompressing it on the thread that reads it. Its value is an int. Defaults
+ * to 0, which disables offloading. */
+#define GRPC_COMPRESSION_CHANNEL_OFFLOAD_MIN_MESSAGE_SIZE \
+  "grpc.compression_offload_min_message_size"
+/** Prefix of the channel args selecting a zstd dictionary per method. The
+ * full arg name is the prefix followed by the method's path (for example
+ * "grpc.zstd_dictionary:/package.Service/Method"), and its value is a pointer
+ * to a grpc_zstd_dictionary (see grpc_zstd_dictionary_arg_vtable()). Calls to
+ * that method advertise the dictionary to the peer, and compress their zstd
+ * messages with it once the peer has advertised it too. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_PREFIX "grpc.zstd_dictionary:"
+/** Directory to write samples of the channel's outgoing messages to, as
+ * training input for zstd dictionaries (see the zstd_dictionary_trainer tool).
+ * Its value is a string. Each sample is the uncompressed message, in a file
+ * named after the call's method. Messages sent with GRPC_WRITE_NO_COMPRESS are
+ * never sampled. Unset by default, which disables sampling. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_SAMPLE_DIR \
+  "grpc.zstd_dictionary_sample_dir"
+/** Minimum interval between two message samples of a channel, in
+ * milliseconds. Its value is an int. Defaults to 1000. */
+#define GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_SAMPLE_INTERVAL_MS \
+  "grpc.zstd_dictionary_sample_interval_ms"
+/** Messages smaller than this many bytes are sent uncompressed, whatever the
+ * call's compression algorithm. Its value is an int. Defaults to 0. */
+#define GRPC_COMPRESSION_CHANNEL_MIN_MESSAGE_SIZE \
+  "grpc.compression_min_message_size"
+/** Prefix of the channel args overriding
+ * GRPC_COMPRESSION_CHANNEL_MIN_MESSAGE_SIZE per method. The full arg name is
+ * the prefix followed by the method's path (for example
+ * "grpc.compression_min_message_size:/package.Service/Method"), and its value
+ * is an int. */
+#define GRPC_COMPRESSION_CHANNEL_MIN_MESSAGE_SIZE_PREFIX \
+  "grpc.compression_min_message_size:"
+/** Before compressing a large message, compress a few small samples of it at
+ * the fastest zstd level, and send the message uncompressed if they shrink by
+ * less than this percentage. Catches payloads that are already compressed
+ * (images, archives) at a fraction of the cost of compressing them. Its value
+ * is an int between 0 and 100. Defaults to 0, which disables the check. */
+#define GRPC_COMPRESSION_CHANNEL_MIN_SAVINGS_PERCENT \
+  "grpc.compression_min_savings_percent"
+/** If true, received messages are handed to the application as they arrived,
+ * still compressed, and calls that did not request a compression algorithm
+ * adopt the algorithm of an already compressed message sent along with their
+ * initial metadata, as long as the peer accepts it. That message, and the
+ * following ones compressed the same way, are then sent without being
+ * decompressed and compressed again. Meant for proxies forwarding messages
+ * between calls. Its value is an int used as a boolean. Defaults to false. */
+#define GRPC_COMPRESSION_CHANNEL_PASSTHROUGH "grpc.compression_passthrough"
+/** If true, calls over a Unix domain socket or a loopback address (as used by
+ * local credentials) do not compress their messages with the channel's
+ * default algorithm, which would only cost CPU. Algorithms requested for a
+ * call or by the method's compressionPolicy in the service config still
+ * apply, and the channel keeps advertising the algorithms it accepts.
+ * In-process channels never compress. Its value is an int used as a boolean.
+ * Defaults to false. */
+#define GRPC_COMPRESSION_CHANNEL_BYPASS_LOCAL "grpc.compression_bypass_local"
 /** Compression algorithms supported by the channel.
  * Its value is a bitset (an int). Bits correspond to algorithms in \a
  * grpc_compression_algorithm. For example, its LSB corresponds to
@@ -62,7 +163,11 @@ typedef enum {
   /* EXPERIMENTAL: Stream compression is currently experimental. */
   GRPC_COMPRESS_STREAM_GZIP,
   GRPC_COMPRESS_STREAM_ZSTD,
-  /* TODO(ctiller): snappy */
+  /* LZ4 frames: far less compression than zstd, at several times its speed.
+   * Meant for fast links where even zstd's fastest levels cost too much CPU.
+   * Only picked by compression levels if the peer does not accept zstd.
+   * Added after the stream algorithms to keep their values and bits. */
+  GRPC_COMPRESS_LZ4,
   GRPC_COMPRESS_ALGORITHMS_COUNT
 } grpc_compression_algorithm;
 
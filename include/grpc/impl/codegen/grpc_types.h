@@ -47,6 +47,15 @@ typedef struct grpc_byte_buffer {
     struct grpc_compressed_buffer {
       grpc_compression_algorithm compression;
       grpc_slice_buffer slice_buffer;
+      /** When positive, reading the buffer fails rather than decompress zstd
+          frames that need a window of more than 2^zstd_window_log_max bytes.
+          Set on received messages from the channel's
+          GRPC_COMPRESSION_CHANNEL_ZSTD_WINDOW_LOG_MAX. */
+      int zstd_window_log_max;
+      /** Reading the buffer fails as soon as it decompresses to more than
+          this many bytes; -1 for no limit. Set on received messages from the
+          channel's GRPC_ARG_MAX_RECEIVE_DECOMPRESSED_MESSAGE_LENGTH. */
+      int max_decompressed_length;
     } raw;
   } data;
 } grpc_byte_buffer;
@@ -157,6 +166,16 @@ typedef struct {
 /** Maximum message length that the channel can send. Int valued, bytes.
     -1 means unlimited. */
 #define GRPC_ARG_MAX_SEND_MESSAGE_LENGTH "grpc.max_send_message_length"
+/** Maximum length that a received message may have once decompressed.
+    GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH only limits the compressed length.
+    Reading a received message fails as soon as it decompresses to more than
+    the limit. Messages decompressed on the executor (see
+    GRPC_COMPRESSION_CHANNEL_OFFLOAD_MIN_MESSAGE_SIZE) fail their call with
+    RESOURCE_EXHAUSTED instead. Int valued, bytes. -1 means unlimited.
+    Defaults to the channel's GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, or to
+    GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH when that is not set. */
+#define GRPC_ARG_MAX_RECEIVE_DECOMPRESSED_MESSAGE_LENGTH \
+  "grpc.max_receive_decompressed_message_length"
 /** Maximum time that a channel may have no outstanding rpcs, after which the
  * server will close the connection. Int valued, milliseconds. INT_MAX means
  * unlimited. */
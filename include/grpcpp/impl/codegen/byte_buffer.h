@@ -42,6 +42,7 @@ template <class ServiceType, class RequestType, class ResponseType>
 class ServerStreamingHandler;
 template <::grpc::StatusCode code>
 class ErrorMethodHandler;
+class WritePipeline;
 
 }  // namespace internal
 }  // namespace grpc_impl
@@ -95,6 +96,21 @@ class ByteBuffer final {
         reinterpret_cast<grpc_slice*>(const_cast<Slice*>(slices)), nslices);
   }
 
+  /// Construct buffer from \a slices, of which there are \a nslices, holding
+  /// a message already compressed with \a compression.
+  ///
+  /// Calls that compress messages with \a compression send the buffer as it
+  /// is, so a message compressed once (see \a Compress) can be sent on many
+  /// calls without compressing it again. Other calls decompress it first.
+  ByteBuffer(const Slice* slices, size_t nslices,
+             grpc_compression_algorithm compression) {
+    // The const_cast is legal for the same reasons as in the constructor
+    // above.
+    buffer_ = g_core_codegen_interface->grpc_raw_compressed_byte_buffer_create(
+        reinterpret_cast<grpc_slice*>(const_cast<Slice*>(slices)), nslices,
+        compression);
+  }
+
   /// Constuct a byte buffer by referencing elements of existing buffer
   /// \a buf. Wrapper of core function grpc_byte_buffer_copy . This is not
   /// a deep copy; it is just a referencing. As a result, its performance is
@@ -124,6 +140,13 @@ class ByteBuffer final {
   /// Dump (read) the buffer contents into \a slices.
   Status Dump(std::vector<Slice>* slices) const;
 
+  /// Compress the buffer contents with \a compression into \a compressed,
+  /// which is sent as it is by calls compressing messages with \a
+  /// compression. The contents of a buffer that was already compressed are
+  /// decompressed first.
+  Status Compress(grpc_compression_algorithm compression,
+                  ByteBuffer* compressed) const;
+
   /// Remove all data.
   void Clear() {
     if (buffer_) {
@@ -162,6 +185,15 @@ class ByteBuffer final {
   /// Is this ByteBuffer valid?
   bool Valid() const { return (buffer_ != nullptr); }
 
+  /// The algorithm the contents are compressed with. Messages received on
+  /// channels in compression pass-through mode (see \a
+  /// GRPC_COMPRESSION_CHANNEL_PASSTHROUGH) are still compressed, so that a
+  /// proxy can forward them as they are.
+  grpc_compression_algorithm compression_algorithm() const {
+    return buffer_ == nullptr ? GRPC_COMPRESS_NONE
+                              : buffer_->data.raw.compression;
+  }
+
  private:
   friend class SerializationTraits<ByteBuffer, void>;
   friend class ServerInterface;
@@ -179,10 +211,12 @@ class ByteBuffer final {
   friend class ::grpc_impl::internal::CallbackServerStreamingHandler;
   template <StatusCode code>
   friend class ::grpc_impl::internal::ErrorMethodHandler;
+  friend class ::grpc_impl::internal::WritePipeline;
   template <class R>
   friend class internal::DeserializeFuncType;
   friend class ProtoBufferReader;
   friend class ProtoBufferWriter;
+  friend class CompressingProtoBufferWriter;
   friend class internal::GrpcByteBufferPeer;
   friend class internal::ExternalConnectionAcceptorImpl;
 
@@ -78,15 +78,29 @@ inline grpc_metadata* FillMetadataArray(
 /// Per-message write options.
 class WriteOptions {
  public:
-  WriteOptions() : flags_(0), last_message_(false) {}
+  WriteOptions()
+      : flags_(0),
+        last_message_(false),
+        compress_while_serializing_(GRPC_COMPRESS_NONE),
+        zstd_level_(GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL),
+        zstd_window_log_max_(0) {}
   WriteOptions(const WriteOptions& other)
-      : flags_(other.flags_), last_message_(other.last_message_) {}
+      : flags_(other.flags_),
+        last_message_(other.last_message_),
+        compress_while_serializing_(other.compress_while_serializing_),
+        zstd_level_(other.zstd_level_),
+        zstd_window_log_max_(other.zstd_window_log_max_) {}
 
   /// Default assignment operator
   WriteOptions& operator=(const WriteOptions& other) = default;
 
   /// Clear all flags.
-  inline void Clear() { flags_ = 0; }
+  inline void Clear() {
+    flags_ = 0;
+    compress_while_serializing_ = GRPC_COMPRESS_NONE;
+    zstd_level_ = GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL;
+    zstd_window_log_max_ = 0;
+  }
 
   /// Returns raw flags bitset.
   inline uint32_t flags() const { return flags_; }
@@ -185,6 +199,53 @@ class WriteOptions {
   /// \sa GRPC_WRITE_LAST_MESSAGE
   bool is_last_message() const { return last_message_; }
 
+  /// EXPERIMENTAL: compress the next message with \a algorithm as it is
+  /// serialized, rather than serializing all of it and having the compression
+  /// filter compress it afterwards, which saves a pass over the message.
+  /// Only messages whose serialization traits support it (such as protobuf
+  /// messages) larger than a few kilobytes are compressed this way.
+  ///
+  /// None of the values below are taken from the call: they should match
+  /// the ones the call compresses messages with, since mismatches cost more
+  /// than not compressing while serializing at all.
+  /// - \a algorithm should be the call's algorithm, as set with
+  ///   ClientContext::set_compression_algorithm or
+  ///   ServerContext::set_compression_algorithm. The compression filter
+  ///   decompresses a message compressed with another algorithm and, if the
+  ///   call compresses, compresses it again with the call's algorithm.
+  /// - zstd messages are compressed at \a zstd_level, which should be the
+  ///   call's level (see set_zstd_compression_level). A message compressed at
+  ///   another level is sent as it is.
+  /// - zstd windows are no larger than 2^zstd_window_log_max bytes when it is
+  ///   positive, which should be at most the channel's cap (see
+  ///   GRPC_COMPRESSION_CHANNEL_ZSTD_WINDOW_LOG_MAX). The compression filter
+  ///   decompresses a message whose windows exceed that cap, and compresses
+  ///   it again within it.
+  inline WriteOptions& set_compress_while_serializing(
+      grpc_compression_algorithm algorithm,
+      int zstd_level = GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL,
+      int zstd_window_log_max = 0) {
+    compress_while_serializing_ = algorithm;
+    zstd_level_ = zstd_level;
+    zstd_window_log_max_ = zstd_window_log_max;
+    return *this;
+  }
+
+  /// Get the algorithm the next message is compressed with as it is
+  /// serialized, GRPC_COMPRESS_NONE if it is not.
+  inline grpc_compression_algorithm get_compress_while_serializing() const {
+    return compress_while_serializing_;
+  }
+
+  /// Get the zstd level messages are compressed at as they are serialized.
+  inline int get_zstd_level_while_serializing() const { return zstd_level_; }
+
+  /// Get the cap on the zstd windows of messages compressed as they are
+  /// serialized, 0 if there is none.
+  inline int get_zstd_window_log_max_while_serializing() const {
+    return zstd_window_log_max_;
+  }
+
  private:
   void SetBit(const uint32_t mask) { flags_ |= mask; }
 
@@ -194,10 +255,34 @@ class WriteOptions {
 
   uint32_t flags_;
   bool last_message_;
+  grpc_compression_algorithm compress_while_serializing_;
+  int zstd_level_;
+  int zstd_window_log_max_;
 };
 
 namespace internal {
 
+// Serializes message with the SerializeCompressed() of its serialization
+// traits, for the traits that have one.
+template <class M, class B>
+auto SerializeCompressed(const M& message,
+                         grpc_compression_algorithm compression, int zstd_level,
+                         int zstd_window_log_max, B bb, bool* own_buf, int)
+    -> decltype(SerializationTraits<M, void>::SerializeCompressed(
+        message, compression, zstd_level, zstd_window_log_max, bb, own_buf)) {
+  return SerializationTraits<M, void>::SerializeCompressed(
+      message, compression, zstd_level, zstd_window_log_max, bb, own_buf);
+}
+
+// Serializes message uncompressed, for the other serialization traits.
+template <class M, class B>
+Status SerializeCompressed(const M& message,
+                           grpc_compression_algorithm /*compression*/,
+                           int /*zstd_level*/, int /*zstd_window_log_max*/,
+                           B bb, bool* own_buf, long) {
+  return SerializationTraits<M, void>::Serialize(message, bb, own_buf);
+}
+
 /// Default argument for CallOpSet. I is unused by the class, but can be
 /// used for generating multiple names for the same thing.
 template <int I>
@@ -308,6 +393,10 @@ class CallOpSendMessage {
   template <class M>
   Status SendMessagePtr(const M* message) GRPC_MUST_USE_RESULT;
 
+  /// Size in bytes of the message serialized by SendMessage, zero if there is
+  /// none or if it is only serialized when the op is started.
+  size_t serialized_message_size() const { return send_buf_.Length(); }
+
  protected:
   void AddOp(grpc_op* ops, size_t* nops) {
     if (msg_ == nullptr && !send_buf_.Valid()) return;
@@ -377,15 +466,27 @@ class CallOpSendMessage {
 template <class M>
 Status CallOpSendMessage::SendMessage(const M& message, WriteOptions options) {
   write_options_ = options;
-  serializer_ = [this](const void* message) {
+  const grpc_compression_algorithm compression =
+      options.get_compress_while_serializing();
+  const int zstd_level = options.get_zstd_level_while_serializing();
+  const int zstd_window_log_max =
+      options.get_zstd_window_log_max_while_serializing();
+  serializer_ = [this, compression, zstd_level,
+                 zstd_window_log_max](const void* message) {
     bool own_buf;
     send_buf_.Clear();
     // TODO(vjpai): Remove the void below when possible
     // The void in the template parameter below should not be needed
     // (since it should be implicit) but is needed due to an observed
     // difference in behavior between clang and gcc for certain internal users
-    Status result = SerializationTraits<M, void>::Serialize(
-        *static_cast<const M*>(message), send_buf_.bbuf_ptr(), &own_buf);
+    Status result =
+        compression == GRPC_COMPRESS_NONE
+            ? SerializationTraits<M, void>::Serialize(
+                  *static_cast<const M*>(message), send_buf_.bbuf_ptr(),
+                  &own_buf)
+            : SerializeCompressed(*static_cast<const M*>(message), compression,
+                                  zstd_level, zstd_window_log_max,
+                                  send_buf_.bbuf_ptr(), &own_buf, 0);
     if (!own_buf) {
       send_buf_.Duplicate();
     }
@@ -342,6 +342,30 @@ class ClientContext {
   /// \param algorithm The compression algorithm used for the client call.
   void set_compression_algorithm(grpc_compression_algorithm algorithm);
 
+  /// Set \a level to be the zstd compression level used for the client call
+  /// when it compresses with GRPC_COMPRESS_ZSTD. Negative levels trade
+  /// compression ratio for speed. This overrides the channel's
+  /// GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL argument.
+  ///
+  /// \param level The zstd compression level used for the client call.
+  void set_zstd_compression_level(int level);
+
+  /// EXPERIMENTAL: Pipeline the writes of a synchronous client-streaming or
+  /// bidi-streaming call. Each \a Write then serializes its message and
+  /// queues it behind the messages still being sent, so that preparing a
+  /// message overlaps with sending the ones before it. Once the initial
+  /// metadata is sent, messages are also compressed ahead, with the
+  /// settings the call compresses with. \a Write only blocks
+  /// while the queued messages add up to more than \a max_queued_bytes, and
+  /// returns false once an earlier write failed.
+  /// Must be set before the call is started.
+  ///
+  /// \param max_queued_bytes The serialized bytes that may wait to be sent.
+  void set_pipelined_writes(size_t max_queued_bytes) {
+    pipelined_writes_ = true;
+    max_pipelined_write_bytes_ = max_queued_bytes;
+  }
+
   /// Flag whether the initial metadata should be \a corked
   ///
   /// If \a corked is true, then the initial metadata will be coalesced with the
@@ -508,6 +532,8 @@ class ClientContext {
 
   grpc_compression_algorithm compression_algorithm_;
   bool initial_metadata_corked_;
+  bool pipelined_writes_;
+  size_t max_pipelined_write_bytes_;
 
   grpc::string debug_error_string_;
 
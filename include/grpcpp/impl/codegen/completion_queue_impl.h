@@ -63,6 +63,7 @@ class ServerContextBase;
 namespace internal {
 template <class W, class R>
 class ServerReaderWriterBody;
+class WritePipeline;
 
 template <class ServiceType, class RequestType, class ResponseType>
 class RpcMethodHandler;
@@ -272,6 +273,7 @@ class CompletionQueue : private ::grpc::GrpcLibraryCodegen {
   friend class ::grpc_impl::ServerWriter;
   template <class W, class R>
   friend class ::grpc_impl::internal::ServerReaderWriterBody;
+  friend class ::grpc_impl::internal::WritePipeline;
   template <class ServiceType, class RequestType, class ResponseType>
   friend class ::grpc_impl::internal::RpcMethodHandler;
   template <class ServiceType, class RequestType, class ResponseType>
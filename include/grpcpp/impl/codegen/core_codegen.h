@@ -74,6 +74,8 @@ class CoreCodegen final : public CoreCodegenInterface {
   void grpc_call_ref(grpc_call* call) override;
   void grpc_call_unref(grpc_call* call) override;
   void* grpc_call_arena_alloc(grpc_call* call, size_t length) override;
+  int grpc_call_compress_message(grpc_call* call, grpc_byte_buffer* message,
+                                 grpc_byte_buffer** compressed) override;
   const char* grpc_call_error_to_string(grpc_call_error error) override;
 
   grpc_byte_buffer* grpc_byte_buffer_copy(grpc_byte_buffer* bb) override;
@@ -88,9 +90,23 @@ class CoreCodegen final : public CoreCodegenInterface {
                                    grpc_slice* slice) override;
   int grpc_byte_buffer_reader_peek(grpc_byte_buffer_reader* reader,
                                    grpc_slice** slice) override;
+  int grpc_byte_buffer_reader_failed(grpc_byte_buffer_reader* reader) override;
+  int grpc_byte_buffer_reader_exceeded_limit(
+      grpc_byte_buffer_reader* reader) override;
 
   grpc_byte_buffer* grpc_raw_byte_buffer_create(grpc_slice* slice,
                                                 size_t nslices) override;
+  grpc_byte_buffer* grpc_raw_compressed_byte_buffer_create(
+      grpc_slice* slice, size_t nslices,
+      grpc_compression_algorithm compression) override;
+  grpc_byte_buffer_compressor* grpc_byte_buffer_compressor_create(
+      grpc_compression_algorithm compression, int zstd_level,
+      int zstd_window_log_max) override;
+  int grpc_byte_buffer_compressor_write(grpc_byte_buffer_compressor* compressor,
+                                        const void* data,
+                                        size_t length) override;
+  grpc_byte_buffer* grpc_byte_buffer_compressor_finish(
+      grpc_byte_buffer_compressor* compressor) override;
   grpc_slice grpc_slice_new_with_user_data(void* p, size_t len,
                                            void (*destroy)(void*),
                                            void* user_data) override;
@@ -95,9 +95,24 @@ class CoreCodegenInterface {
                                            grpc_slice* slice) = 0;
   virtual int grpc_byte_buffer_reader_peek(grpc_byte_buffer_reader* reader,
                                            grpc_slice** slice) = 0;
+  virtual int grpc_byte_buffer_reader_failed(
+      grpc_byte_buffer_reader* reader) = 0;
+  virtual int grpc_byte_buffer_reader_exceeded_limit(
+      grpc_byte_buffer_reader* reader) = 0;
 
   virtual grpc_byte_buffer* grpc_raw_byte_buffer_create(grpc_slice* slice,
                                                         size_t nslices) = 0;
+  virtual grpc_byte_buffer* grpc_raw_compressed_byte_buffer_create(
+      grpc_slice* slice, size_t nslices,
+      grpc_compression_algorithm compression) = 0;
+  virtual grpc_byte_buffer_compressor* grpc_byte_buffer_compressor_create(
+      grpc_compression_algorithm compression, int zstd_level,
+      int zstd_window_log_max) = 0;
+  virtual int grpc_byte_buffer_compressor_write(
+      grpc_byte_buffer_compressor* compressor, const void* data,
+      size_t length) = 0;
+  virtual grpc_byte_buffer* grpc_byte_buffer_compressor_finish(
+      grpc_byte_buffer_compressor* compressor) = 0;
   virtual grpc_slice grpc_slice_new_with_user_data(void* p, size_t len,
                                                    void (*destroy)(void*),
                                                    void* user_data) = 0;
@@ -114,6 +129,9 @@ class CoreCodegenInterface {
   virtual void grpc_call_ref(grpc_call* call) = 0;
   virtual void grpc_call_unref(grpc_call* call) = 0;
   virtual void* grpc_call_arena_alloc(grpc_call* call, size_t length) = 0;
+  virtual int grpc_call_compress_message(grpc_call* call,
+                                         grpc_byte_buffer* message,
+                                         grpc_byte_buffer** compressed) = 0;
   virtual const char* grpc_call_error_to_string(grpc_call_error error) = 0;
   virtual grpc_slice grpc_empty_slice() = 0;
   virtual grpc_slice grpc_slice_malloc(size_t length) = 0;
@@ -196,6 +196,13 @@ class ServerStreamingHandler : public ::grpc::internal::MethodHandler {
       static_cast<RequestType*>(param.request)->~RequestType();
     }
 
+    if (param.server_context->write_pipeline_ != nullptr &&
+        !param.server_context->write_pipeline_->Flush() && status.ok()) {
+      // The messages still queued by pipelined writes are sent before the
+      // status, which must not report success if one of them was not.
+      status = ::grpc::Status(::grpc::StatusCode::INTERNAL,
+                              "Failed to send pipelined response messages");
+    }
     ::grpc::internal::CallOpSet<::grpc::internal::CallOpSendInitialMetadata,
                                 ::grpc::internal::CallOpServerSendStatus>
         ops;
@@ -263,6 +270,13 @@ class TemplatedBidiStreamingHandler : public ::grpc::internal::MethodHandler {
           &stream);
     });
 
+    if (param.server_context->write_pipeline_ != nullptr &&
+        !param.server_context->write_pipeline_->Flush() && status.ok()) {
+      // The messages still queued by pipelined writes are sent before the
+      // status, which must not report success if one of them was not.
+      status = ::grpc::Status(::grpc::StatusCode::INTERNAL,
+                              "Failed to send pipelined response messages");
+    }
     ::grpc::internal::CallOpSet<::grpc::internal::CallOpSendInitialMetadata,
                                 ::grpc::internal::CallOpServerSendStatus>
         ops;
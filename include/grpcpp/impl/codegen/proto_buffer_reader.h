@@ -83,6 +83,20 @@ class ProtoBufferReader : public ::grpc::protobuf::io::ZeroCopyInputStream {
     /// Otherwise get the next slice from the byte buffer reader
     if (!g_core_codegen_interface->grpc_byte_buffer_reader_peek(&reader_,
                                                                 &slice_)) {
+      /// Compressed buffers are decompressed as they are read, so corrupt
+      /// data, or data that decompresses to more than the channel allows, is
+      /// only found here
+      if (g_core_codegen_interface->grpc_byte_buffer_reader_failed(&reader_)) {
+        const bool exceeded_limit =
+            g_core_codegen_interface->grpc_byte_buffer_reader_exceeded_limit(
+                &reader_);
+        g_core_codegen_interface->grpc_byte_buffer_reader_destroy(&reader_);
+        status_ = exceeded_limit
+                      ? Status(StatusCode::RESOURCE_EXHAUSTED,
+                               "Decompressed message exceeds the limit")
+                      : Status(StatusCode::INTERNAL,
+                               "Couldn't decompress message");
+      }
       return false;
     }
     *data = GRPC_SLICE_START_PTR(*slice_);
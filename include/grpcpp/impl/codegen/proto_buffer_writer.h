@@ -42,6 +42,7 @@ class ProtoBufferWriterPeer;
 }  // namespace internal
 
 const int kProtoBufferWriterMaxBufferLength = 1024 * 1024;
+const int kProtoBufferWriterCompressionBlockLength = 16 * 1024;
 
 /// This is a specialization of the protobuf class ZeroCopyOutputStream.
 /// The principle is to give the proto layer one buffer of bytes at a time
@@ -162,6 +163,111 @@ class ProtoBufferWriter : public ::grpc::protobuf::io::ZeroCopyOutputStream {
   grpc_slice slice_;         ///< current slice passed back to the caller
 };
 
+/// A ZeroCopyOutputStream that compresses the message as it is serialized.
+/// The proto layer serializes into one small block at a time, which is
+/// compressed while it is still in the CPU caches and then reused for the
+/// next portion of the message, so the message is never held uncompressed in
+/// full. Finish() stores the compressed message in the grpc::ByteBuffer.
+class CompressingProtoBufferWriter
+    : public ::grpc::protobuf::io::ZeroCopyOutputStream {
+ public:
+  /// Constructor for this derived class
+  ///
+  /// \param[out] byte_buffer A pointer to the grpc::ByteBuffer set by Finish()
+  /// \param block_size How big is the block the message is serialized into
+  /// \param compression The message compression algorithm to compress with
+  /// \param zstd_level The level of zstd compression
+  /// \param zstd_window_log_max If positive, caps zstd windows at
+  ///        2^zstd_window_log_max bytes
+  CompressingProtoBufferWriter(
+      ByteBuffer* byte_buffer, int block_size,
+      grpc_compression_algorithm compression,
+      int zstd_level = GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL,
+      int zstd_window_log_max = 0)
+      : byte_buffer_(byte_buffer),
+        block_size_(block_size),
+        block_(nullptr),
+        block_used_(0),
+        byte_count_(0),
+        failed_(false) {
+    GPR_CODEGEN_ASSERT(!byte_buffer->Valid());
+    compressor_ = g_core_codegen_interface->grpc_byte_buffer_compressor_create(
+        compression, zstd_level, zstd_window_log_max);
+    if (compressor_ != nullptr) {
+      block_ = static_cast<uint8_t*>(
+          g_core_codegen_interface->gpr_malloc(block_size_));
+    }
+  }
+
+  ~CompressingProtoBufferWriter() {
+    if (compressor_ != nullptr) {
+      g_core_codegen_interface->grpc_byte_buffer_destroy(
+          g_core_codegen_interface->grpc_byte_buffer_compressor_finish(
+              compressor_));
+    }
+    g_core_codegen_interface->gpr_free(block_);
+  }
+
+  /// Returns false if \a compression does not compress messages, in which
+  /// case nothing can be written.
+  bool Valid() const { return compressor_ != nullptr; }
+
+  /// Compresses what was written to the block so far, and gives the whole
+  /// block to the proto library again.
+  bool Next(void** data, int* size) override {
+    if (!CompressBlock()) return false;
+    *data = block_;
+    *size = block_size_;
+    block_used_ = block_size_;
+    byte_count_ += block_size_;
+    return true;
+  }
+
+  /// Backup by \a count bytes because Next returned more bytes than needed.
+  void BackUp(int count) override {
+    GPR_CODEGEN_ASSERT(count <= block_used_);
+    block_used_ -= count;
+    byte_count_ -= count;
+  }
+
+  /// Returns the total number of bytes written since this object was created.
+  int64_t ByteCount() const override { return byte_count_; }
+
+  /// Compresses the rest of the message and stores it in the byte buffer.
+  /// Returns false if compressing the message failed.
+  bool Finish() {
+    if (compressor_ == nullptr || !CompressBlock()) return false;
+    grpc_byte_buffer* bp =
+        g_core_codegen_interface->grpc_byte_buffer_compressor_finish(
+            compressor_);
+    compressor_ = nullptr;
+    if (bp == nullptr) return false;
+    byte_buffer_->set_buffer(bp);
+    return true;
+  }
+
+ private:
+  bool CompressBlock() {
+    if (compressor_ == nullptr || failed_) return false;
+    if (block_used_ > 0 &&
+        !g_core_codegen_interface->grpc_byte_buffer_compressor_write(
+            compressor_, block_, block_used_)) {
+      failed_ = true;
+      return false;
+    }
+    block_used_ = 0;
+    return true;
+  }
+
+  ByteBuffer* byte_buffer_;  ///< set to the compressed message by Finish()
+  const int block_size_;     ///< size of block_
+  grpc_byte_buffer_compressor* compressor_;
+  uint8_t* block_;  ///< the memory given to the proto library to write into
+  int block_used_;  ///< bytes of block_ written and not compressed yet
+  int64_t byte_count_;  ///< bytes written since this object was created
+  bool failed_;         ///< whether compressing a block failed
+};
+
 }  // namespace grpc
 
 #endif  // GRPCPP_IMPL_CODEGEN_PROTO_BUFFER_WRITER_H
@@ -66,6 +66,36 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
              : Status(StatusCode::INTERNAL, "Failed to serialize message");
 }
 
+// As GenericSerialize, compressing the message with compression as it is
+// serialized (zstd at zstd_level, with windows capped at
+// 2^zstd_window_log_max bytes when it is positive). Messages that fit in one
+// compression block, and algorithms that do not compress messages, are
+// serialized uncompressed: the compression filter then decides whether to
+// compress them.
+template <class ProtoBufferWriter, class T>
+Status GenericSerializeCompressed(const grpc::protobuf::MessageLite& msg,
+                                  grpc_compression_algorithm compression,
+                                  int zstd_level, int zstd_window_log_max,
+                                  ByteBuffer* bb, bool* own_buffer) {
+  if (msg.ByteSizeLong() <=
+      static_cast<size_t>(kProtoBufferWriterCompressionBlockLength)) {
+    return GenericSerialize<ProtoBufferWriter, T>(msg, bb, own_buffer);
+  }
+  *own_buffer = true;
+  CompressingProtoBufferWriter writer(
+      bb, kProtoBufferWriterCompressionBlockLength, compression, zstd_level,
+      zstd_window_log_max);
+  if (!writer.Valid()) {
+    return GenericSerialize<ProtoBufferWriter, T>(msg, bb, own_buffer);
+  }
+  if (!msg.SerializeToZeroCopyStream(&writer)) {
+    return Status(StatusCode::INTERNAL, "Failed to serialize message");
+  }
+  return writer.Finish()
+             ? g_core_codegen_interface->ok()
+             : Status(StatusCode::INTERNAL, "Failed to compress message");
+}
+
 // BufferReader must be a subclass of ::protobuf::io::ZeroCopyInputStream.
 template <class ProtoBufferReader, class T>
 Status GenericDeserialize(ByteBuffer* buffer,
@@ -86,6 +116,9 @@ Status GenericDeserialize(ByteBuffer* buffer,
     if (!msg->ParseFromZeroCopyStream(&reader)) {
       result = Status(StatusCode::INTERNAL, msg->InitializationErrorString());
     }
+    if (!reader.status().ok()) {
+      result = reader.status();
+    }
   }
   buffer->Clear();
   return result;
@@ -107,6 +140,14 @@ class SerializationTraits<
     return GenericSerialize<ProtoBufferWriter, T>(msg, bb, own_buffer);
   }
 
+  static Status SerializeCompressed(const grpc::protobuf::MessageLite& msg,
+                                    grpc_compression_algorithm compression,
+                                    int zstd_level, int zstd_window_log_max,
+                                    ByteBuffer* bb, bool* own_buffer) {
+    return GenericSerializeCompressed<ProtoBufferWriter, T>(
+        msg, compression, zstd_level, zstd_window_log_max, bb, own_buffer);
+  }
+
   static Status Deserialize(ByteBuffer* buffer,
                             grpc::protobuf::MessageLite* msg) {
     return GenericDeserialize<ProtoBufferReader, T>(buffer, msg);
@@ -91,6 +91,7 @@ template <class Streamer, bool WriteNeeded>
 class TemplatedBidiStreamingHandler;
 template <::grpc::StatusCode code>
 class ErrorMethodHandler;
+class WritePipeline;
 }  // namespace internal
 
 }  // namespace grpc_impl
@@ -241,6 +242,15 @@ class ServerContextBase {
   /// \param algorithm The compression algorithm used for the server call.
   void set_compression_algorithm(grpc_compression_algorithm algorithm);
 
+  /// Set \a level to be the zstd compression level used for the server call
+  /// when it compresses with GRPC_COMPRESS_ZSTD. Negative levels trade
+  /// compression ratio for speed. This overrides both the channel's
+  /// GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL argument and the zstd level implied
+  /// by \a set_compression_level.
+  ///
+  /// \param level The zstd compression level used for the server call.
+  void set_zstd_compression_level(int level);
+
   /// Set the serialized load reporting costs in \a cost_data for the call.
   void SetLoadReportingCosts(const std::vector<grpc::string>& cost_data);
 
@@ -278,6 +288,22 @@ class ServerContextBase {
     async_notify_when_done_tag_ = tag;
   }
 
+  /// EXPERIMENTAL: Pipeline the writes of a synchronous server-streaming or
+  /// bidi-streaming call. Each \a Write then serializes its message and
+  /// queues it behind the messages still being sent, so that preparing a
+  /// message overlaps with sending the ones before it. Once the initial
+  /// metadata is sent, messages are also compressed ahead, with the
+  /// settings the call compresses with. \a Write only blocks
+  /// while the queued messages add up to more than \a max_queued_bytes, and
+  /// returns false once an earlier write failed.
+  /// Queued messages are sent before the status.
+  ///
+  /// \param max_queued_bytes The serialized bytes that may wait to be sent.
+  void set_pipelined_writes(size_t max_queued_bytes) {
+    pipelined_writes_ = true;
+    max_pipelined_write_bytes_ = max_queued_bytes;
+  }
+
   /// NOTE: This is an API for advanced users who need custom allocators.
   /// Get and maybe mutate the allocator state associated with the current RPC.
   /// Currently only applicable for callback unary RPC methods.
@@ -432,6 +458,10 @@ class ServerContextBase {
       pending_ops_;
   bool has_pending_ops_;
 
+  bool pipelined_writes_;
+  size_t max_pipelined_write_bytes_;
+  std::unique_ptr<::grpc_impl::internal::WritePipeline> write_pipeline_;
+
   ::grpc::experimental::ServerRpcInfo* rpc_info_;
   ::grpc::experimental::RpcAllocatorState* message_allocator_state_ = nullptr;
 
@@ -526,12 +556,16 @@ class ServerContext : public ServerContextBase {
   using ServerContextBase::raw_deadline;
   using ServerContextBase::set_compression_algorithm;
   using ServerContextBase::set_compression_level;
+  using ServerContextBase::set_zstd_compression_level;
   using ServerContextBase::SetLoadReportingCosts;
   using ServerContextBase::TryCancel;
 
   // Sync/CQ-based Async ServerContext only
   using ServerContextBase::AsyncNotifyWhenDone;
 
+  // Sync ServerContext only
+  using ServerContextBase::set_pipelined_writes;
+
  private:
   // Constructor for internal use by server only
   friend class ::grpc_impl::Server;
@@ -568,6 +602,7 @@ class CallbackServerContext : public ServerContextBase {
   using ServerContextBase::raw_deadline;
   using ServerContextBase::set_compression_algorithm;
   using ServerContextBase::set_compression_level;
+  using ServerContextBase::set_zstd_compression_level;
   using ServerContextBase::SetLoadReportingCosts;
   using ServerContextBase::TryCancel;
 
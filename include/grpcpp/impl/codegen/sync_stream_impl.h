@@ -18,6 +18,9 @@
 #ifndef GRPCPP_IMPL_CODEGEN_SYNC_STREAM_IMPL_H
 #define GRPCPP_IMPL_CODEGEN_SYNC_STREAM_IMPL_H
 
+#include <deque>
+#include <memory>
+
 #include <grpcpp/impl/codegen/call.h>
 #include <grpcpp/impl/codegen/channel_interface.h>
 #include <grpcpp/impl/codegen/client_context_impl.h>
@@ -141,6 +144,146 @@ class WriterInterface {
   }
 };
 
+/// Sends the messages of a synchronous stream that pipelines its writes (see
+/// ClientContext::set_pipelined_writes and
+/// ServerContext::set_pipelined_writes). Messages are serialized and
+/// compressed as soon as they are written, and queued until the message
+/// before them has been sent, since a call may only send one message at a
+/// time.
+class WritePipeline {
+ public:
+  typedef ::grpc::internal::CallOpSet<
+      ::grpc::internal::CallOpSendInitialMetadata,
+      ::grpc::internal::CallOpSendMessage>
+      WriteOps;
+
+  WritePipeline(::grpc::internal::Call* call, size_t max_queued_bytes)
+      : call_(call), max_queued_bytes_(max_queued_bytes) {}
+
+  ~WritePipeline() {
+    // Queued messages are dropped, but core owns the ops being sent until
+    // they complete.
+    if (in_flight_ != nullptr) {
+      call_->cq()->Pluck(in_flight_.get());
+    }
+  }
+
+  /// Serialize \a msg with \a options and, once the call has sent its
+  /// initial metadata, compress it as the call compresses its messages (see
+  /// grpc_call_compress_message), so that it is compressed while the messages
+  /// before it are sent. Returns nullptr if \a msg could not be serialized or
+  /// an earlier write failed.
+  template <class W>
+  std::unique_ptr<WriteOps> Serialize(const W& msg,
+                                      ::grpc::WriteOptions options) {
+    if (failed_) return nullptr;
+    std::unique_ptr<WriteOps> ops(new WriteOps);
+    // Messages that must not be compressed, or that were compressed as they
+    // were serialized, are left to the compression filter.
+    if (options.get_no_compression() ||
+        options.get_compress_while_serializing() != GRPC_COMPRESS_NONE) {
+      if (!ops->SendMessage(msg, options).ok()) return nullptr;
+      return ops;
+    }
+    ::grpc::ByteBuffer buffer;
+    bool own_buffer;
+    if (!::grpc::SerializationTraits<W, void>::Serialize(
+             msg, buffer.bbuf_ptr(), &own_buffer)
+             .ok()) {
+      return nullptr;
+    }
+    if (!own_buffer) {
+      buffer.Duplicate();
+    }
+    grpc_byte_buffer* compressed = nullptr;
+    switch (::grpc::g_core_codegen_interface->grpc_call_compress_message(
+        call_->call(), buffer.c_buffer(), &compressed)) {
+      case 1:
+        buffer.set_buffer(compressed);
+        break;
+      case 0:
+        // Spare the filter from trying again.
+        options.set_no_compression();
+        break;
+      default:
+        break;
+    }
+    if (!ops->SendMessage(buffer, options).ok()) return nullptr;
+    return ops;
+  }
+
+  /// Queue \a ops, as returned by \a Serialize, behind the messages being
+  /// sent. Blocks only while more than the budget of serialized bytes is
+  /// queued. Returns false if an earlier write failed.
+  bool Write(std::unique_ptr<WriteOps> ops) {
+    queued_bytes_ += ops->serialized_message_size();
+    queue_.push_back(std::move(ops));
+    Advance(false);
+    while (!failed_ && queued_bytes_ > max_queued_bytes_) {
+      Advance(true);
+    }
+    return !failed_;
+  }
+
+  /// Block until every queued message has been sent. Returns false if a write
+  /// failed.
+  bool Flush() {
+    while (in_flight_ != nullptr || !queue_.empty()) {
+      Advance(true);
+    }
+    return !failed_;
+  }
+
+ private:
+  // Complete the message being sent, waiting for it if \a block, and start
+  // the next one once it is done.
+  void Advance(bool block) {
+    if (in_flight_ != nullptr) {
+      if (block) {
+        Complete(call_->cq()->Pluck(in_flight_.get()));
+      } else {
+        TryComplete();
+      }
+    }
+    if (in_flight_ == nullptr && !queue_.empty()) {
+      in_flight_ = std::move(queue_.front());
+      queue_.pop_front();
+      queued_bytes_ -= in_flight_->serialized_message_size();
+      call_->PerformOps(in_flight_.get());
+    }
+  }
+
+  void TryComplete() {
+    auto ev = ::grpc::g_core_codegen_interface->grpc_completion_queue_pluck(
+        call_->cq()->cq(), in_flight_.get(),
+        ::grpc::g_core_codegen_interface->gpr_time_0(GPR_CLOCK_REALTIME),
+        nullptr);
+    if (ev.type != GRPC_OP_COMPLETE) return;
+    bool ok = ev.success != 0;
+    void* tag = in_flight_.get();
+    // Interceptors may still be running, in which case the ops complete again.
+    if (in_flight_->FinalizeResult(&tag, &ok)) {
+      Complete(ok);
+    }
+  }
+
+  void Complete(bool ok) {
+    in_flight_.reset();
+    if (!ok) {
+      failed_ = true;
+      queue_.clear();
+      queued_bytes_ = 0;
+    }
+  }
+
+  ::grpc::internal::Call* const call_;
+  const size_t max_queued_bytes_;
+  std::unique_ptr<WriteOps> in_flight_;
+  std::deque<std::unique_ptr<WriteOps>> queue_;
+  size_t queued_bytes_ = 0;
+  bool failed_ = false;
+};
+
 }  // namespace internal
 
 /// Client-side interface for streaming reads of message of type \a R.
@@ -319,6 +462,14 @@ class ClientWriter : public ClientWriterInterface<W> {
   ///   \a ClientContext associated with this call).
   using internal::WriterInterface<W>::Write;
   bool Write(const W& msg, ::grpc::WriteOptions options) override {
+    if (pipeline_ != nullptr) {
+      if (!options.is_last_message()) {
+        return PipelinedWrite(msg, options);
+      }
+      if (!pipeline_->Flush()) {
+        return false;
+      }
+    }
     ::grpc::internal::CallOpSet<::grpc::internal::CallOpSendInitialMetadata,
                                 ::grpc::internal::CallOpSendMessage,
                                 ::grpc::internal::CallOpClientSendClose>
@@ -342,10 +493,11 @@ class ClientWriter : public ClientWriterInterface<W> {
   }
 
   bool WritesDone() override {
+    bool flushed = pipeline_ == nullptr || pipeline_->Flush();
     ::grpc::internal::CallOpSet<::grpc::internal::CallOpClientSendClose> ops;
     ops.ClientSendClose();
     call_.PerformOps(&ops);
-    return cq_.Pluck(&ops);
+    return cq_.Pluck(&ops) && flushed;
   }
 
   /// See the ClientStreamingInterface.Finish method for semantics.
@@ -385,6 +537,11 @@ class ClientWriter : public ClientWriterInterface<W> {
     finish_ops_.RecvMessage(response);
     finish_ops_.AllowNoMessage();
 
+    if (context_->pipelined_writes_) {
+      pipeline_.reset(new internal::WritePipeline(
+          &call_, context_->max_pipelined_write_bytes_));
+    }
+
     if (!context_->initial_metadata_corked_) {
       ::grpc::internal::CallOpSet<::grpc::internal::CallOpSendInitialMetadata>
           ops;
@@ -402,6 +559,21 @@ class ClientWriter : public ClientWriterInterface<W> {
       finish_ops_;
   ::grpc_impl::CompletionQueue cq_;
   ::grpc::internal::Call call_;
+  // Declared last, so that it is destroyed before the call and its queue.
+  std::unique_ptr<internal::WritePipeline> pipeline_;
+
+  bool PipelinedWrite(const W& msg, ::grpc::WriteOptions options) {
+    auto ops = pipeline_->Serialize(msg, options);
+    if (ops == nullptr) {
+      return false;
+    }
+    if (context_->initial_metadata_corked_) {
+      ops->SendInitialMetadata(&context_->send_initial_metadata_,
+                               context_->initial_metadata_flags());
+      context_->set_initial_metadata_corked(false);
+    }
+    return pipeline_->Write(std::move(ops));
+  }
 };
 
 /// Client-side interface for bi-directional streaming with
@@ -492,6 +664,14 @@ class ClientReaderWriter final : public ClientReaderWriterInterface<W, R> {
   ///   \a ClientContext associated with this call to fill in values).
   using internal::WriterInterface<W>::Write;
   bool Write(const W& msg, ::grpc::WriteOptions options) override {
+    if (pipeline_ != nullptr) {
+      if (!options.is_last_message()) {
+        return PipelinedWrite(msg, options);
+      }
+      if (!pipeline_->Flush()) {
+        return false;
+      }
+    }
     ::grpc::internal::CallOpSet<::grpc::internal::CallOpSendInitialMetadata,
                                 ::grpc::internal::CallOpSendMessage,
                                 ::grpc::internal::CallOpClientSendClose>
@@ -515,10 +695,11 @@ class ClientReaderWriter final : public ClientReaderWriterInterface<W, R> {
   }
 
   bool WritesDone() override {
+    bool flushed = pipeline_ == nullptr || pipeline_->Flush();
     ::grpc::internal::CallOpSet<::grpc::internal::CallOpClientSendClose> ops;
     ops.ClientSendClose();
     call_.PerformOps(&ops);
-    return cq_.Pluck(&ops);
+    return cq_.Pluck(&ops) && flushed;
   }
 
   /// See the ClientStreamingInterface.Finish method for semantics.
@@ -546,6 +727,21 @@ class ClientReaderWriter final : public ClientReaderWriterInterface<W, R> {
   ::grpc_impl::ClientContext* context_;
   ::grpc_impl::CompletionQueue cq_;
   ::grpc::internal::Call call_;
+  // Declared last, so that it is destroyed before the call and its queue.
+  std::unique_ptr<internal::WritePipeline> pipeline_;
+
+  bool PipelinedWrite(const W& msg, ::grpc::WriteOptions options) {
+    auto ops = pipeline_->Serialize(msg, options);
+    if (ops == nullptr) {
+      return false;
+    }
+    if (context_->initial_metadata_corked_) {
+      ops->SendInitialMetadata(&context_->send_initial_metadata_,
+                               context_->initial_metadata_flags());
+      context_->set_initial_metadata_corked(false);
+    }
+    return pipeline_->Write(std::move(ops));
+  }
 
   /// Block to create a stream and write the initial metadata and \a request
   /// out. Note that \a context will be used to fill in custom initial metadata
@@ -558,6 +754,11 @@ class ClientReaderWriter final : public ClientReaderWriterInterface<W, R> {
             GRPC_CQ_CURRENT_VERSION, GRPC_CQ_PLUCK, GRPC_CQ_DEFAULT_POLLING,
             nullptr}),  // Pluckable cq
         call_(channel->CreateCall(method, context, &cq_)) {
+    if (context_->pipelined_writes_) {
+      pipeline_.reset(new internal::WritePipeline(
+          &call_, context_->max_pipelined_write_bytes_));
+    }
+
     if (!context_->initial_metadata_corked_) {
       ::grpc::internal::CallOpSet<::grpc::internal::CallOpSendInitialMetadata>
           ops;
@@ -659,6 +860,12 @@ class ServerWriter final : public ServerWriterInterface<W> {
   ///   \a ClientContext associated with this call to fill in values).
   using internal::WriterInterface<W>::Write;
   bool Write(const W& msg, ::grpc::WriteOptions options) override {
+    if (ctx_->pipelined_writes_ && !options.is_last_message()) {
+      return PipelinedWrite(msg, options);
+    }
+    if (ctx_->write_pipeline_ != nullptr && !ctx_->write_pipeline_->Flush()) {
+      return false;
+    }
     if (options.is_last_message()) {
       options.set_buffer_hint();
     }
@@ -693,6 +900,26 @@ class ServerWriter final : public ServerWriterInterface<W> {
   template <class ServiceType, class RequestType, class ResponseType>
   friend class ::grpc_impl::internal::ServerStreamingHandler;
 
+  bool PipelinedWrite(const W& msg, ::grpc::WriteOptions options) {
+    if (ctx_->write_pipeline_ == nullptr) {
+      ctx_->write_pipeline_.reset(
+          new internal::WritePipeline(call_, ctx_->max_pipelined_write_bytes_));
+    }
+    auto ops = ctx_->write_pipeline_->Serialize(msg, options);
+    if (ops == nullptr) {
+      return false;
+    }
+    if (!ctx_->sent_initial_metadata_) {
+      ops->SendInitialMetadata(&ctx_->initial_metadata_,
+                               ctx_->initial_metadata_flags());
+      if (ctx_->compression_level_set()) {
+        ops->set_compression_level(ctx_->compression_level());
+      }
+      ctx_->sent_initial_metadata_ = true;
+    }
+    return ctx_->write_pipeline_->Write(std::move(ops));
+  }
+
   ServerWriter(::grpc::internal::Call* call, ::grpc_impl::ServerContext* ctx)
       : call_(call), ctx_(ctx) {}
 };
@@ -740,6 +967,12 @@ class ServerReaderWriterBody final {
   }
 
   bool Write(const W& msg, ::grpc::WriteOptions options) {
+    if (ctx_->pipelined_writes_ && !options.is_last_message()) {
+      return PipelinedWrite(msg, options);
+    }
+    if (ctx_->write_pipeline_ != nullptr && !ctx_->write_pipeline_->Flush()) {
+      return false;
+    }
     if (options.is_last_message()) {
       options.set_buffer_hint();
     }
@@ -769,6 +1002,26 @@ class ServerReaderWriterBody final {
  private:
   grpc::internal::Call* const call_;
   ::grpc_impl::ServerContext* const ctx_;
+
+  bool PipelinedWrite(const W& msg, ::grpc::WriteOptions options) {
+    if (ctx_->write_pipeline_ == nullptr) {
+      ctx_->write_pipeline_.reset(
+          new WritePipeline(call_, ctx_->max_pipelined_write_bytes_));
+    }
+    auto ops = ctx_->write_pipeline_->Serialize(msg, options);
+    if (ops == nullptr) {
+      return false;
+    }
+    if (!ctx_->sent_initial_metadata_) {
+      ops->SendInitialMetadata(&ctx_->initial_metadata_,
+                               ctx_->initial_metadata_flags());
+      if (ctx_->compression_level_set()) {
+        ops->set_compression_level(ctx_->compression_level());
+      }
+      ctx_->sent_initial_metadata_ = true;
+    }
+    return ctx_->write_pipeline_->Write(std::move(ops));
+  }
 };
 
 }  // namespace internal
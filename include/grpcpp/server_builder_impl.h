@@ -225,6 +225,11 @@ class ServerBuilder {
   ServerBuilder& SetDefaultCompressionAlgorithm(
       grpc_compression_algorithm algorithm);
 
+  /// Set the zstd dictionary for calls to \a method. See
+  /// \a grpc::ChannelArguments::SetZstdDictionary.
+  ServerBuilder& SetZstdDictionary(const grpc::string& method,
+                                   const grpc::string& dictionary);
+
   /// Set the attached buffer pool for this server
   ServerBuilder& SetResourceQuota(
       const grpc_impl::ResourceQuota& resource_quota);
@@ -404,6 +409,7 @@ class ServerBuilder {
     grpc_compression_algorithm algorithm;
   } maybe_default_compression_algorithm_;
   uint32_t enabled_compression_algorithms_bitset_;
+  std::vector<std::pair<grpc::string, grpc::string>> zstd_dictionaries_;
   std::vector<
       std::unique_ptr<grpc::experimental::ServerInterceptorFactoryInterface>>
       interceptor_creators_;
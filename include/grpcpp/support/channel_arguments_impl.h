@@ -68,6 +68,13 @@ class ChannelArguments {
   /// Set the compression algorithm for the channel.
   void SetCompressionAlgorithm(grpc_compression_algorithm algorithm);
 
+  /// Set the zstd dictionary for calls to \a method, given as a full path
+  /// ("/package.Service/Method"). \a dictionary must be a trained dictionary,
+  /// as produced by `zstd --train`; invalid ones are logged and ignored. The
+  /// dictionary is only used once the peer has advertised it as well.
+  void SetZstdDictionary(const grpc::string& method,
+                         const grpc::string& dictionary);
+
   /// Set the grpclb fallback timeout (in ms) for the channel. If this amount
   /// of time has passed but we have not gotten any non-empty \a serverlist from
   /// the balancer, we will fall back to use the backend address(es) returned by
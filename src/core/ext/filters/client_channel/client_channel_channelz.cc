@@ -66,6 +66,7 @@ Json SubchannelNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  compression_counter_.PopulateCompressionData(&data);
   // Construct top-level object.
   Json::Object object{
       {"ref",
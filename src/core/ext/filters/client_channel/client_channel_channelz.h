@@ -63,12 +63,17 @@ class SubchannelNode : public BaseNode {
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
 
+  CompressionCountingHelper* compression_counter() {
+    return &compression_counter_;
+  }
+
  private:
   Atomic<grpc_connectivity_state> connectivity_state_{GRPC_CHANNEL_IDLE};
   Mutex socket_mu_;
   RefCountedPtr<SocketNode> child_socket_;
   std::string target_;
   CallCountingHelper call_counter_;
+  CompressionCountingHelper compression_counter_;
   ChannelTrace trace_;
 };
 
@@ -1017,13 +1017,33 @@ void ConnectionDestroy(void* arg, grpc_error* /*error*/) {
   gpr_free(stk);
 }
 
+// The compression counters belong to the subchannel's channelz node, which
+// the ConnectedSubchannel keeps alive for as long as the stack has calls.
+void* CompressionCounterArgCopy(void* p) { return p; }
+void CompressionCounterArgDestroy(void* /*p*/) {}
+int CompressionCounterArgCmp(void* p1, void* p2) { return GPR_ICMP(p1, p2); }
+const grpc_arg_pointer_vtable kCompressionCounterArgVtable = {
+    CompressionCounterArgCopy, CompressionCounterArgDestroy,
+    CompressionCounterArgCmp};
+
 }  // namespace
 
 bool Subchannel::PublishTransportLocked() {
   // Construct channel stack.
   grpc_channel_stack_builder* builder = grpc_channel_stack_builder_create();
-  grpc_channel_stack_builder_set_channel_arguments(
-      builder, connecting_result_.channel_args);
+  if (channelz_node_ != nullptr) {
+    // Lets the compression filter record the messages it compresses.
+    grpc_arg arg = grpc_channel_arg_pointer_create(
+        const_cast<char*>(GRPC_ARG_CHANNELZ_SUBCHANNEL_COMPRESSION_COUNTER),
+        channelz_node_->compression_counter(), &kCompressionCounterArgVtable);
+    grpc_channel_args* args = grpc_channel_args_copy_and_add(
+        connecting_result_.channel_args, &arg, 1);
+    grpc_channel_stack_builder_set_channel_arguments(builder, args);
+    grpc_channel_args_destroy(args);
+  } else {
+    grpc_channel_stack_builder_set_channel_arguments(
+        builder, connecting_result_.channel_args);
+  }
   grpc_channel_stack_builder_set_transport(builder,
                                            connecting_result_.transport);
   if (!grpc_channel_init_create_stack(builder, GRPC_CLIENT_SUBCHANNEL)) {
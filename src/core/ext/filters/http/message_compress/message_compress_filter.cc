@@ -19,33 +19,192 @@
 #include <grpc/support/port_platform.h>
 
 #include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
 #include <string.h>
 
 #include <grpc/compression.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/filters/http/message_compress/message_compress_filter.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/compression/adaptive_compression.h"
 #include "src/core/lib/compression/algorithm_metadata.h"
 #include "src/core/lib/compression/compression_args.h"
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/compression/zstd_dictionary.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/executor.h"
+#include "src/core/lib/iomgr/resource_quota.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/surface/call.h"
+#include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/transport/static_metadata.h"
+#include "src/core/lib/transport/transport.h"
+#include "src/core/lib/transport/transport_impl.h"
+
+namespace grpc_core {
+
+namespace {
+size_t g_message_compress_parser_index;
+}  // namespace
+
+std::unique_ptr<ServiceConfig::ParsedConfig>
+MessageCompressParser::ParsePerMethodParams(const Json& json,
+                                            grpc_error** error) {
+  GPR_DEBUG_ASSERT(error != nullptr && *error == GRPC_ERROR_NONE);
+  auto it = json.object_value().find("compressionPolicy");
+  if (it == json.object_value().end()) return nullptr;
+  if (it->second.type() != Json::Type::OBJECT) {
+    *error = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "field:compressionPolicy error:should be of type object");
+    return nullptr;
+  }
+  const Json::Object& policy_json = it->second.object_value();
+  MessageCompressParsedConfig::CompressionPolicy policy;
+  std::vector<grpc_error*> error_list;
+  // Parse algorithm.
+  it = policy_json.find("algorithm");
+  if (it != policy_json.end()) {
+    grpc_compression_algorithm algorithm;
+    if (it->second.type() != Json::Type::STRING) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:algorithm error:should be of type string"));
+    } else if (!grpc_compression_algorithm_parse(
+                   grpc_slice_from_static_buffer(
+                       it->second.string_value().data(),
+                       it->second.string_value().size()),
+                   &algorithm)) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:algorithm error:unknown compression algorithm"));
+    } else {
+      policy.algorithm.emplace(algorithm);
+    }
+  }
+  // Parse level.
+  it = policy_json.find("level");
+  if (it != policy_json.end()) {
+    int level;
+    if (it->second.type() != Json::Type::NUMBER) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:level error:should be of type number"));
+    } else if (sscanf(it->second.string_value().c_str(), "%d", &level) != 1) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:level error:failed to parse"));
+    } else {
+      policy.level.emplace(level);
+    }
+  }
+  // Parse minMessageBytes.
+  it = policy_json.find("minMessageBytes");
+  if (it != policy_json.end()) {
+    if (it->second.type() != Json::Type::NUMBER) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:minMessageBytes error:should be of type number"));
+    } else {
+      int min_message_size =
+          gpr_parse_nonnegative_int(it->second.string_value().c_str());
+      if (min_message_size == -1) {
+        error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            "field:minMessageBytes error:should be non-negative"));
+      } else {
+        policy.min_message_size.emplace(min_message_size);
+      }
+    }
+  }
+  // Parse direction.
+  it = policy_json.find("direction");
+  if (it != policy_json.end()) {
+    if (it->second.type() != Json::Type::STRING) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:direction error:should be of type string"));
+    } else if (it->second.string_value() == "REQUEST") {
+      policy.responses = false;
+    } else if (it->second.string_value() == "RESPONSE") {
+      policy.requests = false;
+    } else if (it->second.string_value() != "REQUEST_AND_RESPONSE") {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:direction error:should be REQUEST, RESPONSE or "
+          "REQUEST_AND_RESPONSE"));
+    }
+  }
+  if (!error_list.empty()) {
+    grpc_error* policy_error =
+        GRPC_ERROR_CREATE_FROM_VECTOR("compressionPolicy", &error_list);
+    *error = GRPC_ERROR_CREATE_REFERENCING_FROM_STATIC_STRING(
+        "Message compress parser", &policy_error, 1);
+    GRPC_ERROR_UNREF(policy_error);
+    return nullptr;
+  }
+  return absl::make_unique<MessageCompressParsedConfig>(policy);
+}
+
+void MessageCompressParser::Register() {
+  g_message_compress_parser_index =
+      ServiceConfig::RegisterParser(absl::make_unique<MessageCompressParser>());
+}
+
+size_t MessageCompressParser::ParserIndex() {
+  return g_message_compress_parser_index;
+}
+
+}  // namespace grpc_core
+
+using grpc_core::MessageCompressParsedConfig;
+using grpc_core::MessageCompressParser;
 
 static void start_send_message_batch(void* arg, grpc_error* unused);
 static void send_message_on_complete(void* arg, grpc_error* error);
 static void on_send_message_next_done(void* arg, grpc_error* error);
+static void on_recv_initial_metadata_ready(void* arg, grpc_error* error);
+static void compress_message_on_executor(void* arg, grpc_error* unused);
+static void send_buffered_message_in_call_combiner(void* arg,
+                                                     grpc_error* unused);
+static void fail_send_message_batch_in_call_combiner(void* arg,
+                                                     grpc_error* error);
+
+/* Initial metadata advertising the ID of the zstd dictionary that the sender
+ * can decompress messages of the call with. */
+#define GRPC_ACCEPT_ZSTD_DICTIONARY_MD_KEY "grpc-accept-zstd-dictionary"
+/* Initial metadata carrying the ID of the zstd dictionary that the sender
+ * compresses messages of the call with. Receivers need not parse it: zstd
+ * records the ID in every frame. */
+#define GRPC_ZSTD_DICTIONARY_MD_KEY "grpc-zstd-dictionary"
+
+/* Makes the names of message samples unique within the process. */
+static gpr_atm g_message_sample_sequence;
 
 namespace {
 
+struct zstd_method_dictionary {
+  grpc_slice method;
+  grpc_zstd_dictionary* dictionary;
+  /** Clients only: whether the server advertised the dictionary. Learned from
+   * the server's initial metadata, and used by the following calls. */
+  grpc_core::Atomic<bool> peer_accepts{false};
+};
+
+struct method_min_message_size {
+  grpc_slice method;
+  int size;
+};
+
 struct channel_data {
   /** The default, channel-level, compression algorithm */
   grpc_compression_algorithm default_compression_algorithm;
@@ -55,12 +214,151 @@ struct channel_data {
   uint32_t enabled_message_compression_algorithms_bitset;
   /** Bitset of enabled stream compression algorithms */
   uint32_t enabled_stream_compression_algorithms_bitset;
+  /** The default, channel-level, zstd compression level */
+  int zstd_compression_level;
+  /** Picks the zstd level at run time, or null if the level is static */
+  grpc_core::AdaptiveCompressionController* adaptive_controller;
+  /** zstd worker threads per message, for messages of at least
+   * zstd_workers_min_message_size bytes */
+  int zstd_workers;
+  size_t zstd_workers_min_message_size;
+  /** Base 2 logarithm of the largest zstd window to compress with, 0 for
+   * zstd's defaults */
+  int zstd_window_log_max;
+  /** Charged with the memory that compressing messages takes, or null if the
+   * channel has no resource quota */
+  grpc_resource_user* resource_user;
+  /** Messages of at least this size are compressed on the executor, 0 if
+   * never */
+  size_t offload_min_message_size;
+  /** zstd dictionaries by method, from channel args */
+  zstd_method_dictionary* zstd_dictionaries;
+  size_t num_zstd_dictionaries;
+  /** Directory to write message samples to, or null if sampling is off */
+  char* zstd_sample_dir;
+  /** Minimum interval between two message samples */
+  grpc_millis zstd_sample_interval;
+  /** Earliest time of the next message sample (a grpc_millis) */
+  gpr_atm zstd_next_sample_time;
+  /** Messages smaller than this are not compressed */
+  int min_message_size;
+  /** Overrides of min_message_size by method, from channel args */
+  method_min_message_size* method_min_message_sizes;
+  size_t num_method_min_message_sizes;
+  /** Messages whose samples compress by less than this are not compressed */
+  int min_savings_percent;
+  /** The channelz compression counters of the subchannel whose connected
+   * stack this is, if any */
+  grpc_core::channelz::CompressionCountingHelper*
+      subchannel_compression_counter;
+  /** Whether calls that did not request an algorithm adopt the one of an
+   * already compressed message sent along with their initial metadata */
+  bool compression_passthrough;
+  /** Clients in pass-through mode only: the message compression algorithms
+   * (a bitset) accepted by the server in its last initial metadata */
+  gpr_atm peer_accepted_encodings;
+  /** Whether to skip the default compression algorithm on local links */
+  bool bypass_local_compression;
+  /** Whether the transport runs over a Unix domain socket or a loopback
+   * address */
+  bool link_is_local;
+  /** The service config from channel args, if any. Clients normally get
+   * theirs from the call context instead. */
+  grpc_core::ServiceConfig* svc_cfg;
+};
+
+zstd_method_dictionary* find_zstd_dictionary(channel_data* channeld,
+                                             const grpc_slice& method) {
+  for (size_t i = 0; i < channeld->num_zstd_dictionaries; i++) {
+    if (grpc_slice_eq(channeld->zstd_dictionaries[i].method, method)) {
+      return &channeld->zstd_dictionaries[i];
+    }
+  }
+  return nullptr;
+}
+
+// Returns the compression policy of \a method in the channel's service config,
+// or null if it has none.
+const MessageCompressParsedConfig::CompressionPolicy* find_compression_policy(
+    channel_data* channeld, const grpc_slice& method) {
+  if (channeld->svc_cfg == nullptr) return nullptr;
+  const auto* parsed_configs =
+      channeld->svc_cfg->GetMethodParsedConfigVector(method);
+  if (parsed_configs == nullptr) return nullptr;
+  const auto* method_config = static_cast<const MessageCompressParsedConfig*>(
+      (*parsed_configs)[MessageCompressParser::ParserIndex()].get());
+  return method_config == nullptr ? nullptr : &method_config->policy();
+}
+
+int find_min_message_size(channel_data* channeld, const grpc_slice& method) {
+  for (size_t i = 0; i < channeld->num_method_min_message_sizes; i++) {
+    if (grpc_slice_eq(channeld->method_min_message_sizes[i].method, method)) {
+      return channeld->method_min_message_sizes[i].size;
+    }
+  }
+  return channeld->min_message_size;
+}
+
+// Compresses the messages of a call before they reach the filter, for
+// grpc_call_compress_message, once the call has sent its initial metadata.
+class MessageCompressor : public grpc_core::CallMessageCompressor {
+ public:
+  explicit MessageCompressor(grpc_call_element* elem) : elem_(elem) {}
+
+  // Called once the call settled on how it compresses its messages.
+  void SetReady() { ready_.Store(true, grpc_core::MemoryOrder::RELEASE); }
+
+  int Compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+               grpc_compression_algorithm* algorithm) override;
+
+ private:
+  grpc_call_element* const elem_;
+  grpc_core::Atomic<bool> ready_{false};
 };
 
 struct call_data {
   call_data(grpc_call_element* elem, const grpc_call_element_args& args)
-      : call_combiner(args.call_combiner) {
+      : call_combiner(args.call_combiner),
+        is_client(!GRPC_SLICE_IS_EMPTY(args.path)),
+        message_compressor(elem),
+        message_compressor_slot(
+            static_cast<grpc_core::CallMessageCompressorSlot*>(
+                args.context[GRPC_CONTEXT_MESSAGE_COMPRESSOR].value)) {
     channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+    zstd_compression_level = channeld->zstd_compression_level;
+    // Servers only learn the method from the client's initial metadata.
+    min_message_size = is_client ? find_min_message_size(channeld, args.path)
+                                 : channeld->min_message_size;
+    if (is_client && channeld->num_zstd_dictionaries > 0) {
+      zstd_dictionary = find_zstd_dictionary(channeld, args.path);
+    }
+    if (is_client && channeld->zstd_sample_dir != nullptr) {
+      path = grpc_slice_ref_internal(args.path);
+    }
+    if (is_client) {
+      // The client channel filter puts the method's service config in the
+      // call context. Direct channels only have the one from channel args.
+      auto* svc_cfg_call_data =
+          static_cast<grpc_core::ServiceConfig::CallData*>(
+              args.context[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA].value);
+      if (svc_cfg_call_data != nullptr) {
+        const auto* method_config =
+            static_cast<const MessageCompressParsedConfig*>(
+                svc_cfg_call_data->GetMethodParsedConfig(
+                    MessageCompressParser::ParserIndex()));
+        if (method_config != nullptr) {
+          compression_policy = &method_config->policy();
+        }
+      } else {
+        compression_policy = find_compression_policy(channeld, args.path);
+      }
+      if (compression_policy != nullptr && !compression_policy->requests) {
+        compression_policy = nullptr;
+      }
+    }
+    channel_compression_counter =
+        static_cast<grpc_core::channelz::CompressionCountingHelper*>(
+            args.context[GRPC_CONTEXT_CHANNELZ_COMPRESSION_COUNTER].value);
     // The call's message compression algorithm is set to channel's default
     // setting. It can be overridden later by initial metadata.
     if (GPR_LIKELY(GPR_BITGET(channeld->enabled_compression_algorithms_bitset,
@@ -72,18 +370,74 @@ struct call_data {
     GRPC_CLOSURE_INIT(&start_send_message_batch_in_call_combiner,
                       start_send_message_batch, elem,
                       grpc_schedule_on_exec_ctx);
+    GRPC_CLOSURE_INIT(&recv_initial_metadata_ready,
+                      on_recv_initial_metadata_ready, elem,
+                      grpc_schedule_on_exec_ctx);
+    if (message_compressor_slot != nullptr) {
+      message_compressor_slot->Set(&message_compressor);
+    }
   }
 
   ~call_data() {
+    if (message_compressor_slot != nullptr) {
+      message_compressor_slot->Clear(&message_compressor);
+    }
     if (state_initialized) {
       grpc_slice_buffer_destroy_internal(&slices);
     }
+    grpc_slice_unref_internal(path);
     GRPC_ERROR_UNREF(cancel_error);
   }
 
   grpc_core::CallCombiner* call_combiner;
+  const bool is_client;
+  MessageCompressor message_compressor;
+  /* Where the call looks up message_compressor, null for calls created
+   * without a surface call. */
+  grpc_core::CallMessageCompressorSlot* const message_compressor_slot;
   grpc_message_compression_algorithm message_compression_algorithm =
       GRPC_MESSAGE_COMPRESS_NONE;
+  int zstd_compression_level;
+  /* Whether the channel's adaptive controller picks the zstd level. */
+  bool adaptive_zstd_level = false;
+  /* Adaptive level only: when the current message was sent down, and its
+   * size on the wire. */
+  gpr_timespec send_start_time;
+  size_t send_wire_bytes = 0;
+  /* The zstd dictionary for the call's method, if any. */
+  zstd_method_dictionary* zstd_dictionary = nullptr;
+  /* Servers only: whether the client advertised zstd_dictionary. */
+  bool peer_accepts_zstd_dictionary = false;
+  /* Servers in pass-through mode only: the message compression algorithms (a
+   * bitset) that the client accepts. */
+  uint32_t peer_accepted_encodings = 0;
+  /* The dictionary that zstd messages are compressed with, if any. */
+  grpc_zstd_dictionary* send_zstd_dictionary = nullptr;
+  /* The call's method, only set when the channel samples messages. */
+  grpc_slice path = grpc_empty_slice();
+  /* Whether the current message is sampled for dictionary training. */
+  bool sample_message = false;
+  /* Messages smaller than this are not compressed. */
+  int min_message_size;
+  /* The compression policy of the call's method from the service config, if
+   * any applies to the messages that this side sends. */
+  const MessageCompressParsedConfig::CompressionPolicy* compression_policy =
+      nullptr;
+  /* The channelz compression counters of the call's channel, if any. */
+  grpc_core::channelz::CompressionCountingHelper* channel_compression_counter;
+  /* Whether the current message is to be compressed. */
+  bool compress_current_message = false;
+  /* The algorithm that the current message was compressed with before it
+   * reached the filter, if it is not the call's, or its zstd windows exceed
+   * the channel's cap, and the message has to be decompressed. */
+  grpc_message_compression_algorithm precompressed_algorithm =
+      GRPC_MESSAGE_COMPRESS_NONE;
+  /* Whether the current message was compressed with zstd before it reached
+   * the filter and its windows must be checked against the channel's cap. */
+  bool check_precompressed_window = false;
+  grpc_metadata_batch* recv_initial_metadata = nullptr;
+  grpc_closure recv_initial_metadata_ready;
+  grpc_closure* original_recv_initial_metadata_ready = nullptr;
   grpc_error* cancel_error = GRPC_ERROR_NONE;
   grpc_transport_stream_op_batch* send_message_batch = nullptr;
   bool seen_initial_metadata = false;
@@ -97,12 +451,18 @@ struct call_data {
   grpc_linked_mdelem stream_compression_algorithm_storage;
   grpc_linked_mdelem accept_encoding_storage;
   grpc_linked_mdelem accept_stream_encoding_storage;
+  grpc_linked_mdelem accept_zstd_dictionary_storage;
+  grpc_linked_mdelem zstd_dictionary_storage;
   grpc_slice_buffer slices; /**< Buffers up input slices to be compressed */
   grpc_core::ManualConstructor<grpc_core::SliceBufferByteStream>
       replacement_stream;
   grpc_closure* original_send_message_on_complete;
   grpc_closure send_message_on_complete;
   grpc_closure on_send_message_next_done;
+  /* Flags of the message being sent. */
+  uint32_t send_flags;
+  grpc_closure compress_message_on_executor;
+  grpc_closure send_buffered_message_in_call_combiner;
 };
 
 }  // namespace
@@ -114,19 +474,137 @@ static bool skip_message_compression(grpc_call_element* elem) {
   // skip message compression.
   uint32_t flags =
       calld->send_message_batch->payload->send_message.send_message->flags();
-  if (flags & (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS)) {
+  if (flags & GRPC_WRITE_NO_COMPRESS) {
+    return true;
+  }
+  // Messages that were compressed before they reached the filter, such as
+  // the ones serialized straight into a compressed buffer, are sent as they
+  // are. Only those compressed with another algorithm than the call's are
+  // decompressed and then handled like any other message.
+  if ((flags & GRPC_WRITE_INTERNAL_COMPRESS) &&
+      calld->precompressed_algorithm == GRPC_MESSAGE_COMPRESS_NONE) {
     return true;
   }
   // If this call doesn't have any message compression algorithm set, skip
   // message compression.
-  return calld->message_compression_algorithm == GRPC_MESSAGE_COMPRESS_NONE;
+  if (calld->message_compression_algorithm == GRPC_MESSAGE_COMPRESS_NONE) {
+    return true;
+  }
+  // Small messages do not gain enough to pay for compressing them.
+  if (calld->send_message_batch->payload->send_message.send_message->length() <
+      static_cast<uint32_t>(calld->min_message_size)) {
+    GRPC_STATS_INC_MESSAGE_COMPRESSION_SKIPPED_SMALL();
+    return true;
+  }
+  return false;
+}
+
+// Decides whether to sample the current message for zstd dictionary training.
+// Messages that must not be compressed are never sampled either.
+static bool should_sample_message(grpc_call_element* elem) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  if (channeld->zstd_sample_dir == nullptr ||
+      GRPC_SLICE_IS_EMPTY(calld->path)) {
+    return false;
+  }
+  uint32_t flags =
+      calld->send_message_batch->payload->send_message.send_message->flags();
+  if (flags & (GRPC_WRITE_NO_COMPRESS | GRPC_WRITE_INTERNAL_COMPRESS)) {
+    return false;
+  }
+  const grpc_millis now = grpc_core::ExecCtx::Get()->Now();
+  const gpr_atm next_sample_time =
+      gpr_atm_no_barrier_load(&channeld->zstd_next_sample_time);
+  // Of the calls racing for the same sample, only one wins the CAS.
+  return now >= next_sample_time &&
+         gpr_atm_no_barrier_cas(
+             &channeld->zstd_next_sample_time, next_sample_time,
+             static_cast<gpr_atm>(now + channeld->zstd_sample_interval));
+}
+
+namespace {
+
+// A message sample waiting to be written on the executor.
+struct message_sample {
+  grpc_closure closure;
+  char* filename;
+  grpc_slice data;
+};
+
+}  // namespace
+
+// Writes a message sample to its file, then frees it. Runs on the executor,
+// so that the file I/O does not hold up the call combiner.
+static void write_message_sample_on_executor(void* arg,
+                                             grpc_error* /*unused*/) {
+  message_sample* sample = static_cast<message_sample*>(arg);
+  FILE* file = fopen(sample->filename, "wb");
+  if (file == nullptr) {
+    gpr_log(GPR_ERROR, "Failed to create message sample %s: %s",
+            sample->filename, strerror(errno));
+  } else {
+    const bool ok = fwrite(GRPC_SLICE_START_PTR(sample->data), 1,
+                           GRPC_SLICE_LENGTH(sample->data),
+                           file) == GRPC_SLICE_LENGTH(sample->data);
+    if (fclose(file) != 0 || !ok) {
+      gpr_log(GPR_ERROR, "Failed to write message sample %s",
+              sample->filename);
+      remove(sample->filename);
+    }
+  }
+  grpc_slice_unref_internal(sample->data);
+  gpr_free(sample->filename);
+  gpr_free(sample);
+}
+
+// Writes a copy of the uncompressed message in calld->slices to a new file in
+// the channel's sample directory. The copy outlives the message, whose slices
+// may belong to the application once it is sent.
+static void write_message_sample(grpc_call_element* elem) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  // "/package.Service/Method" is written as "package.Service_Method".
+  char* method = grpc_slice_to_c_string(calld->path);
+  char* name = method[0] == '/' ? method + 1 : method;
+  for (char* p = name; *p != '\0'; p++) {
+    if (!isalnum(static_cast<unsigned char>(*p)) && *p != '.' && *p != '-') {
+      *p = '_';
+    }
+  }
+  const gpr_timespec now = gpr_now(GPR_CLOCK_REALTIME);
+  message_sample* sample =
+      static_cast<message_sample*>(gpr_malloc(sizeof(message_sample)));
+  gpr_asprintf(&sample->filename, "%s/%s.%" PRId64 "-%09d-%" PRIdPTR ".sample",
+               channeld->zstd_sample_dir, name, now.tv_sec, now.tv_nsec,
+               gpr_atm_no_barrier_fetch_add(&g_message_sample_sequence, 1));
+  gpr_free(method);
+  sample->data = grpc_slice_malloc(calld->slices.length);
+  uint8_t* p = GRPC_SLICE_START_PTR(sample->data);
+  for (size_t i = 0; i < calld->slices.count; i++) {
+    const grpc_slice& slice = calld->slices.slices[i];
+    memcpy(p, GRPC_SLICE_START_PTR(slice), GRPC_SLICE_LENGTH(slice));
+    p += GRPC_SLICE_LENGTH(slice);
+  }
+  grpc_core::Executor::Run(
+      GRPC_CLOSURE_INIT(&sample->closure, write_message_sample_on_executor,
+                        sample, grpc_schedule_on_exec_ctx),
+      GRPC_ERROR_NONE);
 }
 
 // Determines the compression algorithm from the initial metadata and the
 // channel's default setting.
 static grpc_compression_algorithm find_compression_algorithm(
-    grpc_metadata_batch* initial_metadata, channel_data* channeld) {
+    grpc_metadata_batch* initial_metadata, channel_data* channeld,
+    const MessageCompressParsedConfig::CompressionPolicy* policy) {
   if (initial_metadata->idx.named.grpc_internal_encoding_request == nullptr) {
+    if (policy != nullptr && policy->algorithm.has_value() &&
+        GPR_BITGET(channeld->enabled_compression_algorithms_bitset,
+                   *policy->algorithm)) {
+      return *policy->algorithm;
+    }
+    // Local links only skip the channel's default.
+    if (channeld->link_is_local) return GRPC_COMPRESS_NONE;
     return channeld->default_compression_algorithm;
   }
   grpc_compression_algorithm compression_algorithm;
@@ -158,6 +636,37 @@ static grpc_compression_algorithm find_compression_algorithm(
   return GRPC_COMPRESS_NONE;
 }
 
+// Determines the zstd compression level from the initial metadata and the
+// channel's default setting. Explicit application metadata precedes the entry
+// that call.cc derives from a compression level, so the first one wins. Sets
+// *found if the metadata set a level.
+static int find_zstd_compression_level(grpc_metadata_batch* initial_metadata,
+                                       channel_data* channeld, bool* found) {
+  int level = channeld->zstd_compression_level;
+  *found = false;
+  grpc_linked_mdelem* next;
+  for (grpc_linked_mdelem* l = initial_metadata->list.head; l != nullptr;
+       l = next) {
+    next = l->next;
+    if (grpc_slice_str_cmp(GRPC_MDKEY(l->md),
+                           GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY) != 0) {
+      continue;
+    }
+    if (!*found &&
+        !grpc_zstd_compression_level_parse(GRPC_MDVALUE(l->md), &level)) {
+      gpr_log(GPR_ERROR,
+              "Invalid zstd compression level from initial metadata. "
+              "Using the channel's default.");
+      level = channeld->zstd_compression_level;
+    }
+    *found = true;
+    // Remove this metadata since it's an internal one (i.e., it won't be
+    // transmitted out).
+    grpc_metadata_batch_remove(initial_metadata, l);
+  }
+  return level;
+}
+
 static void initialize_state(grpc_call_element* elem, call_data* calld) {
   GPR_DEBUG_ASSERT(!calld->state_initialized);
   calld->state_initialized = true;
@@ -168,22 +677,120 @@ static void initialize_state(grpc_call_element* elem, call_data* calld) {
   GRPC_CLOSURE_INIT(&calld->on_send_message_next_done,
                     ::on_send_message_next_done, elem,
                     grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&calld->compress_message_on_executor,
+                    ::compress_message_on_executor, elem,
+                    grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&calld->send_buffered_message_in_call_combiner,
+                    ::send_buffered_message_in_call_combiner, elem,
+                    grpc_schedule_on_exec_ctx);
 }
 
-static grpc_error* process_send_initial_metadata(
+// Advertises the zstd dictionary of the call's method to the peer and, once
+// the peer has advertised the same dictionary, compresses the call's zstd
+// messages with it.
+static grpc_error* process_send_zstd_dictionary(
     grpc_call_element* elem,
     grpc_metadata_batch* initial_metadata) GRPC_MUST_USE_RESULT;
-static grpc_error* process_send_initial_metadata(
+static grpc_error* process_send_zstd_dictionary(
     grpc_call_element* elem, grpc_metadata_batch* initial_metadata) {
   call_data* calld = static_cast<call_data*>(elem->call_data);
+  grpc_zstd_dictionary* dictionary = calld->zstd_dictionary->dictionary;
+  char id[GPR_LTOA_MIN_BUFSIZE];
+  gpr_ltoa(grpc_zstd_dictionary_id(dictionary), id);
+  grpc_error* error = grpc_metadata_batch_add_tail(
+      initial_metadata, &calld->accept_zstd_dictionary_storage,
+      grpc_mdelem_from_slices(
+          grpc_slice_from_static_string(GRPC_ACCEPT_ZSTD_DICTIONARY_MD_KEY),
+          grpc_slice_from_copied_string(id)));
+  if (error != GRPC_ERROR_NONE) return error;
+  const bool peer_accepts =
+      calld->is_client ? calld->zstd_dictionary->peer_accepts.Load(
+                             grpc_core::MemoryOrder::RELAXED)
+                       : calld->peer_accepts_zstd_dictionary;
+  if (!peer_accepts ||
+      calld->message_compression_algorithm != GRPC_MESSAGE_COMPRESS_ZSTD) {
+    return GRPC_ERROR_NONE;
+  }
+  calld->send_zstd_dictionary = dictionary;
+  return grpc_metadata_batch_add_tail(
+      initial_metadata, &calld->zstd_dictionary_storage,
+      grpc_mdelem_from_slices(
+          grpc_slice_from_static_string(GRPC_ZSTD_DICTIONARY_MD_KEY),
+          grpc_slice_from_copied_string(id)));
+}
+
+// In pass-through mode, sets *algorithm to the algorithm that a message sent
+// along with the initial metadata, with flags \a message_flags, was compressed
+// with before it reached the filter, if the channel enables it and the peer
+// accepts it. Returns whether it did.
+static bool find_passthrough_algorithm(grpc_call_element* elem,
+                                       uint32_t message_flags,
+                                       grpc_compression_algorithm* algorithm) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
   channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
-  // Find the compression algorithm.
+  // Messages to local peers are sent uncompressed, unless the call asks
+  // otherwise.
+  if (!channeld->compression_passthrough || channeld->link_is_local ||
+      !(message_flags & GRPC_WRITE_INTERNAL_COMPRESS)) {
+    return false;
+  }
+  const grpc_message_compression_algorithm message_algorithm =
+      static_cast<grpc_message_compression_algorithm>(
+          (message_flags & GRPC_WRITE_INTERNAL_ALGORITHM_MASK) >>
+          GRPC_WRITE_INTERNAL_ALGORITHM_SHIFT);
+  const uint32_t peer_accepted_encodings =
+      calld->is_client ? static_cast<uint32_t>(gpr_atm_no_barrier_load(
+                             &channeld->peer_accepted_encodings))
+                       : calld->peer_accepted_encodings;
+  if (message_algorithm == GRPC_MESSAGE_COMPRESS_NONE ||
+      !GPR_BITGET(channeld->enabled_message_compression_algorithms_bitset,
+                  message_algorithm) ||
+      !GPR_BITGET(peer_accepted_encodings, message_algorithm)) {
+    return false;
+  }
+  return grpc_compression_algorithm_from_message_stream_compression_algorithm(
+             algorithm, message_algorithm, GRPC_STREAM_COMPRESS_NONE) != 0;
+}
+
+static grpc_error* process_send_initial_metadata(
+    grpc_call_element* elem, grpc_metadata_batch* initial_metadata,
+    uint32_t message_flags) GRPC_MUST_USE_RESULT;
+static grpc_error* process_send_initial_metadata(
+    grpc_call_element* elem, grpc_metadata_batch* initial_metadata,
+    uint32_t message_flags) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  // Find the compression algorithm. Unless the application requested one, a
+  // message sent in the same batch may pick it in pass-through mode.
+  const bool algorithm_requested =
+      initial_metadata->idx.named.grpc_internal_encoding_request != nullptr;
   grpc_compression_algorithm compression_algorithm =
-      find_compression_algorithm(initial_metadata, channeld);
+      find_compression_algorithm(initial_metadata, channeld,
+                                 calld->compression_policy);
+  if (!algorithm_requested) {
+    find_passthrough_algorithm(elem, message_flags, &compression_algorithm);
+  }
+  bool explicit_zstd_level;
+  calld->zstd_compression_level = find_zstd_compression_level(
+      initial_metadata, channeld, &explicit_zstd_level);
+  // The method's compression policy overrides the channel's settings, but not
+  // the ones of the call. Its level also keeps the adaptive controller off.
+  const MessageCompressParsedConfig::CompressionPolicy* policy =
+      calld->compression_policy;
+  if (policy != nullptr && policy->level.has_value() && !explicit_zstd_level) {
+    calld->zstd_compression_level = *policy->level;
+    explicit_zstd_level = true;
+  }
+  if (policy != nullptr && policy->min_message_size.has_value()) {
+    calld->min_message_size = *policy->min_message_size;
+  }
   // Note that at most one of the following algorithms can be set.
   calld->message_compression_algorithm =
       grpc_compression_algorithm_to_message_compression_algorithm(
           compression_algorithm);
+  calld->adaptive_zstd_level =
+      channeld->adaptive_controller != nullptr && !explicit_zstd_level &&
+      calld->message_compression_algorithm == GRPC_MESSAGE_COMPRESS_ZSTD;
   grpc_stream_compression_algorithm stream_compression_algorithm =
       grpc_compression_algorithm_to_stream_compression_algorithm(
           compression_algorithm);
@@ -220,18 +827,159 @@ static grpc_error* process_send_initial_metadata(
             channeld->enabled_stream_compression_algorithms_bitset),
         GRPC_BATCH_ACCEPT_ENCODING);
   }
+  if (error != GRPC_ERROR_NONE) return error;
+  if (calld->zstd_dictionary != nullptr) {
+    error = process_send_zstd_dictionary(elem, initial_metadata);
+  }
   return error;
 }
 
+// Returns the message compression algorithms listed in a grpc-accept-encoding
+// value, as a bitset.
+static uint32_t parse_accepted_encodings(const grpc_slice& value) {
+  uint32_t accepted = 0;
+  GPR_BITSET(&accepted, GRPC_MESSAGE_COMPRESS_NONE);
+  grpc_slice_buffer parts;
+  grpc_slice_buffer_init(&parts);
+  grpc_slice_split_without_space(value, ",", &parts);
+  for (size_t i = 0; i < parts.count; i++) {
+    grpc_message_compression_algorithm algorithm;
+    if (grpc_message_compression_algorithm_parse(parts.slices[i],
+                                                 &algorithm)) {
+      GPR_BITSET(&accepted, algorithm);
+    }
+  }
+  grpc_slice_buffer_destroy_internal(&parts);
+  return accepted;
+}
+
+// Strips the zstd dictionary metadata from the peer's initial metadata, and
+// records whether the peer can decompress with the method's dictionary and,
+// in pass-through mode, which algorithms it accepts.
+static void process_recv_initial_metadata(
+    grpc_call_element* elem, grpc_metadata_batch* initial_metadata) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  if (channeld->compression_passthrough &&
+      initial_metadata->idx.named.grpc_accept_encoding != nullptr) {
+    const uint32_t accepted = parse_accepted_encodings(
+        GRPC_MDVALUE(initial_metadata->idx.named.grpc_accept_encoding->md));
+    if (calld->is_client) {
+      gpr_atm_no_barrier_store(&channeld->peer_accepted_encodings,
+                               static_cast<gpr_atm>(accepted));
+    } else {
+      calld->peer_accepted_encodings = accepted;
+    }
+  }
+  if (!calld->is_client && initial_metadata->idx.named.path != nullptr) {
+    const grpc_slice& path = GRPC_MDVALUE(initial_metadata->idx.named.path->md);
+    calld->zstd_dictionary = find_zstd_dictionary(channeld, path);
+    calld->min_message_size = find_min_message_size(channeld, path);
+    calld->compression_policy = find_compression_policy(channeld, path);
+    if (calld->compression_policy != nullptr &&
+        !calld->compression_policy->responses) {
+      calld->compression_policy = nullptr;
+    }
+    if (channeld->zstd_sample_dir != nullptr) {
+      calld->path = grpc_slice_ref_internal(path);
+    }
+  }
+  bool peer_accepts = false;
+  grpc_linked_mdelem* next;
+  for (grpc_linked_mdelem* l = initial_metadata->list.head; l != nullptr;
+       l = next) {
+    next = l->next;
+    const grpc_slice& key = GRPC_MDKEY(l->md);
+    if (grpc_slice_str_cmp(key, GRPC_ACCEPT_ZSTD_DICTIONARY_MD_KEY) == 0) {
+      const grpc_slice& value = GRPC_MDVALUE(l->md);
+      uint32_t id;
+      if (calld->zstd_dictionary != nullptr &&
+          gpr_parse_bytes_to_uint32(
+              reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(value)),
+              GRPC_SLICE_LENGTH(value), &id) &&
+          id == grpc_zstd_dictionary_id(calld->zstd_dictionary->dictionary)) {
+        peer_accepts = true;
+      }
+    } else if (grpc_slice_str_cmp(key, GRPC_ZSTD_DICTIONARY_MD_KEY) != 0) {
+      continue;
+    }
+    grpc_metadata_batch_remove(initial_metadata, l);
+  }
+  if (calld->zstd_dictionary == nullptr) return;
+  if (calld->is_client) {
+    // Trailers-only responses carry no initial metadata to learn from.
+    if (initial_metadata->list.count == 0 && !peer_accepts) return;
+    calld->zstd_dictionary->peer_accepts.Store(peer_accepts,
+                                               grpc_core::MemoryOrder::RELAXED);
+  } else {
+    calld->peer_accepts_zstd_dictionary = peer_accepts;
+  }
+}
+
+static void on_recv_initial_metadata_ready(void* arg, grpc_error* error) {
+  grpc_call_element* elem = static_cast<grpc_call_element*>(arg);
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  if (error == GRPC_ERROR_NONE) {
+    process_recv_initial_metadata(elem, calld->recv_initial_metadata);
+  }
+  grpc_core::Closure::Run(DEBUG_LOCATION,
+                          calld->original_recv_initial_metadata_ready,
+                          GRPC_ERROR_REF(error));
+}
+
 static void send_message_on_complete(void* arg, grpc_error* error) {
   grpc_call_element* elem = static_cast<grpc_call_element*>(arg);
   call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
   grpc_slice_buffer_reset_and_unref_internal(&calld->slices);
+  // The time the transport took to write the message out tells the adaptive
+  // controller how fast the connection drains.
+  if (calld->adaptive_zstd_level && error == GRPC_ERROR_NONE) {
+    channeld->adaptive_controller->RecordTransmission(
+        calld->send_wire_bytes,
+        gpr_timespec_to_micros(gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC),
+                                            calld->send_start_time)) /
+            1e6);
+  }
   grpc_core::Closure::Run(DEBUG_LOCATION,
                           calld->original_send_message_on_complete,
                           GRPC_ERROR_REF(error));
 }
 
+// Returns the algorithm that the message being sent was compressed with
+// before it reached the filter if it is not the call's, and
+// GRPC_MESSAGE_COMPRESS_NONE otherwise.
+static grpc_message_compression_algorithm find_mismatched_precompression(
+    grpc_call_element* elem) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  uint32_t flags =
+      calld->send_message_batch->payload->send_message.send_message->flags();
+  if (!(flags & GRPC_WRITE_INTERNAL_COMPRESS)) {
+    return GRPC_MESSAGE_COMPRESS_NONE;
+  }
+  grpc_message_compression_algorithm algorithm =
+      static_cast<grpc_message_compression_algorithm>(
+          (flags & GRPC_WRITE_INTERNAL_ALGORITHM_MASK) >>
+          GRPC_WRITE_INTERNAL_ALGORITHM_SHIFT);
+  return algorithm == calld->message_compression_algorithm
+             ? GRPC_MESSAGE_COMPRESS_NONE
+             : algorithm;
+}
+
+// Returns whether the message being sent was compressed with the call's zstd
+// before it reached the filter, on a channel that caps zstd windows: such
+// messages are only sent as they are if their windows fit.
+static bool needs_precompressed_window_check(grpc_call_element* elem) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  uint32_t flags =
+      calld->send_message_batch->payload->send_message.send_message->flags();
+  return channeld->zstd_window_log_max > 0 &&
+         (flags & GRPC_WRITE_INTERNAL_COMPRESS) &&
+         calld->precompressed_algorithm == GRPC_MESSAGE_COMPRESS_NONE &&
+         calld->message_compression_algorithm == GRPC_MESSAGE_COMPRESS_ZSTD;
+}
+
 static void send_message_batch_continue(grpc_call_element* elem) {
   call_data* calld = static_cast<call_data*>(elem->call_data);
   // Note: The call to grpc_call_next_op() results in yielding the
@@ -243,22 +991,96 @@ static void send_message_batch_continue(grpc_call_element* elem) {
   grpc_call_next_op(elem, send_message_batch);
 }
 
-static void finish_send_message(grpc_call_element* elem) {
+// Compresses \a input into \a output as the call compresses its messages,
+// and returns whether it did. Only reads the state of the call that is
+// settled once it sent its initial metadata, so that the messages compressed
+// ahead of the filter can be compressed on any thread.
+static bool compress_slices(grpc_call_element* elem, grpc_slice_buffer* input,
+                            grpc_slice_buffer* output) {
   call_data* calld = static_cast<call_data*>(elem->call_data);
-  GPR_DEBUG_ASSERT(calld->message_compression_algorithm !=
-                   GRPC_MESSAGE_COMPRESS_NONE);
-  // Compress the data if appropriate.
-  grpc_slice_buffer tmp;
-  grpc_slice_buffer_init(&tmp);
-  uint32_t send_flags =
-      calld->send_message_batch->payload->send_message.send_message->flags();
-  bool did_compress = grpc_msg_compress(calld->message_compression_algorithm,
-                                        &calld->slices, &tmp);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  if (!grpc_msg_is_compressible(input, channeld->min_savings_percent)) {
+    GRPC_STATS_INC_MESSAGE_COMPRESSION_SKIPPED_INCOMPRESSIBLE();
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
+      gpr_log(GPR_INFO,
+              "Message samples saved less than %d%%, not compressing. Input "
+              "size: %" PRIuPTR,
+              channeld->min_savings_percent, input->length);
+    }
+    return false;
+  }
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  options.level = calld->zstd_compression_level;
+  if (calld->adaptive_zstd_level) {
+    options.level = channeld->adaptive_controller->NextLevel();
+    if (options.level ==
+        grpc_core::AdaptiveCompressionController::kUncompressed) {
+      return false;
+    }
+  }
+  options.dictionary = calld->send_zstd_dictionary;
+  options.window_log_max = channeld->zstd_window_log_max;
+  if (input->length >= channeld->zstd_workers_min_message_size) {
+    options.workers = channeld->zstd_workers;
+  }
+  // Under memory pressure, zstd falls back to its fastest level, whose window
+  // and tables are the smallest; if the quota cannot afford even that, the
+  // message is sent uncompressed.
+  size_t charged_bytes = 0;
+  if (channeld->resource_user != nullptr) {
+    if (calld->message_compression_algorithm == GRPC_MESSAGE_COMPRESS_ZSTD &&
+        options.level > 1 &&
+        grpc_resource_quota_get_memory_pressure(grpc_resource_user_quota(
+            channeld->resource_user)) > 0.8) {
+      GRPC_STATS_INC_MESSAGE_COMPRESSION_LEVEL_LOWERED_MEMORY_PRESSURE();
+      options.level = 1;
+    }
+    charged_bytes = grpc_msg_compress_memory_estimate(
+        calld->message_compression_algorithm, &options, input->length);
+    if (!grpc_resource_user_safe_alloc(channeld->resource_user,
+                                       charged_bytes)) {
+      GRPC_STATS_INC_MESSAGE_COMPRESSION_SKIPPED_MEMORY_PRESSURE();
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
+        gpr_log(GPR_INFO,
+                "Resource quota exhausted, not compressing. Input size: "
+                "%" PRIuPTR,
+                input->length);
+      }
+      return false;
+    }
+  }
+  const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  bool did_compress = grpc_msg_compress_with_options(
+      calld->message_compression_algorithm, &options, input, output);
+  if (charged_bytes > 0) {
+    grpc_resource_user_free(channeld->resource_user, charged_bytes);
+  }
+  const int64_t micros = static_cast<int64_t>(gpr_timespec_to_micros(
+      gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start)));
+  const size_t wire_bytes = did_compress ? output->length : input->length;
+  if (calld->adaptive_zstd_level) {
+    channeld->adaptive_controller->RecordCompression(
+        options.level, input->length, wire_bytes, micros / 1e6);
+  }
+  grpc_msg_compress_record_stats(calld->message_compression_algorithm,
+                                 input->length, wire_bytes, micros);
+  if (calld->channel_compression_counter != nullptr) {
+    calld->channel_compression_counter->RecordMessageCompressed(
+        calld->message_compression_algorithm, input->length, wire_bytes,
+        micros);
+  }
+  if (channeld->subchannel_compression_counter != nullptr) {
+    channeld->subchannel_compression_counter->RecordMessageCompressed(
+        calld->message_compression_algorithm, input->length, wire_bytes,
+        micros);
+  }
   if (did_compress) {
+    GRPC_STATS_INC_MESSAGE_COMPRESSION_COMPRESSED();
     if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
       const char* algo_name;
-      const size_t before_size = calld->slices.length;
-      const size_t after_size = tmp.length;
+      const size_t before_size = input->length;
+      const size_t after_size = output->length;
       const float savings_ratio = 1.0f - static_cast<float>(after_size) /
                                              static_cast<float>(before_size);
       GPR_ASSERT(grpc_message_compression_algorithm_name(
@@ -268,9 +1090,8 @@ static void finish_send_message(grpc_call_element* elem) {
               " bytes (%.2f%% savings)",
               algo_name, before_size, after_size, 100 * savings_ratio);
     }
-    grpc_slice_buffer_swap(&calld->slices, &tmp);
-    send_flags |= GRPC_WRITE_INTERNAL_COMPRESS;
   } else {
+    GRPC_STATS_INC_MESSAGE_COMPRESSION_NOT_SMALLER();
     if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
       const char* algo_name;
       GPR_ASSERT(grpc_message_compression_algorithm_name(
@@ -278,13 +1099,121 @@ static void finish_send_message(grpc_call_element* elem) {
       gpr_log(GPR_INFO,
               "Algorithm '%s' enabled but decided not to compress. Input size: "
               "%" PRIuPTR,
-              algo_name, calld->slices.length);
+              algo_name, input->length);
     }
+    grpc_slice_buffer_reset_and_unref_internal(output);
+  }
+  return did_compress;
+}
+
+// Compresses calld->slices in place if appropriate, flagging the message as
+// compressed in *send_flags if it did.
+static void compress_message(grpc_call_element* elem, uint32_t* send_flags) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  grpc_slice_buffer tmp;
+  grpc_slice_buffer_init(&tmp);
+  if (compress_slices(elem, &calld->slices, &tmp)) {
+    grpc_slice_buffer_swap(&calld->slices, &tmp);
+    *send_flags |= GRPC_WRITE_INTERNAL_COMPRESS;
   }
   grpc_slice_buffer_destroy_internal(&tmp);
+}
+
+int MessageCompressor::Compress(grpc_slice_buffer* input,
+                                grpc_slice_buffer* output,
+                                grpc_compression_algorithm* algorithm) {
+  if (!ready_.Load(grpc_core::MemoryOrder::ACQUIRE)) return -1;
+  call_data* calld = static_cast<call_data*>(elem_->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem_->channel_data);
+  // Messages the filter would skip anyway are left to it, as are the ones it
+  // may sample: it only samples the messages that it compresses itself.
+  if (calld->message_compression_algorithm == GRPC_MESSAGE_COMPRESS_NONE ||
+      input->length < static_cast<size_t>(calld->min_message_size)) {
+    return -1;
+  }
+  if (channeld->zstd_sample_dir != nullptr &&
+      !GRPC_SLICE_IS_EMPTY(calld->path) &&
+      grpc_core::ExecCtx::Get()->Now() >=
+          gpr_atm_no_barrier_load(&channeld->zstd_next_sample_time)) {
+    return -1;
+  }
+  if (!compress_slices(elem_, input, output)) return 0;
+  GPR_ASSERT(
+      grpc_compression_algorithm_from_message_stream_compression_algorithm(
+          algorithm, calld->message_compression_algorithm,
+          GRPC_STREAM_COMPRESS_NONE));
+  return 1;
+}
+
+// Returns whether the zstd frames in calld->slices, which were compressed
+// before they reached the filter, decompress within the channel's window cap.
+static bool precompressed_window_fits(grpc_call_element* elem) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  grpc_msg_decompress_options options;
+  grpc_msg_decompress_options_init(&options);
+  options.window_log_max = channeld->zstd_window_log_max;
+  grpc_msg_decompressor* decompressor = grpc_msg_decompressor_create(
+      GRPC_MESSAGE_COMPRESS_ZSTD, &options, &calld->slices);
+  if (decompressor == nullptr) return false;
+  // A block smaller than any window keeps zstd from decompressing a frame in a
+  // single pass, which needs no window and so skips the check.
+  uint8_t block[1024];
+  size_t length;
+  int result;
+  do {
+    result = grpc_msg_decompressor_read(decompressor, block, sizeof(block),
+                                        &length);
+  } while (result == 1);
+  grpc_msg_decompressor_destroy(decompressor);
+  return result == 0;
+}
+
+// Decompresses calld->slices, which were compressed before they reached the
+// filter with another algorithm than the call's, or beyond the channel's zstd
+// window cap.
+static grpc_error* decompress_precompressed_message(grpc_call_element* elem) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
+    const char* algo_name = "unknown";
+    grpc_message_compression_algorithm_name(calld->precompressed_algorithm,
+                                            &algo_name);
+    gpr_log(GPR_INFO,
+            "Message compressed with '%s' before it was sent, not as the call "
+            "compresses messages: decompressing it",
+            algo_name);
+  }
+  grpc_slice_buffer tmp;
+  grpc_slice_buffer_init(&tmp);
+  grpc_error* error = GRPC_ERROR_NONE;
+  const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  if (grpc_msg_decompress(calld->precompressed_algorithm, &calld->slices,
+                          &tmp)) {
+    grpc_msg_decompress_record_stats(
+        calld->precompressed_algorithm, calld->slices.length, tmp.length,
+        static_cast<int64_t>(gpr_timespec_to_micros(
+            gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start))));
+    grpc_slice_buffer_swap(&calld->slices, &tmp);
+    calld->send_flags &=
+        ~(GRPC_WRITE_INTERNAL_COMPRESS | GRPC_WRITE_INTERNAL_ALGORITHM_MASK);
+  } else {
+    error = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "Cannot decompress message compressed before it was sent");
+  }
+  grpc_slice_buffer_destroy_internal(&tmp);
+  return error;
+}
+
+// Sends the message in calld->slices, compressed or not, down the stack.
+static void send_buffered_message(grpc_call_element* elem) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  if (calld->adaptive_zstd_level) {
+    calld->send_start_time = gpr_now(GPR_CLOCK_MONOTONIC);
+    calld->send_wire_bytes = calld->slices.length;
+  }
   // Swap out the original byte stream with our new one and send the
   // batch down.
-  calld->replacement_stream.Init(&calld->slices, send_flags);
+  calld->replacement_stream.Init(&calld->slices, calld->send_flags);
   calld->send_message_batch->payload->send_message.send_message.reset(
       calld->replacement_stream.get());
   calld->original_send_message_on_complete =
@@ -293,6 +1222,67 @@ static void finish_send_message(grpc_call_element* elem) {
   send_message_batch_continue(elem);
 }
 
+// Runs on the executor, outside of the call combiner.
+static void compress_message_on_executor(void* arg, grpc_error* /*unused*/) {
+  grpc_call_element* elem = static_cast<grpc_call_element*>(arg);
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  compress_message(elem, &calld->send_flags);
+  GRPC_CALL_COMBINER_START(calld->call_combiner,
+                           &calld->send_buffered_message_in_call_combiner,
+                           GRPC_ERROR_NONE, "compressed message on executor");
+}
+
+static void send_buffered_message_in_call_combiner(void* arg,
+                                                     grpc_error* /*unused*/) {
+  send_buffered_message(static_cast<grpc_call_element*>(arg));
+}
+
+static void finish_send_message(grpc_call_element* elem) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  if (calld->sample_message) {
+    calld->sample_message = false;
+    write_message_sample(elem);
+  }
+  calld->send_flags =
+      calld->send_message_batch->payload->send_message.send_message->flags();
+  if (calld->check_precompressed_window) {
+    calld->check_precompressed_window = false;
+    if (!precompressed_window_fits(elem)) {
+      // Recompress the message within the cap, as any other message.
+      calld->precompressed_algorithm = GRPC_MESSAGE_COMPRESS_ZSTD;
+      calld->compress_current_message = !skip_message_compression(elem);
+    }
+  }
+  if (calld->precompressed_algorithm != GRPC_MESSAGE_COMPRESS_NONE) {
+    grpc_error* error = decompress_precompressed_message(elem);
+    if (error != GRPC_ERROR_NONE) {
+      // Closure callback; does not take ownership of error.
+      fail_send_message_batch_in_call_combiner(calld, error);
+      GRPC_ERROR_UNREF(error);
+      return;
+    }
+  }
+  // Messages that are not compressed are only read to be sampled.
+  if (!calld->compress_current_message) {
+    send_buffered_message(elem);
+    return;
+  }
+  // Compressing a large message would hold up every other operation on the
+  // call: release the call combiner until it is done.
+  if (channeld->offload_min_message_size > 0 &&
+      calld->slices.length >= channeld->offload_min_message_size) {
+    GRPC_CALL_COMBINER_STOP(calld->call_combiner,
+                            "compressing message on executor");
+    grpc_core::Executor::Run(&calld->compress_message_on_executor,
+                             GRPC_ERROR_NONE, grpc_core::ExecutorType::DEFAULT,
+                             grpc_core::ExecutorJobType::LONG);
+    return;
+  }
+  compress_message(elem, &calld->send_flags);
+  send_buffered_message(elem);
+}
+
 static void fail_send_message_batch_in_call_combiner(void* arg,
                                                      grpc_error* error) {
   call_data* calld = static_cast<call_data*>(arg);
@@ -369,9 +1359,17 @@ static void on_send_message_next_done(void* arg, grpc_error* error) {
 
 static void start_send_message_batch(void* arg, grpc_error* /*unused*/) {
   grpc_call_element* elem = static_cast<grpc_call_element*>(arg);
-  if (skip_message_compression(elem)) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  calld->sample_message = should_sample_message(elem);
+  calld->precompressed_algorithm = find_mismatched_precompression(elem);
+  calld->check_precompressed_window = needs_precompressed_window_check(elem);
+  calld->compress_current_message = !skip_message_compression(elem);
+  if (!calld->sample_message && !calld->compress_current_message &&
+      calld->precompressed_algorithm == GRPC_MESSAGE_COMPRESS_NONE &&
+      !calld->check_precompressed_window) {
     send_message_batch_continue(elem);
   } else {
+    if (!calld->state_initialized) initialize_state(elem, calld);
     continue_reading_send_message(elem);
   }
 }
@@ -380,6 +1378,7 @@ static void compress_start_transport_stream_op_batch(
     grpc_call_element* elem, grpc_transport_stream_op_batch* batch) {
   GPR_TIMER_SCOPE("compress_start_transport_stream_op_batch", 0);
   call_data* calld = static_cast<call_data*>(elem->call_data);
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
   // Handle cancel_stream.
   if (batch->cancel_stream) {
     GRPC_ERROR_UNREF(calld->cancel_error);
@@ -402,17 +1401,36 @@ static void compress_start_transport_stream_op_batch(
         batch, GRPC_ERROR_REF(calld->cancel_error), calld->call_combiner);
     return;
   }
+  // Intercept recv_initial_metadata, to negotiate zstd dictionaries, to learn
+  // the method of server calls and, in pass-through mode, the algorithms that
+  // the peer accepts.
+  if (batch->recv_initial_metadata &&
+      (channeld->num_zstd_dictionaries > 0 ||
+       channeld->zstd_sample_dir != nullptr ||
+       channeld->num_method_min_message_sizes > 0 ||
+       channeld->compression_passthrough || channeld->svc_cfg != nullptr)) {
+    calld->recv_initial_metadata =
+        batch->payload->recv_initial_metadata.recv_initial_metadata;
+    calld->original_recv_initial_metadata_ready =
+        batch->payload->recv_initial_metadata.recv_initial_metadata_ready;
+    batch->payload->recv_initial_metadata.recv_initial_metadata_ready =
+        &calld->recv_initial_metadata_ready;
+  }
   // Handle send_initial_metadata.
   if (batch->send_initial_metadata) {
     GPR_ASSERT(!calld->seen_initial_metadata);
     grpc_error* error = process_send_initial_metadata(
-        elem, batch->payload->send_initial_metadata.send_initial_metadata);
+        elem, batch->payload->send_initial_metadata.send_initial_metadata,
+        batch->send_message
+            ? batch->payload->send_message.send_message->flags()
+            : 0);
     if (error != GRPC_ERROR_NONE) {
       grpc_transport_stream_op_batch_finish_with_failure(batch, error,
                                                          calld->call_combiner);
       return;
     }
     calld->seen_initial_metadata = true;
+    calld->message_compressor.SetReady();
     // If we had previously received a batch containing a send_message op,
     // handle it now.  Note that we need to re-enter the call combiner
     // for this, since we can't send two batches down while holding the
@@ -461,6 +1479,66 @@ static void compress_destroy_call_elem(
   calld->~call_data();
 }
 
+// Collects the GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_PREFIX args.
+static void init_zstd_dictionaries(channel_data* channeld,
+                                   const grpc_channel_args* channel_args) {
+  static const size_t prefix_length =
+      strlen(GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_PREFIX);
+  channeld->zstd_dictionaries = nullptr;
+  channeld->num_zstd_dictionaries = 0;
+  if (channel_args == nullptr) return;
+  auto is_dictionary_arg = [](const grpc_arg& arg) {
+    return arg.type == GRPC_ARG_POINTER &&
+           arg.value.pointer.vtable == grpc_zstd_dictionary_arg_vtable() &&
+           strncmp(arg.key, GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_PREFIX,
+                   prefix_length) == 0;
+  };
+  size_t count = 0;
+  for (size_t i = 0; i < channel_args->num_args; i++) {
+    if (is_dictionary_arg(channel_args->args[i])) count++;
+  }
+  if (count == 0) return;
+  channeld->zstd_dictionaries = new zstd_method_dictionary[count];
+  for (size_t i = 0; i < channel_args->num_args; i++) {
+    const grpc_arg& arg = channel_args->args[i];
+    if (!is_dictionary_arg(arg)) continue;
+    zstd_method_dictionary* entry =
+        &channeld->zstd_dictionaries[channeld->num_zstd_dictionaries++];
+    entry->method = grpc_slice_from_copied_string(arg.key + prefix_length);
+    entry->dictionary = static_cast<grpc_zstd_dictionary*>(arg.value.pointer.p);
+    grpc_zstd_dictionary_ref(entry->dictionary);
+  }
+}
+
+// Collects the GRPC_COMPRESSION_CHANNEL_MIN_MESSAGE_SIZE_PREFIX args.
+static void init_method_min_message_sizes(
+    channel_data* channeld, const grpc_channel_args* channel_args) {
+  static const size_t prefix_length =
+      strlen(GRPC_COMPRESSION_CHANNEL_MIN_MESSAGE_SIZE_PREFIX);
+  channeld->method_min_message_sizes = nullptr;
+  channeld->num_method_min_message_sizes = 0;
+  if (channel_args == nullptr) return;
+  auto is_min_message_size_arg = [](const grpc_arg& arg) {
+    return strncmp(arg.key, GRPC_COMPRESSION_CHANNEL_MIN_MESSAGE_SIZE_PREFIX,
+                   prefix_length) == 0;
+  };
+  size_t count = 0;
+  for (size_t i = 0; i < channel_args->num_args; i++) {
+    if (is_min_message_size_arg(channel_args->args[i])) count++;
+  }
+  if (count == 0) return;
+  channeld->method_min_message_sizes = new method_min_message_size[count];
+  for (size_t i = 0; i < channel_args->num_args; i++) {
+    const grpc_arg& arg = channel_args->args[i];
+    if (!is_min_message_size_arg(arg)) continue;
+    const size_t index = channeld->num_method_min_message_sizes++;
+    method_min_message_size* entry = &channeld->method_min_message_sizes[index];
+    entry->method = grpc_slice_from_copied_string(arg.key + prefix_length);
+    entry->size = grpc_channel_arg_get_integer(
+        &arg, {channeld->min_message_size, 0, INT_MAX});
+  }
+}
+
 /* Constructor for channel_data */
 static grpc_error* compress_init_channel_elem(grpc_channel_element* elem,
                                               grpc_channel_element_args* args) {
@@ -482,18 +1560,131 @@ static grpc_error* compress_init_channel_elem(grpc_channel_element* elem,
             name);
     channeld->default_compression_algorithm = GRPC_COMPRESS_NONE;
   }
+  channeld->zstd_compression_level = grpc_channel_args_find_integer(
+      args->channel_args, GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL,
+      {GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL, INT_MIN, INT_MAX});
+  channeld->zstd_workers = grpc_channel_args_find_integer(
+      args->channel_args, GRPC_COMPRESSION_CHANNEL_ZSTD_WORKERS,
+      {0, 0, INT_MAX});
+  channeld->zstd_workers_min_message_size = grpc_channel_args_find_integer(
+      args->channel_args,
+      GRPC_COMPRESSION_CHANNEL_ZSTD_WORKERS_MIN_MESSAGE_SIZE,
+      {16 * 1024 * 1024, 0, INT_MAX});
+  channeld->zstd_window_log_max =
+      grpc_channel_args_compression_zstd_window_log_max(args->channel_args);
+  channeld->resource_user = nullptr;
+  grpc_resource_quota* resource_quota =
+      grpc_resource_quota_from_channel_args(args->channel_args, false);
+  if (resource_quota != nullptr) {
+    channeld->resource_user =
+        grpc_resource_user_create(resource_quota, "message_compress");
+    grpc_resource_quota_unref_internal(resource_quota);
+  }
+  channeld->offload_min_message_size = grpc_channel_args_find_integer(
+      args->channel_args, GRPC_COMPRESSION_CHANNEL_OFFLOAD_MIN_MESSAGE_SIZE,
+      {0, 0, INT_MAX});
+  channeld->adaptive_controller = nullptr;
+  if (grpc_channel_args_find_bool(args->channel_args,
+                                  GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL_AUTO,
+                                  false)) {
+    channeld->adaptive_controller =
+        new grpc_core::AdaptiveCompressionController(
+            channeld->zstd_compression_level);
+  }
   channeld->enabled_message_compression_algorithms_bitset =
       grpc_compression_bitset_to_message_bitset(
           channeld->enabled_compression_algorithms_bitset);
   channeld->enabled_stream_compression_algorithms_bitset =
       grpc_compression_bitset_to_stream_bitset(
           channeld->enabled_compression_algorithms_bitset);
+  init_zstd_dictionaries(channeld, args->channel_args);
+  channeld->zstd_sample_dir = gpr_strdup(grpc_channel_args_find_string(
+      args->channel_args, GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_SAMPLE_DIR));
+  channeld->zstd_sample_interval = grpc_channel_args_find_integer(
+      args->channel_args,
+      GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_SAMPLE_INTERVAL_MS,
+      {1000, 0, INT_MAX});
+  gpr_atm_no_barrier_store(&channeld->zstd_next_sample_time, 0);
+  channeld->min_message_size = grpc_channel_args_find_integer(
+      args->channel_args, GRPC_COMPRESSION_CHANNEL_MIN_MESSAGE_SIZE,
+      {0, 0, INT_MAX});
+  init_method_min_message_sizes(channeld, args->channel_args);
+  channeld->min_savings_percent = grpc_channel_args_find_integer(
+      args->channel_args, GRPC_COMPRESSION_CHANNEL_MIN_SAVINGS_PERCENT,
+      {0, 0, 100});
+  channeld->subchannel_compression_counter =
+      grpc_channel_args_find_pointer<
+          grpc_core::channelz::CompressionCountingHelper>(
+          args->channel_args,
+          GRPC_ARG_CHANNELZ_SUBCHANNEL_COMPRESSION_COUNTER);
+  channeld->compression_passthrough = grpc_channel_args_find_bool(
+      args->channel_args, GRPC_COMPRESSION_CHANNEL_PASSTHROUGH, false);
+  gpr_atm_no_barrier_store(&channeld->peer_accepted_encodings, 0);
+  channeld->bypass_local_compression = grpc_channel_args_find_bool(
+      args->channel_args, GRPC_COMPRESSION_CHANNEL_BYPASS_LOCAL, false);
+  // Set once the transport is bound.
+  channeld->link_is_local = false;
+  channeld->svc_cfg = nullptr;
+  const char* service_config_str = grpc_channel_args_find_string(
+      args->channel_args, GRPC_ARG_SERVICE_CONFIG);
+  if (service_config_str != nullptr) {
+    grpc_error* service_config_error = GRPC_ERROR_NONE;
+    auto svc_cfg = grpc_core::ServiceConfig::Create(service_config_str,
+                                                    &service_config_error);
+    if (service_config_error == GRPC_ERROR_NONE) {
+      channeld->svc_cfg = svc_cfg.release();
+    } else {
+      gpr_log(GPR_ERROR, "%s", grpc_error_string(service_config_error));
+    }
+    GRPC_ERROR_UNREF(service_config_error);
+  }
   GPR_ASSERT(!args->is_last);
   return GRPC_ERROR_NONE;
 }
 
 /* Destructor for channel data */
-static void compress_destroy_channel_elem(grpc_channel_element* /*elem*/) {}
+static void compress_destroy_channel_elem(grpc_channel_element* elem) {
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  for (size_t i = 0; i < channeld->num_zstd_dictionaries; i++) {
+    grpc_slice_unref_internal(channeld->zstd_dictionaries[i].method);
+    grpc_zstd_dictionary_unref(channeld->zstd_dictionaries[i].dictionary);
+  }
+  delete[] channeld->zstd_dictionaries;
+  gpr_free(channeld->zstd_sample_dir);
+  for (size_t i = 0; i < channeld->num_method_min_message_sizes; i++) {
+    grpc_slice_unref_internal(channeld->method_min_message_sizes[i].method);
+  }
+  delete[] channeld->method_min_message_sizes;
+  delete channeld->adaptive_controller;
+  if (channeld->resource_user != nullptr) {
+    grpc_resource_user_shutdown(channeld->resource_user);
+    grpc_resource_user_unref(channeld->resource_user);
+  }
+  if (channeld->svc_cfg != nullptr) channeld->svc_cfg->Unref();
+}
+
+// Returns whether \a peer, an address URI as returned by
+// grpc_endpoint_get_peer(), is a Unix domain socket or a loopback address.
+// IPv4-mapped IPv6 addresses are already normalized to IPv4 ones.
+static bool is_local_peer(const char* peer) {
+  return strncmp(peer, "unix:", 5) == 0 ||
+         strncmp(peer, "ipv4:127.", 9) == 0 ||
+         strncmp(peer, "ipv6:[::1]:", 11) == 0;
+}
+
+void grpc_message_compress_filter_bind_transport(
+    grpc_channel_stack* /*channel_stack*/, grpc_channel_element* elem,
+    void* transport) {
+  channel_data* channeld = static_cast<channel_data*>(elem->channel_data);
+  GPR_ASSERT(elem->filter == &grpc_message_compress_filter);
+  if (!channeld->bypass_local_compression) return;
+  grpc_endpoint* ep =
+      grpc_transport_get_endpoint(static_cast<grpc_transport*>(transport));
+  if (ep == nullptr) return;
+  char* peer = grpc_endpoint_get_peer(ep);
+  channeld->link_is_local = is_local_peer(peer);
+  gpr_free(peer);
+}
 
 const grpc_channel_filter grpc_message_compress_filter = {
     compress_start_transport_stream_op_batch,
@@ -507,3 +1698,39 @@ const grpc_channel_filter grpc_message_compress_filter = {
     compress_destroy_channel_elem,
     grpc_channel_next_get_info,
     "message_compress"};
+
+static bool maybe_add_message_compress_filter(
+    grpc_channel_stack_builder* builder, void* /*arg*/) {
+  grpc_transport* transport = grpc_channel_stack_builder_get_transport(builder);
+  if (transport == nullptr ||
+      strstr(transport->vtable->name, "http") == nullptr) {
+    return true;
+  }
+  const grpc_channel_args* channel_args =
+      grpc_channel_stack_builder_get_channel_arguments(builder);
+  bool enable = grpc_channel_arg_get_bool(
+      grpc_channel_args_find(channel_args,
+                             GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION),
+      !grpc_channel_args_want_minimal_stack(channel_args));
+  return enable ? grpc_channel_stack_builder_prepend_filter(
+                      builder, &grpc_message_compress_filter,
+                      grpc_message_compress_filter_bind_transport, transport)
+                : true;
+}
+
+void grpc_message_compress_filter_init(void) {
+  // Ahead of the builtin stages, so that the filter stays right above the
+  // transport, below the HTTP filters.
+  grpc_channel_init_register_stage(GRPC_CLIENT_SUBCHANNEL,
+                                   GRPC_CHANNEL_INIT_BUILTIN_PRIORITY - 1,
+                                   maybe_add_message_compress_filter, nullptr);
+  grpc_channel_init_register_stage(GRPC_CLIENT_DIRECT_CHANNEL,
+                                   GRPC_CHANNEL_INIT_BUILTIN_PRIORITY - 1,
+                                   maybe_add_message_compress_filter, nullptr);
+  grpc_channel_init_register_stage(GRPC_SERVER_CHANNEL,
+                                   GRPC_CHANNEL_INIT_BUILTIN_PRIORITY - 1,
+                                   maybe_add_message_compress_filter, nullptr);
+  grpc_core::MessageCompressParser::Register();
+}
+
+void grpc_message_compress_filter_shutdown(void) {}
@@ -23,7 +23,9 @@
 
 #include <grpc/impl/codegen/compression_types.h>
 
+#include "src/core/ext/filters/client_channel/service_config.h"
 #include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/gprpp/optional.h"
 
 /** Compression filter for outgoing data.
  *
@@ -49,5 +51,52 @@
 
 extern const grpc_channel_filter grpc_message_compress_filter;
 
+/** Post-init function for the filter, to be called with the channel's
+ * \a transport. Lets the filter find out whether the transport runs over a
+ * local link, on which GRPC_COMPRESSION_CHANNEL_BYPASS_LOCAL skips
+ * compression. */
+void grpc_message_compress_filter_bind_transport(
+    grpc_channel_stack* channel_stack, grpc_channel_element* elem,
+    void* transport);
+
+namespace grpc_core {
+
+// The "compressionPolicy" of a method in the service config.
+class MessageCompressParsedConfig : public ServiceConfig::ParsedConfig {
+ public:
+  // Unset fields leave the channel's settings in place.
+  struct CompressionPolicy {
+    Optional<grpc_compression_algorithm> algorithm;
+    // The zstd compression level.
+    Optional<int> level;
+    // Messages smaller than this are not compressed.
+    Optional<int> min_message_size;
+    // Whether the policy applies to the messages that clients send, and to
+    // the ones that servers send.
+    bool requests = true;
+    bool responses = true;
+  };
+
+  explicit MessageCompressParsedConfig(const CompressionPolicy& policy)
+      : policy_(policy) {}
+
+  const CompressionPolicy& policy() const { return policy_; }
+
+ private:
+  CompressionPolicy policy_;
+};
+
+class MessageCompressParser : public ServiceConfig::Parser {
+ public:
+  std::unique_ptr<ServiceConfig::ParsedConfig> ParsePerMethodParams(
+      const Json& json, grpc_error** error) override;
+
+  static void Register();
+
+  static size_t ParserIndex();
+};
+
+}  // namespace grpc_core
+
 #endif /* GRPC_CORE_EXT_FILTERS_HTTP_MESSAGE_COMPRESS_MESSAGE_COMPRESS_FILTER_H \
         */
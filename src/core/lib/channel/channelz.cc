@@ -168,6 +168,89 @@ void CallCountingHelper::PopulateCallCounts(Json::Object* object) {
   }
 }
 
+//
+// CompressionCountingHelper
+//
+
+void CompressionCountingHelper::RecordMessageCompressed(
+    grpc_message_compression_algorithm algorithm, size_t input_bytes,
+    size_t output_bytes, int64_t micros) {
+  if (algorithm == GRPC_MESSAGE_COMPRESS_NONE ||
+      algorithm >= GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT) {
+    return;
+  }
+  AlgorithmCounters& counters = counters_[algorithm];
+  counters.messages_compressed.FetchAdd(1, MemoryOrder::RELAXED);
+  counters.compression_input_bytes.FetchAdd(input_bytes, MemoryOrder::RELAXED);
+  counters.compression_output_bytes.FetchAdd(output_bytes,
+                                             MemoryOrder::RELAXED);
+  counters.compression_micros.FetchAdd(micros, MemoryOrder::RELAXED);
+  if (output_bytes >= input_bytes) {
+    counters.messages_not_smaller.FetchAdd(1, MemoryOrder::RELAXED);
+  }
+}
+
+void CompressionCountingHelper::RecordCompressedMessageReceived(
+    grpc_message_compression_algorithm algorithm, size_t wire_bytes) {
+  if (algorithm == GRPC_MESSAGE_COMPRESS_NONE ||
+      algorithm >= GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT) {
+    return;
+  }
+  AlgorithmCounters& counters = counters_[algorithm];
+  counters.compressed_messages_received.FetchAdd(1, MemoryOrder::RELAXED);
+  counters.compressed_bytes_received.FetchAdd(wire_bytes,
+                                              MemoryOrder::RELAXED);
+}
+
+void CompressionCountingHelper::PopulateCompressionData(Json::Object* json) {
+  Json::Array array;
+  for (int i = GRPC_MESSAGE_COMPRESS_NONE + 1;
+       i < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; i++) {
+    AlgorithmCounters& counters = counters_[i];
+    const int64_t messages_compressed =
+        counters.messages_compressed.Load(MemoryOrder::RELAXED);
+    const int64_t compressed_messages_received =
+        counters.compressed_messages_received.Load(MemoryOrder::RELAXED);
+    if (messages_compressed == 0 && compressed_messages_received == 0) {
+      continue;
+    }
+    const char* name = nullptr;
+    GPR_ASSERT(grpc_message_compression_algorithm_name(
+        static_cast<grpc_message_compression_algorithm>(i), &name));
+    Json::Object data = {
+        {"algorithm", name},
+    };
+    if (messages_compressed != 0) {
+      const int64_t micros =
+          counters.compression_micros.Load(MemoryOrder::RELAXED);
+      char time_str[64];
+      snprintf(time_str, sizeof(time_str), "%" PRId64 ".%06" PRId64 "s",
+               micros / GPR_US_PER_SEC, micros % GPR_US_PER_SEC);
+      data["messagesCompressed"] = std::to_string(messages_compressed);
+      data["compressionInputBytes"] = std::to_string(
+          counters.compression_input_bytes.Load(MemoryOrder::RELAXED));
+      data["compressionOutputBytes"] = std::to_string(
+          counters.compression_output_bytes.Load(MemoryOrder::RELAXED));
+      data["compressionTime"] = time_str;
+      const int64_t messages_not_smaller =
+          counters.messages_not_smaller.Load(MemoryOrder::RELAXED);
+      if (messages_not_smaller != 0) {
+        data["messagesNotSmaller"] = std::to_string(messages_not_smaller);
+      }
+    }
+    if (compressed_messages_received != 0) {
+      data["compressedMessagesReceived"] =
+          std::to_string(compressed_messages_received);
+      data["compressedBytesReceived"] = std::to_string(
+          counters.compressed_bytes_received.Load(MemoryOrder::RELAXED));
+    }
+    array.emplace_back(std::move(data));
+  }
+  if (!array.empty()) {
+    (*json)["compression"] = std::move(array);
+  }
+}
+
 //
 // ChannelNode
 //
@@ -219,6 +302,7 @@ Json ChannelNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  compression_counter_.PopulateCompressionData(&data);
   // Construct outer object.
   Json::Object json = {
       {"ref",
@@ -26,6 +26,7 @@
 #include <string>
 
 #include "src/core/lib/channel/channel_trace.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/gprpp/inlined_vector.h"
@@ -44,6 +45,11 @@
 // Channel arg key to encode the channelz uuid of the channel's parent.
 #define GRPC_ARG_CHANNELZ_PARENT_UUID "grpc.channelz_parent_uuid"
 
+// Channel arg key for the CompressionCountingHelper of a subchannel's
+// channelz node, set on the subchannel's connected channel stack.
+#define GRPC_ARG_CHANNELZ_SUBCHANNEL_COMPRESSION_COUNTER \
+  "grpc.internal.channelz_subchannel_compression_counter"
+
 /** This is the default value for whether or not to enable channelz. If
  * GRPC_ARG_ENABLE_CHANNELZ is set, it will override this default value. */
 #define GRPC_ENABLE_CHANNELZ_DEFAULT true
@@ -171,6 +177,45 @@ class CallCountingHelper {
   size_t num_cores_ = 0;
 };
 
+// This class is a helper class for channelz entities that deal with Channels
+// and Subchannels. It tracks, by message compression algorithm, the messages
+// compressed before they were sent and the compressed messages received, and
+// renders them.
+//
+// Messages are only compressed when they are worth it, so unlike calls,
+// recording them does not have to be sharded per CPU.
+class CompressionCountingHelper {
+ public:
+  // Records that a message of input_bytes was compressed with algorithm into
+  // output_bytes in the given number of microseconds. Messages that were sent
+  // uncompressed because compression did not make them smaller are recorded
+  // with output_bytes equal to input_bytes.
+  void RecordMessageCompressed(grpc_message_compression_algorithm algorithm,
+                               size_t input_bytes, size_t output_bytes,
+                               int64_t micros);
+  // Records that a message of wire_bytes compressed with algorithm was
+  // received.
+  void RecordCompressedMessageReceived(
+      grpc_message_compression_algorithm algorithm, size_t wire_bytes);
+
+  // Common rendering of the compression data.
+  void PopulateCompressionData(Json::Object* json);
+
+ private:
+  struct AlgorithmCounters {
+    Atomic<int64_t> messages_compressed{0};
+    Atomic<int64_t> compression_input_bytes{0};
+    Atomic<int64_t> compression_output_bytes{0};
+    Atomic<int64_t> compression_micros{0};
+    Atomic<int64_t> messages_not_smaller{0};
+    Atomic<int64_t> compressed_messages_received{0};
+    Atomic<int64_t> compressed_bytes_received{0};
+  };
+
+  // Indexed by algorithm; GRPC_MESSAGE_COMPRESS_NONE is never recorded.
+  AlgorithmCounters counters_[GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT];
+};
+
 // Handles channelz bookkeeping for channels
 class ChannelNode : public BaseNode {
  public:
@@ -199,6 +244,10 @@ class ChannelNode : public BaseNode {
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
 
+  CompressionCountingHelper* compression_counter() {
+    return &compression_counter_;
+  }
+
   void SetConnectivityState(grpc_connectivity_state state);
 
   // TODO(roth): take in a RefCountedPtr to the child channel so we can retrieve
@@ -219,6 +268,7 @@ class ChannelNode : public BaseNode {
 
   std::string target_;
   CallCountingHelper call_counter_;
+  CompressionCountingHelper compression_counter_;
   ChannelTrace trace_;
   const intptr_t parent_uuid_;
 
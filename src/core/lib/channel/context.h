@@ -38,6 +38,14 @@ typedef enum {
   /// Holds a pointer to ServiceConfig::CallData associated with this call.
   GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA,
 
+  /// Value is the \a grpc_core::channelz::CompressionCountingHelper of the
+  /// channelz node of the call's channel, on clients with channelz enabled.
+  GRPC_CONTEXT_CHANNELZ_COMPRESSION_COUNTER,
+
+  /// Value is the \a grpc_core::CallMessageCompressorSlot of the call, in
+  /// which its compression filter puts its compressor.
+  GRPC_CONTEXT_MESSAGE_COMPRESSOR,
+
   GRPC_CONTEXT_COUNT
 } grpc_context_index;
 
@@ -0,0 +1,132 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/compression/adaptive_compression.h"
+
+#include <stdlib.h>
+
+#include "src/core/lib/gpr/useful.h"
+
+namespace grpc_core {
+
+constexpr int AdaptiveCompressionController::kUncompressed;
+constexpr size_t AdaptiveCompressionController::kNumSteps;
+
+namespace {
+
+const int kLevels[] = {AdaptiveCompressionController::kUncompressed, -5, 1, 3,
+                       5, 9, 15};
+
+// Weight of the newest message in the moving averages.
+const double kSmoothing = 0.25;
+// Messages compressed at a level before deciding whether to leave it.
+const size_t kDecisionInterval = 8;
+// Messages sent uncompressed before the fastest level is tried again.
+const size_t kProbeInterval = 256;
+// Each level is roughly this much slower than the one below it, so the
+// compressor must outpace the link by that much before the level goes up.
+const double kStepUpHeadroom = 2;
+
+void Smooth(double* average, double sample) {
+  *average =
+      *average == 0 ? sample : *average + kSmoothing * (sample - *average);
+}
+
+}  // namespace
+
+AdaptiveCompressionController::AdaptiveCompressionController(
+    int initial_level) {
+  static_assert(GPR_ARRAY_SIZE(kLevels) == kNumSteps, "one level per step");
+  step_ = 1;
+  for (size_t i = 2; i < kNumSteps; i++) {
+    if (abs(kLevels[i] - initial_level) < abs(kLevels[step_] - initial_level)) {
+      step_ = i;
+    }
+  }
+}
+
+int AdaptiveCompressionController::NextLevel() {
+  MutexLock lock(&mu_);
+  if (step_ == 0 && ++messages_at_step_ >= kProbeInterval) {
+    step_ = 1;
+    messages_at_step_ = 0;
+  }
+  return kLevels[step_];
+}
+
+void AdaptiveCompressionController::RecordCompression(int level,
+                                                      size_t input_bytes,
+                                                      size_t output_bytes,
+                                                      double seconds) {
+  if (input_bytes == 0 || seconds <= 0) return;
+  MutexLock lock(&mu_);
+  for (size_t i = 1; i < kNumSteps; i++) {
+    if (kLevels[i] != level) continue;
+    Smooth(&stats_[i].input_bytes, input_bytes);
+    Smooth(&stats_[i].output_bytes, output_bytes);
+    Smooth(&stats_[i].seconds, seconds);
+    if (i == step_ && ++messages_at_step_ >= kDecisionInterval) {
+      messages_at_step_ = 0;
+      MaybeChangeStepLocked();
+    }
+    return;
+  }
+}
+
+void AdaptiveCompressionController::RecordTransmission(size_t wire_bytes,
+                                                       double seconds) {
+  if (wire_bytes == 0 || seconds <= 0) return;
+  MutexLock lock(&mu_);
+  Smooth(&link_bytes_, wire_bytes);
+  Smooth(&link_seconds_, seconds);
+}
+
+void AdaptiveCompressionController::MaybeChangeStepLocked() {
+  if (link_seconds_ == 0) return;
+  const double link_speed = link_bytes_ / link_seconds_;
+  // Input bytes per second that the compressor produces at a step, and that
+  // the link carries once compressed at that step.
+  auto compress_speed = [this](size_t step) {
+    return stats_[step].input_bytes / stats_[step].seconds;
+  };
+  auto drain_speed = [this, link_speed](size_t step) {
+    return link_speed * stats_[step].input_bytes /
+           GPR_MAX(stats_[step].output_bytes, 1.0);
+  };
+  if (compress_speed(step_) < drain_speed(step_)) {
+    // CPU-bound. From the fastest level, only stop compressing if sending the
+    // raw bytes is faster than compressing them.
+    if (step_ > 1 || compress_speed(step_) < link_speed) {
+      --step_;
+      messages_at_step_ = 0;
+    }
+  } else if (compress_speed(step_) > kStepUpHeadroom * drain_speed(step_) &&
+             step_ + 1 < kNumSteps) {
+    // Bandwidth-limited, unless the next level was already found to be too
+    // slow for the link.
+    const size_t next = step_ + 1;
+    if (stats_[next].seconds == 0 ||
+        compress_speed(next) >= drain_speed(next)) {
+      step_ = next;
+    }
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,89 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_COMPRESSION_ADAPTIVE_COMPRESSION_H
+#define GRPC_CORE_LIB_COMPRESSION_ADAPTIVE_COMPRESSION_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// Picks the zstd level of the messages sent on a connection at run time.
+//
+// The controller compares how fast messages are compressed with how fast the
+// connection drains them. When the compressor outpaces the link by a wide
+// margin, the connection is bandwidth-limited and a higher level saves more
+// than it costs; when the link outpaces the compressor, compression is the
+// bottleneck and the level goes down, to no compression at all if even the
+// fastest level is slower than sending the bytes as they are. While messages
+// are sent uncompressed, the fastest level is retried every so often to
+// refresh its measurements.
+//
+// Thread safe: one controller is shared by all the calls of a connection.
+class AdaptiveCompressionController {
+ public:
+  // Returned by NextLevel() when messages are best sent uncompressed.
+  static constexpr int kUncompressed = -1000;
+
+  // Starts at the ladder step closest to initial_level.
+  explicit AdaptiveCompressionController(int initial_level);
+
+  // Returns the zstd level to compress the next message at, or kUncompressed.
+  int NextLevel();
+
+  // Records that input_bytes were compressed at level into output_bytes in
+  // the given number of seconds.
+  void RecordCompression(int level, size_t input_bytes, size_t output_bytes,
+                         double seconds);
+
+  // Records that wire_bytes took the given number of seconds from being
+  // handed to the transport until the transport reported them written.
+  void RecordTransmission(size_t wire_bytes, double seconds);
+
+ private:
+  // Moving averages of message sizes and times. Speeds are computed from the
+  // averaged totals so that large messages weigh more than small ones.
+  struct StepStats {
+    double input_bytes = 0;
+    double output_bytes = 0;
+    double seconds = 0;
+  };
+
+  // Uncompressed, then zstd levels from fastest to strongest.
+  static constexpr size_t kNumSteps = 7;
+
+  void MaybeChangeStepLocked();
+
+  Mutex mu_;
+  size_t step_;
+  // Messages compressed at the current step since the last decision, or sent
+  // uncompressed since the last probe.
+  size_t messages_at_step_ = 0;
+  // Moving averages of the transmitted messages.
+  double link_bytes_ = 0;
+  double link_seconds_ = 0;
+  StepStats stats_[kNumSteps];
+};
+
+}  // namespace grpc_core
+
+#endif /* GRPC_CORE_LIB_COMPRESSION_ADAPTIVE_COMPRESSION_H */
@@ -32,7 +32,9 @@
 
 int grpc_compression_algorithm_is_message(
     grpc_compression_algorithm algorithm) {
-  return (algorithm >= GRPC_COMPRESS_DEFLATE && algorithm <= GRPC_COMPRESS_ZSTD)
+  return ((algorithm >= GRPC_COMPRESS_DEFLATE &&
+           algorithm <= GRPC_COMPRESS_ZSTD) ||
+          algorithm == GRPC_COMPRESS_LZ4)
              ? 1
              : 0;
 }
@@ -55,6 +57,9 @@ int grpc_compression_algorithm_parse(grpc_slice name,
   } else if (grpc_slice_eq_static_interned(name, GRPC_MDSTR_ZSTD)) {
     *algorithm = GRPC_COMPRESS_ZSTD;
     return 1;
+  } else if (grpc_slice_eq_static_interned(name, GRPC_MDSTR_LZ4)) {
+    *algorithm = GRPC_COMPRESS_LZ4;
+    return 1;
   } else if (grpc_slice_eq_static_interned(name,
                                            GRPC_MDSTR_STREAM_SLASH_GZIP)) {
     *algorithm = GRPC_COMPRESS_STREAM_GZIP;
@@ -85,6 +90,9 @@ int grpc_compression_algorithm_name(grpc_compression_algorithm algorithm,
     case GRPC_COMPRESS_ZSTD:
       *name = "zstd";
       return 1;
+    case GRPC_COMPRESS_LZ4:
+      *name = "lz4";
+      return 1;
     case GRPC_COMPRESS_STREAM_GZIP:
       *name = "stream/gzip";
       return 1;
@@ -155,6 +163,8 @@ grpc_slice grpc_compression_algorithm_slice(
       return GRPC_MDSTR_GZIP;
     case GRPC_COMPRESS_ZSTD:
       return GRPC_MDSTR_ZSTD;
+    case GRPC_COMPRESS_LZ4:
+      return GRPC_MDSTR_LZ4;
     case GRPC_COMPRESS_STREAM_GZIP:
       return GRPC_MDSTR_STREAM_SLASH_GZIP;
     case GRPC_COMPRESS_STREAM_ZSTD:
@@ -175,6 +185,8 @@ grpc_compression_algorithm grpc_compression_algorithm_from_slice(
     return GRPC_COMPRESS_GZIP;
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_ZSTD))
     return GRPC_COMPRESS_ZSTD;
+  if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_LZ4))
+    return GRPC_COMPRESS_LZ4;
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_STREAM_SLASH_GZIP))
     return GRPC_COMPRESS_STREAM_GZIP;
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_STREAM_SLASH_ZSTD))
@@ -193,6 +205,8 @@ grpc_mdelem grpc_compression_encoding_mdelem(
       return GRPC_MDELEM_GRPC_ENCODING_GZIP;
     case GRPC_COMPRESS_ZSTD:
       return GRPC_MDELEM_GRPC_ENCODING_ZSTD;
+    case GRPC_COMPRESS_LZ4:
+      return GRPC_MDELEM_GRPC_ENCODING_LZ4;
     case GRPC_COMPRESS_STREAM_GZIP:
       return GRPC_MDELEM_GRPC_ENCODING_GZIP;
     case GRPC_COMPRESS_STREAM_ZSTD:
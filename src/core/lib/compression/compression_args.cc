@@ -132,3 +132,11 @@ uint32_t grpc_channel_args_compression_algorithm_get_states(
     return (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1; /* All algs. enabled */
   }
 }
+
+int grpc_channel_args_compression_zstd_window_log_max(
+    const grpc_channel_args* a) {
+  const int window_log_max = grpc_channel_args_find_integer(
+      a, GRPC_COMPRESSION_CHANNEL_ZSTD_WINDOW_LOG_MAX, {0, 0, 27});
+  /* zstd's smallest window is 1 KB */
+  return window_log_max == 0 ? 0 : GPR_MAX(window_log_max, 10);
+}
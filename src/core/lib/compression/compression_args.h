@@ -53,4 +53,10 @@ grpc_channel_args* grpc_channel_args_compression_algorithm_set_state(
 uint32_t grpc_channel_args_compression_algorithm_get_states(
     const grpc_channel_args* a);
 
+/** Returns the zstd window log cap set in \a a with
+ * GRPC_COMPRESSION_CHANNEL_ZSTD_WINDOW_LOG_MAX, raised to zstd's smallest
+ * window log, or 0 if there is none. */
+int grpc_channel_args_compression_zstd_window_log_max(
+    const grpc_channel_args* a);
+
 #endif /* GRPC_CORE_LIB_COMPRESSION_COMPRESSION_ARGS_H */
@@ -18,6 +18,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -25,6 +26,7 @@
 
 #include "src/core/lib/compression/algorithm_metadata.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/slice/slice_utils.h"
 #include "src/core/lib/surface/api_trace.h"
@@ -40,8 +42,10 @@ grpc_message_compression_algorithm_from_slice(const grpc_slice& str) {
     return GRPC_MESSAGE_COMPRESS_DEFLATE;
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_GZIP))
     return GRPC_MESSAGE_COMPRESS_GZIP;
-	if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_ZSTD))
-		return GRPC_MESSAGE_COMPRESS_ZSTD;
+  if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_ZSTD))
+    return GRPC_MESSAGE_COMPRESS_ZSTD;
+  if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_LZ4))
+    return GRPC_MESSAGE_COMPRESS_LZ4;
   return GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT;
 }
 
@@ -51,8 +55,8 @@ grpc_stream_compression_algorithm grpc_stream_compression_algorithm_from_slice(
     return GRPC_STREAM_COMPRESS_NONE;
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_GZIP))
     return GRPC_STREAM_COMPRESS_GZIP;
-	if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_ZSTD))
-		return GRPC_STREAM_COMPRESS_ZSTD;
+  if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_ZSTD))
+    return GRPC_STREAM_COMPRESS_ZSTD;
   return GRPC_STREAM_COMPRESS_ALGORITHMS_COUNT;
 }
 
@@ -67,6 +71,8 @@ grpc_mdelem grpc_message_compression_encoding_mdelem(
       return GRPC_MDELEM_GRPC_ENCODING_GZIP;
     case GRPC_MESSAGE_COMPRESS_ZSTD:
       return GRPC_MDELEM_GRPC_ENCODING_ZSTD;
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      return GRPC_MDELEM_GRPC_ENCODING_LZ4;
     default:
       break;
   }
@@ -80,8 +86,8 @@ grpc_mdelem grpc_stream_compression_encoding_mdelem(
       return GRPC_MDELEM_CONTENT_ENCODING_IDENTITY;
     case GRPC_STREAM_COMPRESS_GZIP:
       return GRPC_MDELEM_CONTENT_ENCODING_GZIP;
-		case GRPC_STREAM_COMPRESS_ZSTD:
-			return GRPC_MDELEM_CONTENT_ENCODING_ZSTD;
+    case GRPC_STREAM_COMPRESS_ZSTD:
+      return GRPC_MDELEM_CONTENT_ENCODING_ZSTD;
     default:
       break;
   }
@@ -100,6 +106,8 @@ grpc_compression_algorithm_to_message_compression_algorithm(
       return GRPC_MESSAGE_COMPRESS_GZIP;
     case GRPC_COMPRESS_ZSTD:
       return GRPC_MESSAGE_COMPRESS_ZSTD;
+    case GRPC_COMPRESS_LZ4:
+      return GRPC_MESSAGE_COMPRESS_LZ4;
     default:
       return GRPC_MESSAGE_COMPRESS_NONE;
   }
@@ -118,24 +126,65 @@ grpc_compression_algorithm_to_stream_compression_algorithm(
   }
 }
 
+/* The bits of grpc_compression_algorithm do not split into a message and a
+ * stream range (GRPC_COMPRESS_LZ4 follows the stream algorithms), so the
+ * bitsets are converted one algorithm at a time. */
 uint32_t grpc_compression_bitset_to_message_bitset(uint32_t bitset) {
-  return bitset & ((1u << GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT) - 1);
+  uint32_t message_bitset = 0;
+  for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    grpc_compression_algorithm algorithm =
+        static_cast<grpc_compression_algorithm>(i);
+    if (GPR_BITGET(bitset, i) &&
+        (algorithm == GRPC_COMPRESS_NONE ||
+         grpc_compression_algorithm_is_message(algorithm))) {
+      GPR_BITSET(&message_bitset,
+                 grpc_compression_algorithm_to_message_compression_algorithm(
+                     algorithm));
+    }
+  }
+  return message_bitset;
 }
 
 uint32_t grpc_compression_bitset_to_stream_bitset(uint32_t bitset) {
-  uint32_t identity = (bitset & 1u);
-  uint32_t other_bits =
-      (bitset >> (GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT - 1)) &
-      ((1u << GRPC_STREAM_COMPRESS_ALGORITHMS_COUNT) - 2);
-  return identity | other_bits;
+  uint32_t stream_bitset = 0;
+  for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    grpc_compression_algorithm algorithm =
+        static_cast<grpc_compression_algorithm>(i);
+    if (GPR_BITGET(bitset, i) &&
+        (algorithm == GRPC_COMPRESS_NONE ||
+         grpc_compression_algorithm_is_stream(algorithm))) {
+      GPR_BITSET(&stream_bitset,
+                 grpc_compression_algorithm_to_stream_compression_algorithm(
+                     algorithm));
+    }
+  }
+  return stream_bitset;
 }
 
 uint32_t grpc_compression_bitset_from_message_stream_compression_bitset(
     uint32_t message_bitset, uint32_t stream_bitset) {
-  uint32_t offset_stream_bitset =
-      (stream_bitset & 1u) |
-      ((stream_bitset & (~1u)) << (GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT - 1));
-  return message_bitset | offset_stream_bitset;
+  uint32_t bitset = 0;
+  for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    grpc_compression_algorithm algorithm =
+        static_cast<grpc_compression_algorithm>(i);
+    int enabled;
+    if (algorithm == GRPC_COMPRESS_NONE) {
+      enabled = GPR_BITGET(message_bitset, GRPC_MESSAGE_COMPRESS_NONE) ||
+                GPR_BITGET(stream_bitset, GRPC_STREAM_COMPRESS_NONE);
+    } else if (grpc_compression_algorithm_is_message(algorithm)) {
+      enabled = GPR_BITGET(
+          message_bitset,
+          grpc_compression_algorithm_to_message_compression_algorithm(
+              algorithm));
+    } else {
+      enabled = GPR_BITGET(
+          stream_bitset,
+          grpc_compression_algorithm_to_stream_compression_algorithm(
+              algorithm));
+    }
+    if (enabled) GPR_BITSET(&bitset, i);
+  }
+  return bitset;
 }
 
 int grpc_compression_algorithm_from_message_stream_compression_algorithm(
@@ -155,9 +204,9 @@ int grpc_compression_algorithm_from_message_stream_compression_algorithm(
       case GRPC_STREAM_COMPRESS_GZIP:
         *algorithm = GRPC_COMPRESS_STREAM_GZIP;
         return 1;
-			case GRPC_STREAM_COMPRESS_ZSTD:
-				*algorithm = GRPC_COMPRESS_STREAM_ZSTD;
-				return 1;
+      case GRPC_STREAM_COMPRESS_ZSTD:
+        *algorithm = GRPC_COMPRESS_STREAM_ZSTD;
+        return 1;
       default:
         *algorithm = GRPC_COMPRESS_NONE;
         return 0;
@@ -176,6 +225,9 @@ int grpc_compression_algorithm_from_message_stream_compression_algorithm(
       case GRPC_MESSAGE_COMPRESS_ZSTD:
         *algorithm = GRPC_COMPRESS_ZSTD;
         return 1;
+      case GRPC_MESSAGE_COMPRESS_LZ4:
+        *algorithm = GRPC_COMPRESS_LZ4;
+        return 1;
       default:
         *algorithm = GRPC_COMPRESS_NONE;
         return 0;
@@ -204,6 +256,9 @@ int grpc_message_compression_algorithm_name(
     case GRPC_MESSAGE_COMPRESS_ZSTD:
       *name = "zstd";
       return 1;
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      *name = "lz4";
+      return 1;
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       return 0;
   }
@@ -230,12 +285,20 @@ grpc_message_compression_algorithm grpc_message_compression_algorithm_for_level(
 
   GPR_ASSERT(level > 0);
 
+  /* zstd beats the zlib based algorithms on both speed and ratio at every
+   * level, so when the peer accepts it the level only selects how hard zstd
+   * works (see grpc_compression_level_to_zstd_level). */
+  if (GPR_BITGET(accepted_encodings, GRPC_MESSAGE_COMPRESS_ZSTD) == 1) {
+    return GRPC_MESSAGE_COMPRESS_ZSTD;
+  }
+
   /* Establish a "ranking" or compression algorithms in increasing order of
    * compression.
    * This is simplistic and we will probably want to introduce other dimensions
    * in the future (cpu/memory cost, etc). */
   const grpc_message_compression_algorithm algos_ranking[] = {
-      GRPC_MESSAGE_COMPRESS_GZIP, GRPC_MESSAGE_COMPRESS_ZSTD, GRPC_MESSAGE_COMPRESS_DEFLATE};
+      GRPC_MESSAGE_COMPRESS_LZ4, GRPC_MESSAGE_COMPRESS_GZIP,
+      GRPC_MESSAGE_COMPRESS_DEFLATE};
 
   /* intersect algos_ranking with the supported ones keeping the ranked order */
   grpc_message_compression_algorithm
@@ -281,12 +344,45 @@ int grpc_message_compression_algorithm_parse(
   } else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_ZSTD)) {
     *algorithm = GRPC_MESSAGE_COMPRESS_ZSTD;
     return 1;
+  } else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_LZ4)) {
+    *algorithm = GRPC_MESSAGE_COMPRESS_LZ4;
+    return 1;
   } else {
     return 0;
   }
   return 0;
 }
 
+int grpc_compression_level_to_zstd_level(grpc_compression_level level) {
+  switch (level) {
+    case GRPC_COMPRESS_LEVEL_LOW:
+      return 1;
+    case GRPC_COMPRESS_LEVEL_HIGH:
+      return 9;
+    default:
+      return GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL;
+  }
+}
+
+int grpc_zstd_compression_level_parse(grpc_slice value, int* level) {
+  const char* data =
+      reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(value));
+  size_t length = GRPC_SLICE_LENGTH(value);
+  const bool negative = length > 0 && data[0] == '-';
+  if (negative) {
+    data++;
+    length--;
+  }
+  uint32_t magnitude;
+  if (!gpr_parse_bytes_to_uint32(data, length, &magnitude) ||
+      magnitude > INT_MAX) {
+    return 0;
+  }
+  *level =
+      negative ? -static_cast<int>(magnitude) : static_cast<int>(magnitude);
+  return 1;
+}
+
 /* Interfaces for stream compression. */
 
 int grpc_stream_compression_algorithm_parse(
@@ -297,11 +393,10 @@ int grpc_stream_compression_algorithm_parse(
   } else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_GZIP)) {
     *algorithm = GRPC_STREAM_COMPRESS_GZIP;
     return 1;
-	}
-	else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_ZSTD)) {
-		*algorithm = GRPC_STREAM_COMPRESS_ZSTD;
-		return 1;
-	}else {
+  } else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_ZSTD)) {
+    *algorithm = GRPC_STREAM_COMPRESS_ZSTD;
+    return 1;
+  } else {
     return 0;
   }
   return 0;
@@ -33,7 +33,7 @@ typedef enum {
   GRPC_MESSAGE_COMPRESS_DEFLATE,
   GRPC_MESSAGE_COMPRESS_GZIP,
   GRPC_MESSAGE_COMPRESS_ZSTD,
-  /* TODO(ctiller): snappy */
+  GRPC_MESSAGE_COMPRESS_LZ4,
   GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT
 } grpc_message_compression_algorithm;
 
@@ -79,6 +79,13 @@ grpc_message_compression_algorithm grpc_message_compression_algorithm_for_level(
 int grpc_message_compression_algorithm_parse(
     grpc_slice value, grpc_message_compression_algorithm* algorithm);
 
+/* Returns the zstd level implied by the abstract compression \a level. */
+int grpc_compression_level_to_zstd_level(grpc_compression_level level);
+
+/* Parses a zstd level, as carried by the metadata key
+ * GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY. Returns 1 on success. */
+int grpc_zstd_compression_level_parse(grpc_slice value, int* level);
+
 /* Interfaces for stream compression. */
 
 int grpc_stream_compression_algorithm_parse(
@@ -0,0 +1,332 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/compression/context_pool.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/atm.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace {
+
+// Idle contexts retained per pool. Contexts released to a full pool are freed,
+// which bounds the memory held after a burst of concurrent calls.
+constexpr size_t kMaxIdleContexts = 64;
+
+// Contexts that grew larger than this, by compressing with a large window or
+// at a high level, are freed on release rather than held while idle.
+constexpr size_t kMaxIdleContextSize = 8 * 1024 * 1024;
+
+void* zalloc_gpr(void* /*opaque*/, unsigned int items, unsigned int size) {
+  return gpr_malloc(items * size);
+}
+
+void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
+
+z_stream* new_z_stream() {
+  z_stream* zs = static_cast<z_stream*>(gpr_zalloc(sizeof(*zs)));
+  zs->zalloc = zalloc_gpr;
+  zs->zfree = zfree_gpr;
+  return zs;
+}
+
+struct ZstdCompressTraits {
+  typedef ZSTD_CCtx Context;
+  static ZSTD_CCtx* Create(int /*arg*/) {
+    ZSTD_CCtx* cctx = ZSTD_createCCtx();
+    GPR_ASSERT(cctx != nullptr);
+    return cctx;
+  }
+  static bool Reset(ZSTD_CCtx* cctx) {
+    return !ZSTD_isError(
+        ZSTD_CCtx_reset(cctx, ZSTD_reset_session_and_parameters));
+  }
+  static size_t Size(const ZSTD_CCtx* cctx) { return ZSTD_sizeof_CCtx(cctx); }
+  static void Destroy(ZSTD_CCtx* cctx) { ZSTD_freeCCtx(cctx); }
+};
+
+struct ZstdDecompressTraits {
+  typedef ZSTD_DCtx Context;
+  static ZSTD_DCtx* Create(int /*arg*/) {
+    ZSTD_DCtx* dctx = ZSTD_createDCtx();
+    GPR_ASSERT(dctx != nullptr);
+    return dctx;
+  }
+  static bool Reset(ZSTD_DCtx* dctx) {
+    return !ZSTD_isError(
+        ZSTD_DCtx_reset(dctx, ZSTD_reset_session_and_parameters));
+  }
+  static size_t Size(const ZSTD_DCtx* dctx) { return ZSTD_sizeof_DCtx(dctx); }
+  static void Destroy(ZSTD_DCtx* dctx) { ZSTD_freeDCtx(dctx); }
+};
+
+struct Lz4CompressTraits {
+  typedef LZ4F_cctx Context;
+  static LZ4F_cctx* Create(int /*arg*/) {
+    LZ4F_cctx* cctx;
+    GPR_ASSERT(
+        !LZ4F_isError(LZ4F_createCompressionContext(&cctx, LZ4F_VERSION)));
+    return cctx;
+  }
+  // Every frame starts with LZ4F_compressBegin(), which resets the context.
+  static bool Reset(LZ4F_cctx* /*cctx*/) { return true; }
+  // Its buffers are sized for the 64 KB blocks that gRPC compresses with.
+  static size_t Size(const LZ4F_cctx* /*cctx*/) { return 0; }
+  static void Destroy(LZ4F_cctx* cctx) { LZ4F_freeCompressionContext(cctx); }
+};
+
+struct Lz4DecompressTraits {
+  typedef LZ4F_dctx Context;
+  static LZ4F_dctx* Create(int /*arg*/) {
+    LZ4F_dctx* dctx;
+    GPR_ASSERT(
+        !LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION)));
+    return dctx;
+  }
+  static bool Reset(LZ4F_dctx* dctx) {
+    LZ4F_resetDecompressionContext(dctx);
+    return true;
+  }
+  static size_t Size(const LZ4F_dctx* /*dctx*/) { return 0; }
+  static void Destroy(LZ4F_dctx* dctx) { LZ4F_freeDecompressionContext(dctx); }
+};
+
+struct DeflateTraits {
+  typedef z_stream Context;
+  static z_stream* Create(int gzip) {
+    z_stream* zs = new_z_stream();
+    int r = deflateInit2(zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                         15 | (gzip ? 16 : 0), 8, Z_DEFAULT_STRATEGY);
+    GPR_ASSERT(r == Z_OK);
+    return zs;
+  }
+  static bool Reset(z_stream* zs) { return deflateReset(zs) == Z_OK; }
+  // zlib's window and tables do not grow.
+  static size_t Size(const z_stream* /*zs*/) { return 0; }
+  static void Destroy(z_stream* zs) {
+    deflateEnd(zs);
+    gpr_free(zs);
+  }
+};
+
+struct InflateTraits {
+  typedef z_stream Context;
+  static z_stream* Create(int gzip) {
+    z_stream* zs = new_z_stream();
+    int r = inflateInit2(zs, 15 | (gzip ? 16 : 0));
+    GPR_ASSERT(r == Z_OK);
+    return zs;
+  }
+  static bool Reset(z_stream* zs) { return inflateReset(zs) == Z_OK; }
+  static size_t Size(const z_stream* /*zs*/) { return 0; }
+  static void Destroy(z_stream* zs) {
+    inflateEnd(zs);
+    gpr_free(zs);
+  }
+};
+
+// A bounded free list of contexts shared by all threads. The lock is only
+// held to push or pop a pointer; creation and reset happen outside of it.
+template <typename Traits>
+class ContextPool {
+ public:
+  typedef typename Traits::Context Context;
+
+  explicit ContextPool(int create_arg = 0) : create_arg_(create_arg) {}
+
+  ~ContextPool() { Drain(); }
+
+  ContextPool(const ContextPool&) = delete;
+  ContextPool& operator=(const ContextPool&) = delete;
+
+  Context* Acquire() {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      if (num_idle_ > 0) return idle_[--num_idle_];
+    }
+    return Traits::Create(create_arg_);
+  }
+
+  void Release(Context* ctx) {
+    // A context that cannot be reset is in an undefined state: never reuse it.
+    if (Traits::Size(ctx) <= kMaxIdleContextSize && Traits::Reset(ctx)) {
+      grpc_core::MutexLock lock(&mu_);
+      if (num_idle_ < kMaxIdleContexts) {
+        idle_[num_idle_++] = ctx;
+        return;
+      }
+    }
+    Traits::Destroy(ctx);
+  }
+
+  // Frees the idle contexts.
+  void Drain() {
+    Context* idle[kMaxIdleContexts];
+    size_t num_idle;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      num_idle = num_idle_;
+      for (size_t i = 0; i < num_idle; i++) {
+        idle[i] = idle_[i];
+      }
+      num_idle_ = 0;
+    }
+    for (size_t i = 0; i < num_idle; i++) {
+      Traits::Destroy(idle[i]);
+    }
+  }
+
+ private:
+  const int create_arg_;
+  grpc_core::Mutex mu_;
+  Context* idle_[kMaxIdleContexts];
+  size_t num_idle_ = 0;
+};
+
+struct ContextPools {
+  void Drain() {
+    zstd_cctx.Drain();
+    zstd_dctx.Drain();
+    lz4_cctx.Drain();
+    lz4_dctx.Drain();
+    deflate.Drain();
+    deflate_gzip.Drain();
+    inflate.Drain();
+    inflate_gzip.Drain();
+  }
+
+  ContextPool<ZstdCompressTraits> zstd_cctx;
+  ContextPool<ZstdDecompressTraits> zstd_dctx;
+  ContextPool<Lz4CompressTraits> lz4_cctx;
+  ContextPool<Lz4DecompressTraits> lz4_dctx;
+  ContextPool<DeflateTraits> deflate{0};
+  ContextPool<DeflateTraits> deflate_gzip{1};
+  ContextPool<InflateTraits> inflate{0};
+  ContextPool<InflateTraits> inflate_gzip{1};
+};
+
+// Created by the first grpc_init() and never destroyed, so that threads still
+// compressing after grpc_shutdown() can release their contexts; shutting down
+// only frees the idle contexts. Holds a ContextPools*.
+gpr_atm g_pools = 0;
+
+ContextPools* pools() {
+  return reinterpret_cast<ContextPools*>(gpr_atm_acq_load(&g_pools));
+}
+
+// Before the first grpc_init() there are no pools: contexts are still usable,
+// they are simply created and destroyed on every use.
+template <typename Traits>
+typename Traits::Context* acquire(ContextPool<Traits>* pool, int create_arg) {
+  return pool == nullptr ? Traits::Create(create_arg) : pool->Acquire();
+}
+
+template <typename Traits>
+void release(ContextPool<Traits>* pool, typename Traits::Context* ctx) {
+  if (pool == nullptr) {
+    Traits::Destroy(ctx);
+  } else {
+    pool->Release(ctx);
+  }
+}
+
+ContextPool<ZstdCompressTraits>* zstd_cctx_pool() {
+  ContextPools* p = pools();
+  return p == nullptr ? nullptr : &p->zstd_cctx;
+}
+
+ContextPool<ZstdDecompressTraits>* zstd_dctx_pool() {
+  ContextPools* p = pools();
+  return p == nullptr ? nullptr : &p->zstd_dctx;
+}
+
+ContextPool<Lz4CompressTraits>* lz4_cctx_pool() {
+  ContextPools* p = pools();
+  return p == nullptr ? nullptr : &p->lz4_cctx;
+}
+
+ContextPool<Lz4DecompressTraits>* lz4_dctx_pool() {
+  ContextPools* p = pools();
+  return p == nullptr ? nullptr : &p->lz4_dctx;
+}
+
+ContextPool<DeflateTraits>* deflate_pool(int gzip) {
+  ContextPools* p = pools();
+  if (p == nullptr) return nullptr;
+  return gzip ? &p->deflate_gzip : &p->deflate;
+}
+
+ContextPool<InflateTraits>* inflate_pool(int gzip) {
+  ContextPools* p = pools();
+  if (p == nullptr) return nullptr;
+  return gzip ? &p->inflate_gzip : &p->inflate;
+}
+
+}  // namespace
+
+void grpc_compression_context_pools_init(void) {
+  // grpc_init() calls are serialized, so the pools are only created once.
+  if (pools() == nullptr) {
+    gpr_atm_rel_store(&g_pools, reinterpret_cast<gpr_atm>(new ContextPools()));
+  }
+}
+
+void grpc_compression_context_pools_shutdown(void) {
+  ContextPools* p = pools();
+  if (p != nullptr) p->Drain();
+}
+
+ZSTD_CCtx* grpc_zstd_cctx_acquire(void) { return acquire(zstd_cctx_pool(), 0); }
+
+void grpc_zstd_cctx_release(ZSTD_CCtx* cctx) {
+  release(zstd_cctx_pool(), cctx);
+}
+
+ZSTD_DCtx* grpc_zstd_dctx_acquire(void) { return acquire(zstd_dctx_pool(), 0); }
+
+void grpc_zstd_dctx_release(ZSTD_DCtx* dctx) {
+  release(zstd_dctx_pool(), dctx);
+}
+
+LZ4F_cctx* grpc_lz4_cctx_acquire(void) { return acquire(lz4_cctx_pool(), 0); }
+
+void grpc_lz4_cctx_release(LZ4F_cctx* cctx) { release(lz4_cctx_pool(), cctx); }
+
+LZ4F_dctx* grpc_lz4_dctx_acquire(void) { return acquire(lz4_dctx_pool(), 0); }
+
+void grpc_lz4_dctx_release(LZ4F_dctx* dctx) { release(lz4_dctx_pool(), dctx); }
+
+z_stream* grpc_deflate_stream_acquire(int gzip) {
+  return acquire(deflate_pool(gzip), gzip);
+}
+
+void grpc_deflate_stream_release(z_stream* zs, int gzip) {
+  release(deflate_pool(gzip), zs);
+}
+
+z_stream* grpc_inflate_stream_acquire(int gzip) {
+  return acquire(inflate_pool(gzip), gzip);
+}
+
+void grpc_inflate_stream_release(z_stream* zs, int gzip) {
+  release(inflate_pool(gzip), zs);
+}
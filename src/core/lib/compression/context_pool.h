@@ -0,0 +1,63 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_COMPRESSION_CONTEXT_POOL_H
+#define GRPC_CORE_LIB_COMPRESSION_CONTEXT_POOL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <lz4frame.h>
+#include <zlib.h>
+#include <zstd.h>
+
+/* Process-wide pools of compression and decompression contexts.
+ *
+ * Creating a context allocates (and for zstd, zeroes) its whole workspace,
+ * which costs more than compressing a small message. Contexts are therefore
+ * reset and recycled across messages. Every acquire function returns a context
+ * in its freshly initialized state, and never returns NULL. Contexts must be
+ * released to the pool they came from. Contexts grown past a few megabytes by
+ * a large zstd window are freed on release rather than pooled.
+ *
+ * The pools are created by the first grpc_init() and live for the rest of the
+ * process, so contexts may be acquired and released at any time.
+ * grpc_shutdown() only frees the idle contexts. */
+
+void grpc_compression_context_pools_init(void);
+void grpc_compression_context_pools_shutdown(void);
+
+ZSTD_CCtx* grpc_zstd_cctx_acquire(void);
+void grpc_zstd_cctx_release(ZSTD_CCtx* cctx);
+
+ZSTD_DCtx* grpc_zstd_dctx_acquire(void);
+void grpc_zstd_dctx_release(ZSTD_DCtx* dctx);
+
+LZ4F_cctx* grpc_lz4_cctx_acquire(void);
+void grpc_lz4_cctx_release(LZ4F_cctx* cctx);
+
+LZ4F_dctx* grpc_lz4_dctx_acquire(void);
+void grpc_lz4_dctx_release(LZ4F_dctx* dctx);
+
+/* 'gzip' selects the gzip wrapper instead of the raw zlib (deflate) one. */
+z_stream* grpc_deflate_stream_acquire(int gzip);
+void grpc_deflate_stream_release(z_stream* zs, int gzip);
+
+z_stream* grpc_inflate_stream_acquire(int gzip);
+void grpc_inflate_stream_release(z_stream* zs, int gzip);
+
+#endif /* GRPC_CORE_LIB_COMPRESSION_CONTEXT_POOL_H */
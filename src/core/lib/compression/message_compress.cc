@@ -20,24 +20,35 @@
 
 #include "src/core/lib/compression/message_compress.h"
 
+#include <inttypes.h>
 #include <string.h>
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include <lz4frame.h>
 #include <zlib.h>
 #include <zstd.h>
+#include <zstd_errors.h>
 
+#include "src/core/lib/compression/context_pool.h"
+#include "src/core/lib/compression/zstd_dictionary.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/slice/slice_internal.h"
 
 #define OUTPUT_BLOCK_SIZE 1024
 
+/* Returns 1 on success, 0 on failure, and -1 as soon as the output exceeds
+ * 'max_output_length' bytes. */
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     int (*flate)(z_stream* zs, int flush),
+                     size_t max_output_length) {
   int r;
   int flush;
   size_t i;
+  const size_t length_before = output->length;
   grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
   const uInt uint_max = ~static_cast<uInt>(0);
 
@@ -63,6 +74,12 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
         gpr_log(GPR_INFO, "zlib error (%d)", r);
         goto error;
       }
+      if (output->length - length_before + GRPC_SLICE_LENGTH(outbuf) -
+              zs->avail_out >
+          max_output_length) {
+        grpc_slice_unref_internal(outbuf);
+        return -1;
+      }
     } while (zs->avail_out == 0);
     if (zs->avail_in) {
       gpr_log(GPR_INFO, "zlib: not all input consumed");
@@ -81,27 +98,15 @@ error:
   return 0;
 }
 
-static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
-                        unsigned int size) {
-  return gpr_malloc(items * size);
-}
-
-static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
-
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
                          int gzip) {
-  z_stream zs;
+  z_stream* zs = grpc_deflate_stream_acquire(gzip);
   int r;
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
+  r = zlib_body(zs, input, output, deflate, SIZE_MAX) &&
+      output->length < input->length;
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_slice_unref_internal(output->slices[i]);
@@ -109,208 +114,527 @@ static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
     output->count = count_before;
     output->length = length_before;
   }
-  deflateEnd(&zs);
+  grpc_deflate_stream_release(zs, gzip);
   return r;
 }
 
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                           int gzip) {
-  z_stream zs;
+                           int gzip, size_t max_output_length) {
+  z_stream* zs = grpc_inflate_stream_acquire(gzip);
   int r;
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
-  if (!r) {
+  r = zlib_body(zs, input, output, inflate, max_output_length);
+  if (r != 1) {
     for (i = count_before; i < output->count; i++) {
       grpc_slice_unref_internal(output->slices[i]);
     }
     output->count = count_before;
     output->length = length_before;
   }
-  inflateEnd(&zs);
+  grpc_inflate_stream_release(zs, gzip);
   return r;
 }
 
-namespace zstd {
-
-	static int zstd_compress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
-		size_t count_before = output->count;
-		size_t length_before = output->length;
-		ZSTD_CStream* pStream = ZSTD_createCStream();
-		ZSTD_inBuffer   inBuffer;
-		ZSTD_outBuffer outBuffer;
-		size_t err = ZSTD_initCStream(pStream, 5);
-		if (ZSTD_isError(err) > 0) {
-			gpr_log(GPR_INFO, "zstd: initialize compress steram error :%s", ZSTD_getErrorName(err));
-			goto error2;
-		}
-		//initialize out buffer
-		grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
-		outBuffer.size = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
-		outBuffer.dst = GRPC_SLICE_START_PTR(outbuf);
-		outBuffer.pos = 0;
-		const uInt uint_max = ~static_cast<uInt>(0);
-		GPR_ASSERT(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
-		for (size_t i = 0; i < input->count; i++) {
-			GPR_ASSERT(GRPC_SLICE_LENGTH(input->slices[i]) <= uint_max);
-			//set zstd in buffer
-			inBuffer.src = GRPC_SLICE_START_PTR(input->slices[i]);
-			inBuffer.size = GRPC_SLICE_LENGTH(input->slices[i]);
-			inBuffer.pos = 0;
-			//compress
-			err = ZSTD_compressStream2(pStream, &outBuffer, &inBuffer, ZSTD_EndDirective::ZSTD_e_continue);
-			if (ZSTD_isError(err) > 0) {
-				gpr_log(GPR_INFO, "zstd: compress stream error :%s", ZSTD_getErrorName(err));
-				goto error1;
-			}
-			do
-			{
-				if (outBuffer.pos == outBuffer.size) {
-					//first add outbuf to output
-					grpc_slice_buffer_add_indexed(output, outbuf);
-					//need more out buffer
-					outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
-					outBuffer.size = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
-					outBuffer.dst = GRPC_SLICE_START_PTR(outbuf);
-					outBuffer.pos = 0;
-				}
-				//flush
-				err = ZSTD_compressStream2(pStream, &outBuffer, &inBuffer, ZSTD_EndDirective::ZSTD_e_flush);
-				if (ZSTD_isError(err) > 0) {
-					gpr_log(GPR_INFO, "zstd: compress flush all error  :%s", ZSTD_getErrorName(err));
-					goto error1;
-				}
-				if (outBuffer.pos < outBuffer.size) {
-					//all custom is flush
-					break;
-				}
-			} while (true);
-			//check all input consumed
-			if (inBuffer.pos != inBuffer.size) {
-				gpr_log(GPR_INFO, "zstd: not all input consumed");
-				goto error1;
-			}
-		}
-		//release zstd stream instance
-		err = ZSTD_freeCStream(pStream);
-		if (ZSTD_isError(err) > 0) {
-			gpr_log(GPR_INFO, "zstd: compress flush all error  :%s", ZSTD_getErrorName(err));
-			goto error1;
-		}
-
-		//the last outbuf maybe not full
-		GPR_ASSERT(outbuf.refcount);
-		outbuf.data.refcounted.length = outBuffer.pos;
-		grpc_slice_buffer_add_indexed(output, outbuf);
-		if (output->length > input->length){
-			goto error2;
-		}
-
-		return 1;
-
-	error1:
-		grpc_slice_unref_internal(outbuf);
-	error2:
-		err = ZSTD_freeCStream(pStream);
-		if (ZSTD_isError(err) > 0) {
-			gpr_log(GPR_INFO, "zstd: compress flush all error  :%s", ZSTD_getErrorName(err));
-		}
-		//clear slices
-		for (size_t i = count_before; i < output->count; i++) {
-			grpc_slice_unref_internal(output->slices[i]);
-		}
-		output->count = count_before;
-		output->length = length_before;
-		return 0;
-	}
-
-	static int zstd_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
-		size_t count_before = output->count;
-		size_t length_before = output->length;
-		ZSTD_DStream* pStream = ZSTD_createDStream();
-		ZSTD_inBuffer   inBuffer;
-		ZSTD_outBuffer outBuffer;
-		size_t err = ZSTD_initDStream(pStream);
-		if (ZSTD_isError(err) > 0) {
-			gpr_log(GPR_INFO, "zstd: initialize decompress steram error :%s", ZSTD_getErrorName(err));
-			goto error2;
-		}
-		grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
-		outBuffer.size = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
-		outBuffer.dst = GRPC_SLICE_START_PTR(outbuf);
-		outBuffer.pos = 0;
-		const uInt uint_max = ~static_cast<uInt>(0);
-		GPR_ASSERT(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
-		for (size_t i = 0; i < input->count; i++) {
-			GPR_ASSERT(GRPC_SLICE_LENGTH(input->slices[i]) <= uint_max);
-			//set zstd in buffer
-			inBuffer.src = GRPC_SLICE_START_PTR(input->slices[i]);
-			inBuffer.size = GRPC_SLICE_LENGTH(input->slices[i]);
-			inBuffer.pos = 0;
-			do
-			{
-				if (outBuffer.pos == outBuffer.size) {
-					//first add outbuf to output
-					grpc_slice_buffer_add_indexed(output, outbuf);
-					//need more out buffer
-					outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
-					outBuffer.size = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
-					outBuffer.dst = GRPC_SLICE_START_PTR(outbuf);
-					outBuffer.pos = 0;
-				}
-				//decompress and flush
-				err = ZSTD_decompressStream(pStream, &outBuffer, &inBuffer);
-				if (ZSTD_isError(err) > 0) {
-					gpr_log(GPR_INFO, "zstd: decompress stream error :%s", ZSTD_getErrorName(err));
-					goto error1;
-				}
-				if (outBuffer.pos < outBuffer.size) {
-					//all custom is flush
-					break;
-				}
-			} while (true);
-			//check all input consumed
-			if (inBuffer.pos != inBuffer.size) {
-				gpr_log(GPR_INFO, "zstd: not all input consumed");
-				goto error1;
-			}
-		}
-		//the last outbuf maybe not full
-		GPR_ASSERT(outbuf.refcount);
-		outbuf.data.refcounted.length = outBuffer.pos;
-		grpc_slice_buffer_add_indexed(output, outbuf);
-
-		//release zstd stream instance
-		err = ZSTD_freeDStream(pStream);
-		if (ZSTD_isError(err) > 0) {
-			gpr_log(GPR_INFO, "zstd: decompress flush all error  :%s", ZSTD_getErrorName(err));
-			goto error2;
-		}
-
-		return 1;
-
-  error1:
-		grpc_slice_unref_internal(outbuf); //must unrefrence
-	error2:
-		err = ZSTD_freeDStream(pStream);
-		if (ZSTD_isError(err) > 0) {
-			gpr_log(GPR_INFO, "zstd: decompress flush all error  :%s", ZSTD_getErrorName(err));
-		}
-		//clear slices
-		for (size_t i = count_before; i < output->count; i++) {
-			grpc_slice_unref_internal(output->slices[i]);
-		}
-		output->count = count_before;
-		output->length = length_before;
-
-		return 0;
-	}
+/* Largest zstd frame header; enough bytes to read the frame content size. */
+#define ZSTD_FRAME_HEADER_SIZE_MAX 18
+
+/* Content sizes declared by the peer are trusted for a single up front
+ * allocation only up to this many bytes, or this ratio of the compressed size.
+ * Larger claims are decoded incrementally, so that a tiny frame cannot make us
+ * allocate an arbitrary amount of memory. */
+#define MAX_PREALLOCATED_SIZE (4 * 1024 * 1024)
+#define MAX_PREALLOCATED_RATIO 1024
+
+/* Set once the zstd library has rejected ZSTD_c_nbWorkers. */
+static gpr_atm g_zstd_workers_unsupported;
+
+static void zstd_next_outbuf(grpc_slice* outbuf, ZSTD_outBuffer* out) {
+  *outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  out->dst = GRPC_SLICE_START_PTR(*outbuf);
+  out->size = GRPC_SLICE_LENGTH(*outbuf);
+  out->pos = 0;
+}
+
+/* Returns the first 'length' bytes of the malloced slice 'outbuf'. Slices
+ * that are mostly unused are copied into one of the right size rather than
+ * pinning the whole allocation for as long as the data is held. */
+static grpc_slice trim_outbuf(grpc_slice outbuf, size_t length) {
+  if (length > GRPC_SLICE_LENGTH(outbuf) / 2) {
+    outbuf.data.refcounted.length = length;
+    return outbuf;
+  }
+  grpc_slice exact = GRPC_SLICE_MALLOC(length);
+  memcpy(GRPC_SLICE_START_PTR(exact), GRPC_SLICE_START_PTR(outbuf), length);
+  grpc_slice_unref_internal(outbuf);
+  return exact;
+}
+
+/* Adds the first 'length' bytes of 'outbuf' (from grpc_slice_malloc_large) to
+ * 'output'. */
+static void zstd_add_outbuf(grpc_slice outbuf, size_t length,
+                            grpc_slice_buffer* output) {
+  grpc_slice_buffer_add_indexed(output, trim_outbuf(outbuf, length));
+}
+
+/* Compresses the whole message as one frame into one contiguous slice. The
+ * output is only useful if it is smaller than the input, so the slice is sized
+ * just below the input length: zstd then gives up as soon as the message turns
+ * out not to be compressible, rather than finishing the frame. The frame
+ * header records the content size, which lets the receiver decompress into a
+ * single slice as well. */
+static int zstd_compress_body(ZSTD_CCtx* cctx, grpc_slice_buffer* input,
+                              grpc_slice_buffer* output) {
+  if (input->length == 0) return 0;
+  grpc_slice outbuf = grpc_slice_malloc_large(input->length - 1);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf),
+                        0};
+  size_t r;
+  if (input->count == 1) {
+    r = ZSTD_compress2(cctx, out.dst, out.size,
+                       GRPC_SLICE_START_PTR(input->slices[0]),
+                       GRPC_SLICE_LENGTH(input->slices[0]));
+    if (!ZSTD_isError(r)) out.pos = r;
+  } else {
+    r = ZSTD_CCtx_setPledgedSrcSize(cctx, input->length);
+    for (size_t i = 0; i < input->count && !ZSTD_isError(r); i++) {
+      ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                          GRPC_SLICE_LENGTH(input->slices[i]), 0};
+      const bool last = i == input->count - 1;
+      bool done;
+      do {
+        r = ZSTD_compressStream2(cctx, &out, &in,
+                                 last ? ZSTD_e_end : ZSTD_e_continue);
+        /* ZSTD_e_end returns 0 once the frame is complete */
+        done = in.pos == in.size && (!last || r == 0);
+      } while (!ZSTD_isError(r) && !done && out.pos < out.size);
+      if (!ZSTD_isError(r) && !done) {
+        /* out of space: the message does not compress */
+        grpc_slice_unref_internal(outbuf);
+        return 0;
+      }
+    }
+  }
+  if (ZSTD_isError(r)) {
+    if (ZSTD_getErrorCode(r) != ZSTD_error_dstSize_tooSmall) {
+      gpr_log(GPR_INFO, "zstd error (%s)", ZSTD_getErrorName(r));
+    }
+    grpc_slice_unref_internal(outbuf);
+    return 0;
+  }
+  zstd_add_outbuf(outbuf, out.pos, output);
+  return 1;
+}
+
+/* Logs a zstd decompression error, counting the frames rejected for needing a
+ * window larger than the one allowed. */
+static void zstd_decompress_error(size_t r) {
+  if (ZSTD_getErrorCode(r) == ZSTD_error_frameParameter_windowTooLarge) {
+    GRPC_STATS_INC_MESSAGE_DECOMPRESSION_WINDOW_REJECTED();
+  }
+  gpr_log(GPR_INFO, "zstd error (%s)", ZSTD_getErrorName(r));
+}
+
+/* Streaming decompression, for frames whose content size is unknown. Older
+ * senders flushed but never ended their frame, so reaching the end of the
+ * input without an end of frame marker is accepted here. */
+static int zstd_decompress_body(ZSTD_DCtx* dctx, grpc_slice_buffer* input,
+                                grpc_slice_buffer* output,
+                                size_t max_output_length) {
+  const size_t length_before = output->length;
+  grpc_slice outbuf;
+  ZSTD_outBuffer out;
+  zstd_next_outbuf(&outbuf, &out);
+  for (size_t i = 0; i < input->count; i++) {
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    do {
+      if (out.pos == out.size) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        zstd_next_outbuf(&outbuf, &out);
+      }
+      size_t r = ZSTD_decompressStream(dctx, &out, &in);
+      if (ZSTD_isError(r)) {
+        zstd_decompress_error(r);
+        grpc_slice_unref_internal(outbuf);
+        return 0;
+      }
+      if (output->length - length_before + out.pos > max_output_length) {
+        grpc_slice_unref_internal(outbuf);
+        return -1;
+      }
+      /* a full output buffer may hide buffered data: keep going until there
+       * is room left over */
+    } while (in.pos < in.size || out.pos == out.size);
+  }
+
+  GPR_ASSERT(outbuf.refcount);
+  outbuf.data.refcounted.length = out.pos;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  return 1;
+}
+
+/* Points 'header' at the start of the first frame in 'input', copying up to
+ * 'max_length' bytes of it to 'storage' if it straddles slices. Returns the
+ * number of header bytes available. */
+static size_t frame_header(grpc_slice_buffer* input, size_t max_length,
+                           uint8_t* storage, const uint8_t** header) {
+  if (input->count == 0) return 0;
+  const grpc_slice& first = input->slices[0];
+  if (GRPC_SLICE_LENGTH(first) >= max_length || input->count == 1) {
+    *header = GRPC_SLICE_START_PTR(first);
+    return GRPC_SLICE_LENGTH(first);
+  }
+  size_t header_length = 0;
+  for (size_t i = 0; i < input->count && header_length < max_length; i++) {
+    size_t n = GPR_MIN(GRPC_SLICE_LENGTH(input->slices[i]),
+                       max_length - header_length);
+    memcpy(storage + header_length, GRPC_SLICE_START_PTR(input->slices[i]), n);
+    header_length += n;
+  }
+  *header = storage;
+  return header_length;
+}
+
+/* Decompresses a single frame of known 'content_size' into one slice of
+ * exactly that size. Returns -1 if the input holds more than that one frame,
+ * in which case nothing was added to 'output' and the caller must fall back to
+ * zstd_decompress_body() after resetting 'dctx'. */
+static int zstd_decompress_sized(ZSTD_DCtx* dctx, grpc_slice_buffer* input,
+                                 size_t content_size,
+                                 grpc_slice_buffer* output) {
+  grpc_slice outbuf = grpc_slice_malloc_large(content_size);
+  size_t r;
+  if (input->count == 1) {
+    const grpc_slice& src = input->slices[0];
+    r = ZSTD_findFrameCompressedSize(GRPC_SLICE_START_PTR(src),
+                                     GRPC_SLICE_LENGTH(src));
+    if (!ZSTD_isError(r) && r != GRPC_SLICE_LENGTH(src)) {
+      grpc_slice_unref_internal(outbuf);
+      return -1;
+    }
+    if (!ZSTD_isError(r)) {
+      r = ZSTD_decompressDCtx(dctx, GRPC_SLICE_START_PTR(outbuf), content_size,
+                              GRPC_SLICE_START_PTR(src),
+                              GRPC_SLICE_LENGTH(src));
+    }
+    if (!ZSTD_isError(r) && r != content_size) {
+      gpr_log(GPR_INFO, "zstd: frame content size mismatch");
+      grpc_slice_unref_internal(outbuf);
+      return 0;
+    }
+  } else {
+    ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), content_size, 0};
+    r = 1;
+    for (size_t i = 0; i < input->count && r != 0 && !ZSTD_isError(r); i++) {
+      ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                          GRPC_SLICE_LENGTH(input->slices[i]), 0};
+      while (in.pos < in.size && r != 0) {
+        const size_t in_pos = in.pos;
+        const size_t out_pos = out.pos;
+        r = ZSTD_decompressStream(dctx, &out, &in);
+        if (ZSTD_isError(r)) break;
+        if (r != 0 && in.pos == in_pos && out.pos == out_pos) {
+          /* stalled on a full output: the frame holds more than it declared */
+          gpr_log(GPR_INFO, "zstd: frame content size mismatch");
+          grpc_slice_unref_internal(outbuf);
+          return 0;
+        }
+      }
+      if (r == 0 && (in.pos < in.size || i < input->count - 1)) {
+        /* the frame ended before the input did */
+        grpc_slice_unref_internal(outbuf);
+        return -1;
+      }
+    }
+    if (!ZSTD_isError(r) && (r != 0 || out.pos != content_size)) {
+      gpr_log(GPR_INFO, "zstd: truncated frame");
+      grpc_slice_unref_internal(outbuf);
+      return 0;
+    }
+  }
+  if (ZSTD_isError(r)) {
+    zstd_decompress_error(r);
+    grpc_slice_unref_internal(outbuf);
+    return 0;
+  }
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  return 1;
+}
+
+/* Returns a new context compressing on 'workers' threads, or NULL if the zstd
+ * library is single-threaded. The worker threads belong to the context, so
+ * these contexts are not pooled: a pooled context would keep its threads
+ * alive long after the message. Creating them is cheap next to compressing
+ * the messages large enough to be split between workers. */
+static ZSTD_CCtx* zstd_create_multithreaded_cctx(int workers) {
+  if (gpr_atm_no_barrier_load(&g_zstd_workers_unsupported)) return nullptr;
+  ZSTD_CCtx* cctx = ZSTD_createCCtx();
+  GPR_ASSERT(cctx != nullptr);
+  const size_t r = ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, workers);
+  if (ZSTD_isError(r)) {
+    if (gpr_atm_no_barrier_cas(&g_zstd_workers_unsupported, 0, 1)) {
+      gpr_log(GPR_INFO,
+              "zstd worker threads unavailable (%s): compressing on the "
+              "calling thread",
+              ZSTD_getErrorName(r));
+    }
+    ZSTD_freeCCtx(cctx);
+    return nullptr;
+  }
+  return cctx;
+}
+
+static int zstd_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                         int level, grpc_zstd_dictionary* dictionary,
+                         int workers, int window_log_max) {
+  ZSTD_CCtx* cctx =
+      workers > 0 ? zstd_create_multithreaded_cctx(workers) : nullptr;
+  const bool pooled = cctx == nullptr;
+  if (pooled) cctx = grpc_zstd_cctx_acquire();
+  if (dictionary != nullptr) {
+    /* the CDict carries the compression level */
+    GPR_ASSERT(!ZSTD_isError(ZSTD_CCtx_refCDict(
+        cctx, grpc_zstd_dictionary_cdict(dictionary, level))));
+  } else {
+    GPR_ASSERT(!ZSTD_isError(
+        ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, level)));
+  }
+  /* zstd still shrinks the window to the size of smaller messages */
+  if (window_log_max > 0) {
+    GPR_ASSERT(!ZSTD_isError(
+        ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, window_log_max)));
+  }
+  int r = zstd_compress_body(cctx, input, output);
+  if (pooled) {
+    grpc_zstd_cctx_release(cctx);
+  } else {
+    ZSTD_freeCCtx(cctx);
+  }
+  return r;
+}
+
+/* Looks up the dictionary that the frame starting with 'header' was
+ * compressed with, returning a new reference to it in '*dictionary' (NULL if
+ * the frame does not use one). Returns 0 if the dictionary is not loaded. */
+static int zstd_frame_dictionary(const uint8_t* header, size_t header_length,
+                                 grpc_zstd_dictionary** dictionary) {
+  *dictionary = nullptr;
+  const uint32_t dictionary_id =
+      header_length == 0 ? 0 : ZSTD_getDictID_fromFrame(header, header_length);
+  if (dictionary_id != 0) {
+    *dictionary = grpc_zstd_dictionary_find(dictionary_id);
+    if (*dictionary == nullptr) {
+      gpr_log(GPR_INFO, "zstd: unknown dictionary %u", dictionary_id);
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* Returns a pooled context set up to decompress with 'dictionary', if any,
+ * refusing windows larger than 2^window_log_max when it is positive. zstd
+ * checks the window of every frame it allocates one for, skippable frames and
+ * all, so no frame of the message gets past the cap. The pool resets the
+ * parameters on release. */
+static ZSTD_DCtx* zstd_dctx_acquire(grpc_zstd_dictionary* dictionary,
+                                    int window_log_max) {
+  ZSTD_DCtx* dctx = grpc_zstd_dctx_acquire();
+  if (dictionary != nullptr) {
+    GPR_ASSERT(!ZSTD_isError(
+        ZSTD_DCtx_refDDict(dctx, grpc_zstd_dictionary_ddict(dictionary))));
+  }
+  if (window_log_max > 0) {
+    GPR_ASSERT(!ZSTD_isError(
+        ZSTD_DCtx_setParameter(dctx, ZSTD_d_windowLogMax, window_log_max)));
+  }
+  return dctx;
+}
+
+static int zstd_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                           size_t max_output_length, int window_log_max) {
+  uint8_t header_storage[ZSTD_FRAME_HEADER_SIZE_MAX];
+  const uint8_t* header = nullptr;
+  const size_t header_length =
+      frame_header(input, ZSTD_FRAME_HEADER_SIZE_MAX, header_storage, &header);
+  grpc_zstd_dictionary* dictionary;
+  if (!zstd_frame_dictionary(header, header_length, &dictionary)) return 0;
+  ZSTD_DCtx* dctx = zstd_dctx_acquire(dictionary, window_log_max);
+  int r = -1;
+  size_t i;
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  unsigned long long content_size =
+      header_length == 0 ? ZSTD_CONTENTSIZE_ERROR
+                         : ZSTD_getFrameContentSize(header, header_length);
+  /* the declared size is enough to reject a frame, but not to accept one */
+  if (content_size < ZSTD_CONTENTSIZE_ERROR &&
+      content_size > max_output_length) {
+    grpc_zstd_dctx_release(dctx);
+    if (dictionary != nullptr) grpc_zstd_dictionary_unref(dictionary);
+    return -1;
+  }
+  if (content_size <= MAX_PREALLOCATED_SIZE ||
+      (content_size != ZSTD_CONTENTSIZE_UNKNOWN &&
+       content_size != ZSTD_CONTENTSIZE_ERROR &&
+       content_size / MAX_PREALLOCATED_RATIO <= input->length)) {
+    r = zstd_decompress_sized(dctx, input, static_cast<size_t>(content_size),
+                              output);
+    if (r == -1) {
+      GPR_ASSERT(!ZSTD_isError(ZSTD_DCtx_reset(dctx, ZSTD_reset_session_only)));
+    }
+  }
+  if (r == -1) {
+    r = zstd_decompress_body(dctx, input, output, max_output_length);
+  }
+  if (r != 1) {
+    for (i = count_before; i < output->count; i++) {
+      grpc_slice_unref_internal(output->slices[i]);
+    }
+    output->count = count_before;
+    output->length = length_before;
+  }
+  grpc_zstd_dctx_release(dctx);
+  if (dictionary != nullptr) grpc_zstd_dictionary_unref(dictionary);
+  return r;
+}
+
+/* Slices that lz4 decompresses into when the content size is unknown: one
+ * block, since into smaller ones lz4 decodes each block to a buffer of its
+ * own and copies it out from there. */
+#define LZ4_OUTPUT_BLOCK_SIZE (64 * 1024)
+
+/* Messages compressed with lz4 are LZ4 frames, which any lz4 library decodes:
+ * 64 KB linked blocks at the default acceleration, without checksums. */
+static void lz4_preferences(unsigned long long content_size,
+                            LZ4F_preferences_t* prefs) {
+  memset(prefs, 0, sizeof(*prefs));
+  prefs->frameInfo.blockSizeID = LZ4F_max64KB;
+  prefs->frameInfo.blockMode = LZ4F_blockLinked;
+  prefs->frameInfo.contentSize = content_size;
+}
+
+/* Compresses the whole message as one frame into one contiguous slice. The
+ * frame API wants room for the worst case of every update, so the slice is
+ * sized for an incompressible message; compression still gives up as soon as
+ * the output is as long as the input. Like zstd's, the frame header records
+ * the content size. */
+static int lz4_compress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  if (input->length == 0) return 0;
+  LZ4F_preferences_t prefs;
+  lz4_preferences(input->length, &prefs);
+  grpc_slice outbuf =
+      grpc_slice_malloc_large(LZ4F_compressFrameBound(input->length, &prefs));
+  uint8_t* dst = GRPC_SLICE_START_PTR(outbuf);
+  const size_t capacity = GRPC_SLICE_LENGTH(outbuf);
+  LZ4F_cctx* cctx = grpc_lz4_cctx_acquire();
+  size_t r = LZ4F_compressBegin(cctx, dst, capacity, &prefs);
+  size_t length = LZ4F_isError(r) ? 0 : r;
+  for (size_t i = 0;
+       i < input->count && !LZ4F_isError(r) && length < input->length; i++) {
+    r = LZ4F_compressUpdate(cctx, dst + length, capacity - length,
+                            GRPC_SLICE_START_PTR(input->slices[i]),
+                            GRPC_SLICE_LENGTH(input->slices[i]), nullptr);
+    if (!LZ4F_isError(r)) length += r;
+  }
+  if (!LZ4F_isError(r) && length < input->length) {
+    r = LZ4F_compressEnd(cctx, dst + length, capacity - length, nullptr);
+    if (!LZ4F_isError(r)) length += r;
+  }
+  grpc_lz4_cctx_release(cctx);
+  if (LZ4F_isError(r)) {
+    gpr_log(GPR_INFO, "lz4 error (%s)", LZ4F_getErrorName(r));
+  }
+  if (LZ4F_isError(r) || length >= input->length) {
+    grpc_slice_unref_internal(outbuf);
+    return 0;
+  }
+  grpc_slice_buffer_add_indexed(output, trim_outbuf(outbuf, length));
+  return 1;
+}
+
+/* Decompresses any number of complete frames. If the first frame declares its
+ * content size, as the ones that gRPC sends do, and that size is within the
+ * limits put on zstd frames, it is decompressed into a single slice. */
+static int lz4_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                          size_t max_output_length) {
+  uint8_t header_storage[LZ4F_HEADER_SIZE_MAX];
+  const uint8_t* header = nullptr;
+  size_t header_length =
+      frame_header(input, LZ4F_HEADER_SIZE_MAX, header_storage, &header);
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  LZ4F_dctx* dctx = grpc_lz4_dctx_acquire();
+  LZ4F_frameInfo_t info;
+  /* consumes the header, leaving 'header_length' to skip in the input */
+  size_t r = LZ4F_getFrameInfo(dctx, &info, header, &header_length);
+  if (!LZ4F_isError(r) && info.contentSize > max_output_length) {
+    grpc_lz4_dctx_release(dctx);
+    return -1;
+  }
+  size_t outbuf_size = LZ4_OUTPUT_BLOCK_SIZE;
+  if (!LZ4F_isError(r) && info.contentSize != 0 &&
+      (info.contentSize <= MAX_PREALLOCATED_SIZE ||
+       info.contentSize / MAX_PREALLOCATED_RATIO <= input->length)) {
+    outbuf_size = static_cast<size_t>(info.contentSize);
+  }
+  grpc_slice outbuf = grpc_slice_malloc_large(outbuf_size);
+  size_t used = 0;
+  bool exceeded = false;
+  for (size_t i = 0; i < input->count && !LZ4F_isError(r) && !exceeded;
+       i++) {
+    const uint8_t* src = GRPC_SLICE_START_PTR(input->slices[i]);
+    size_t remaining = GRPC_SLICE_LENGTH(input->slices[i]);
+    const size_t skip = GPR_MIN(header_length, remaining);
+    src += skip;
+    remaining -= skip;
+    header_length -= skip;
+    /* a full output buffer may hide buffered data: keep going until there is
+     * room left over, or the frame has ended */
+    while (remaining > 0 ||
+           (used == GRPC_SLICE_LENGTH(outbuf) && r != 0 &&
+            i == input->count - 1)) {
+      if (used == GRPC_SLICE_LENGTH(outbuf)) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(LZ4_OUTPUT_BLOCK_SIZE);
+        used = 0;
+      }
+      size_t produced = GRPC_SLICE_LENGTH(outbuf) - used;
+      size_t consumed = remaining;
+      r = LZ4F_decompress(dctx, GRPC_SLICE_START_PTR(outbuf) + used,
+                          &produced, src, &consumed, nullptr);
+      if (LZ4F_isError(r)) break;
+      used += produced;
+      src += consumed;
+      remaining -= consumed;
+      if (output->length - length_before + used > max_output_length) {
+        exceeded = true;
+        break;
+      }
+    }
+  }
+  grpc_lz4_dctx_release(dctx);
+  if (exceeded || LZ4F_isError(r) || r != 0) {
+    if (LZ4F_isError(r)) {
+      gpr_log(GPR_INFO, "lz4 error (%s)", LZ4F_getErrorName(r));
+    } else if (!exceeded) {
+      gpr_log(GPR_INFO, "lz4: truncated frame");
+    }
+    grpc_slice_unref_internal(outbuf);
+    for (size_t i = count_before; i < output->count; i++) {
+      grpc_slice_unref_internal(output->slices[i]);
+    }
+    output->count = count_before;
+    output->length = length_before;
+    return exceeded ? -1 : 0;
+  }
+  if (used > 0) {
+    grpc_slice_buffer_add_indexed(output, trim_outbuf(outbuf, used));
+  } else {
+    grpc_slice_unref_internal(outbuf);
+  }
+  return 1;
 }
 
 static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
@@ -322,6 +646,7 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
 }
 
 static int compress_inner(grpc_message_compression_algorithm algorithm,
+                          const grpc_msg_compress_options* options,
                           grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_MESSAGE_COMPRESS_NONE:
@@ -332,8 +657,11 @@ static int compress_inner(grpc_message_compression_algorithm algorithm,
       return zlib_compress(input, output, 0);
     case GRPC_MESSAGE_COMPRESS_GZIP:
       return zlib_compress(input, output, 1);
-	case GRPC_MESSAGE_COMPRESS_ZSTD:
-	  return zstd::zstd_compress(input, output);
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+      return zstd_compress(input, output, options->level, options->dictionary,
+                           options->workers, options->window_log_max);
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      return lz4_compress(input, output);
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -341,29 +669,865 @@ static int compress_inner(grpc_message_compression_algorithm algorithm,
   return 0;
 }
 
+void grpc_msg_compress_options_init(grpc_msg_compress_options* options) {
+  options->level = GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL;
+  options->dictionary = nullptr;
+  options->workers = 0;
+  options->window_log_max = 0;
+}
+
 int grpc_msg_compress(grpc_message_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  return grpc_msg_compress_with_options(algorithm, &options, input, output);
+}
+
+int grpc_msg_compress_with_options(grpc_message_compression_algorithm algorithm,
+                                   const grpc_msg_compress_options* options,
+                                   grpc_slice_buffer* input,
+                                   grpc_slice_buffer* output) {
+  if (!compress_inner(algorithm, options, input, output)) {
     copy(input, output);
     return 0;
   }
   return 1;
 }
 
+/* The window log that zstd picks for large messages at 'level', from its
+ * table of default parameters. */
+static int zstd_default_window_log(int level) {
+  if (level <= 1) return 19;
+  if (level <= 2) return 20;
+  if (level <= 9) return 21;
+  if (level <= 16) return 22;
+  if (level <= 19) return 23;
+  return GPR_MIN(level + 5, 27);
+}
+
+size_t grpc_msg_compress_memory_estimate(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_compress_options* options, size_t length) {
+  switch (algorithm) {
+    case GRPC_MESSAGE_COMPRESS_NONE:
+    case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
+      return 0;
+    case GRPC_MESSAGE_COMPRESS_DEFLATE:
+    case GRPC_MESSAGE_COMPRESS_GZIP:
+      /* zlib's window and hash chains at its default memLevel, and the
+       * output */
+      return (size_t{1} << 17) + (size_t{1} << 17) + length;
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      /* the hash table, two linked 64 KB blocks, and the output */
+      return (size_t{1} << 14) + 2 * (64 * 1024) + length;
+    case GRPC_MESSAGE_COMPRESS_ZSTD: {
+      const int window_log = options->window_log_max > 0
+                                 ? options->window_log_max
+                                 : zstd_default_window_log(options->level);
+      const size_t window = GPR_MIN(size_t{1} << window_log, length);
+      /* the window, match finding tables of about the same size, and the
+       * output */
+      return 2 * window + length;
+    }
+  }
+  return 0;
+}
+
+/* Size of the slices a grpc_msg_compressor fills with compressed output. */
+#define COMPRESSOR_OUTPUT_SIZE (16 * 1024)
+
+struct grpc_msg_compressor {
+  grpc_message_compression_algorithm algorithm;
+  z_stream* zs;
+  ZSTD_CCtx* cctx;
+  LZ4F_cctx* lz4_cctx;
+  LZ4F_preferences_t lz4_prefs;
+  /* the slice being filled with compressed output, and how much of it is */
+  grpc_slice outbuf;
+  size_t outbuf_used;
+  /* set once the message has ended, or compressing it failed */
+  bool closed;
+};
+
+/* Hands the compressed output slice over to 'output' once it is full, and
+   starts a new one. */
+static void compressor_next_outbuf(grpc_msg_compressor* c,
+                                   grpc_slice_buffer* output) {
+  if (c->outbuf_used < GRPC_SLICE_LENGTH(c->outbuf)) return;
+  grpc_slice_buffer_add_indexed(output, c->outbuf);
+  c->outbuf = GRPC_SLICE_MALLOC(COMPRESSOR_OUTPUT_SIZE);
+  c->outbuf_used = 0;
+}
+
+/* Deflates 'length' bytes of 'input' with 'flush', until it is all consumed
+   and, at Z_FINISH, the stream has ended. */
+static int zlib_compress_next(grpc_msg_compressor* c, const uint8_t* input,
+                              size_t length, int flush,
+                              grpc_slice_buffer* output) {
+  const uInt uint_max = ~static_cast<uInt>(0);
+  z_stream* zs = c->zs;
+  zs->next_in = const_cast<uint8_t*>(input);
+  for (;;) {
+    const uInt chunk = static_cast<uInt>(GPR_MIN(length, uint_max));
+    zs->avail_in = chunk;
+    const int last_chunk = chunk == length;
+    int r;
+    do {
+      compressor_next_outbuf(c, output);
+      zs->next_out = GRPC_SLICE_START_PTR(c->outbuf) + c->outbuf_used;
+      zs->avail_out =
+          static_cast<uInt>(GRPC_SLICE_LENGTH(c->outbuf) - c->outbuf_used);
+      const uInt avail_out = zs->avail_out;
+      r = deflate(zs, last_chunk ? flush : Z_NO_FLUSH);
+      c->outbuf_used += avail_out - zs->avail_out;
+      if (r < 0 && r != Z_BUF_ERROR /* not fatal */) {
+        gpr_log(GPR_INFO, "zlib error (%d)", r);
+        return 0;
+      }
+    } while (zs->avail_in > 0 || zs->avail_out == 0 ||
+             (last_chunk && flush == Z_FINISH && r != Z_STREAM_END));
+    length -= chunk;
+    if (last_chunk) return 1;
+  }
+}
+
+/* Compresses 'length' bytes of 'input' with 'mode', until it is all consumed
+   and, at ZSTD_e_end, the frame has ended. */
+static int zstd_compress_next(grpc_msg_compressor* c, const uint8_t* input,
+                              size_t length, ZSTD_EndDirective mode,
+                              grpc_slice_buffer* output) {
+  ZSTD_inBuffer in = {input, length, 0};
+  size_t r;
+  do {
+    compressor_next_outbuf(c, output);
+    ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(c->outbuf),
+                          GRPC_SLICE_LENGTH(c->outbuf), c->outbuf_used};
+    r = ZSTD_compressStream2(c->cctx, &out, &in, mode);
+    c->outbuf_used = out.pos;
+    if (ZSTD_isError(r)) {
+      gpr_log(GPR_INFO, "zstd error (%s)", ZSTD_getErrorName(r));
+      return 0;
+    }
+    /* ZSTD_e_end returns 0 once the frame is complete */
+  } while (in.pos < in.size || (mode == ZSTD_e_end && r != 0));
+  return 1;
+}
+
+/* Input is handed to lz4 in pieces of at most this many bytes: one block,
+   which bounds the output space that each piece needs. */
+#define LZ4_COMPRESSOR_INPUT_SIZE (64 * 1024)
+
+/* Makes room for 'needed' more bytes in the compressed output slice, handing
+   it over to 'output' and starting a large enough one if it has too little. */
+static void lz4_reserve_outbuf(grpc_msg_compressor* c, size_t needed,
+                               grpc_slice_buffer* output) {
+  if (GRPC_SLICE_LENGTH(c->outbuf) - c->outbuf_used >= needed) return;
+  if (c->outbuf_used > 0) {
+    grpc_slice_buffer_add_indexed(output,
+                                  trim_outbuf(c->outbuf, c->outbuf_used));
+  } else {
+    grpc_slice_unref_internal(c->outbuf);
+  }
+  c->outbuf = GRPC_SLICE_MALLOC(GPR_MAX(COMPRESSOR_OUTPUT_SIZE, needed));
+  c->outbuf_used = 0;
+}
+
+/* Compresses 'length' bytes of 'input' and, if 'end' is set, ends the frame.
+   The frame API only compresses into room for the worst case, which is
+   reserved ahead of each call. */
+static int lz4_compress_next(grpc_msg_compressor* c, const uint8_t* input,
+                             size_t length, bool end,
+                             grpc_slice_buffer* output) {
+  size_t r = 0;
+  while (length > 0 && !LZ4F_isError(r)) {
+    const size_t n = GPR_MIN(length, LZ4_COMPRESSOR_INPUT_SIZE);
+    lz4_reserve_outbuf(c, LZ4F_compressBound(n, &c->lz4_prefs), output);
+    r = LZ4F_compressUpdate(
+        c->lz4_cctx, GRPC_SLICE_START_PTR(c->outbuf) + c->outbuf_used,
+        GRPC_SLICE_LENGTH(c->outbuf) - c->outbuf_used, input, n, nullptr);
+    if (!LZ4F_isError(r)) c->outbuf_used += r;
+    input += n;
+    length -= n;
+  }
+  if (end && !LZ4F_isError(r)) {
+    lz4_reserve_outbuf(c, LZ4F_compressBound(0, &c->lz4_prefs), output);
+    r = LZ4F_compressEnd(c->lz4_cctx,
+                         GRPC_SLICE_START_PTR(c->outbuf) + c->outbuf_used,
+                         GRPC_SLICE_LENGTH(c->outbuf) - c->outbuf_used,
+                         nullptr);
+    if (!LZ4F_isError(r)) c->outbuf_used += r;
+  }
+  if (LZ4F_isError(r)) {
+    gpr_log(GPR_INFO, "lz4 error (%s)", LZ4F_getErrorName(r));
+    return 0;
+  }
+  return 1;
+}
+
+/* Compresses 'length' bytes of 'input' with the compressor's algorithm and,
+   if 'end' is set, ends the compressed stream. */
+static int compressor_next(grpc_msg_compressor* c, const uint8_t* input,
+                           size_t length, bool end, grpc_slice_buffer* output) {
+  switch (c->algorithm) {
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+      return zstd_compress_next(c, input, length,
+                                end ? ZSTD_e_end : ZSTD_e_continue, output);
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      return lz4_compress_next(c, input, length, end, output);
+    default:
+      return zlib_compress_next(c, input, length, end ? Z_FINISH : Z_NO_FLUSH,
+                                output);
+  }
+}
+
+grpc_msg_compressor* grpc_msg_compressor_create(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_compress_options* options) {
+  switch (algorithm) {
+    case GRPC_MESSAGE_COMPRESS_DEFLATE:
+    case GRPC_MESSAGE_COMPRESS_GZIP:
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      break;
+    case GRPC_MESSAGE_COMPRESS_NONE:
+      return nullptr;
+    case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
+      gpr_log(GPR_ERROR, "invalid compression algorithm %d", algorithm);
+      return nullptr;
+  }
+  grpc_msg_compressor* c =
+      static_cast<grpc_msg_compressor*>(gpr_zalloc(sizeof(*c)));
+  c->algorithm = algorithm;
+  c->outbuf = GRPC_SLICE_MALLOC(COMPRESSOR_OUTPUT_SIZE);
+  if (algorithm == GRPC_MESSAGE_COMPRESS_ZSTD) {
+    c->cctx = grpc_zstd_cctx_acquire();
+    if (options->dictionary != nullptr) {
+      GPR_ASSERT(!ZSTD_isError(ZSTD_CCtx_refCDict(
+          c->cctx,
+          grpc_zstd_dictionary_cdict(options->dictionary, options->level))));
+    } else {
+      GPR_ASSERT(!ZSTD_isError(ZSTD_CCtx_setParameter(
+          c->cctx, ZSTD_c_compressionLevel, options->level)));
+    }
+    /* the message size is not known up front: without a cap, the window is
+       the level's default */
+    if (options->window_log_max > 0) {
+      GPR_ASSERT(!ZSTD_isError(ZSTD_CCtx_setParameter(
+          c->cctx, ZSTD_c_windowLog, options->window_log_max)));
+    }
+  } else if (algorithm == GRPC_MESSAGE_COMPRESS_LZ4) {
+    c->lz4_cctx = grpc_lz4_cctx_acquire();
+    /* the length of the message is not known up front */
+    lz4_preferences(0, &c->lz4_prefs);
+    const size_t r = LZ4F_compressBegin(c->lz4_cctx,
+                                        GRPC_SLICE_START_PTR(c->outbuf),
+                                        GRPC_SLICE_LENGTH(c->outbuf),
+                                        &c->lz4_prefs);
+    GPR_ASSERT(!LZ4F_isError(r));
+    c->outbuf_used = r;
+  } else {
+    c->zs =
+        grpc_deflate_stream_acquire(algorithm == GRPC_MESSAGE_COMPRESS_GZIP);
+  }
+  return c;
+}
+
+int grpc_msg_compressor_write(grpc_msg_compressor* c, const uint8_t* input,
+                              size_t length, grpc_slice_buffer* output) {
+  if (c->closed) return 0;
+  if (length == 0) return 1;
+  const int ok = compressor_next(c, input, length, false, output);
+  c->closed = !ok;
+  return ok;
+}
+
+int grpc_msg_compressor_finish(grpc_msg_compressor* c,
+                               grpc_slice_buffer* output) {
+  if (c->closed) return 0;
+  const int ok = compressor_next(c, nullptr, 0, true, output);
+  c->closed = true;
+  if (!ok) return 0;
+  if (c->outbuf_used > 0) {
+    grpc_slice_buffer_add_indexed(output,
+                                  trim_outbuf(c->outbuf, c->outbuf_used));
+  } else {
+    grpc_slice_unref_internal(c->outbuf);
+  }
+  c->outbuf = grpc_empty_slice();
+  return 1;
+}
+
+void grpc_msg_compressor_destroy(grpc_msg_compressor* c) {
+  if (c->zs != nullptr) {
+    grpc_deflate_stream_release(c->zs,
+                                c->algorithm == GRPC_MESSAGE_COMPRESS_GZIP);
+  }
+  if (c->cctx != nullptr) grpc_zstd_cctx_release(c->cctx);
+  if (c->lz4_cctx != nullptr) grpc_lz4_cctx_release(c->lz4_cctx);
+  grpc_slice_unref_internal(c->outbuf);
+  gpr_free(c);
+}
+
+/* The probe compresses PROBE_SAMPLE_COUNT samples of PROBE_SAMPLE_SIZE bytes,
+   evenly spread over the message. Shorter messages are not probed: compressing
+   them whole costs little more than the probe. */
+#define PROBE_SAMPLE_COUNT 4
+#define PROBE_SAMPLE_SIZE 1024
+#define PROBE_MIN_INPUT_SIZE (4 * PROBE_SAMPLE_COUNT * PROBE_SAMPLE_SIZE)
+
+/* copies 'length' bytes of 'input', starting at 'offset', to 'dst' */
+static void copy_range(const grpc_slice_buffer* input, size_t offset,
+                       size_t length, uint8_t* dst) {
+  for (size_t i = 0; i < input->count && length > 0; i++) {
+    const size_t slice_length = GRPC_SLICE_LENGTH(input->slices[i]);
+    if (offset >= slice_length) {
+      offset -= slice_length;
+      continue;
+    }
+    const size_t n = GPR_MIN(slice_length - offset, length);
+    memcpy(dst, GRPC_SLICE_START_PTR(input->slices[i]) + offset, n);
+    dst += n;
+    length -= n;
+    offset = 0;
+  }
+}
+
+int grpc_msg_is_compressible(const grpc_slice_buffer* input,
+                             int min_savings_percent) {
+  if (min_savings_percent <= 0 || input->length < PROBE_MIN_INPUT_SIZE) {
+    return 1;
+  }
+  uint8_t samples[PROBE_SAMPLE_COUNT * PROBE_SAMPLE_SIZE];
+  const size_t stride = input->length / PROBE_SAMPLE_COUNT;
+  for (size_t i = 0; i < PROBE_SAMPLE_COUNT; i++) {
+    copy_range(input, i * stride, PROBE_SAMPLE_SIZE,
+               samples + i * PROBE_SAMPLE_SIZE);
+  }
+  uint8_t compressed[ZSTD_COMPRESSBOUND(sizeof(samples))];
+  ZSTD_CCtx* cctx = grpc_zstd_cctx_acquire();
+  /* zstd's fastest regular level: what the samples would gain at higher
+     levels, or with zlib, is in the same ballpark. */
+  const size_t compressed_size = ZSTD_compressCCtx(
+      cctx, compressed, sizeof(compressed), samples, sizeof(samples), 1);
+  grpc_zstd_cctx_release(cctx);
+  if (ZSTD_isError(compressed_size)) return 1;
+  return compressed_size * 100 <=
+         sizeof(samples) * static_cast<size_t>(100 - min_savings_percent);
+}
+
+void grpc_msg_decompress_options_init(grpc_msg_decompress_options* options) {
+  options->max_output_length = SIZE_MAX;
+  options->window_log_max = 0;
+}
+
 int grpc_msg_decompress(grpc_message_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  grpc_msg_decompress_options options;
+  grpc_msg_decompress_options_init(&options);
+  return grpc_msg_decompress_with_options(algorithm, &options, input, output);
+}
+
+static int decompress_with_options(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_decompress_options* options, grpc_slice_buffer* input,
+    grpc_slice_buffer* output) {
+  const size_t max_output_length = options->max_output_length;
   switch (algorithm) {
     case GRPC_MESSAGE_COMPRESS_NONE:
+      if (input->length > max_output_length) return -1;
       return copy(input, output);
     case GRPC_MESSAGE_COMPRESS_DEFLATE:
-      return zlib_decompress(input, output, 0);
+      return zlib_decompress(input, output, 0, max_output_length);
     case GRPC_MESSAGE_COMPRESS_GZIP:
-      return zlib_decompress(input, output, 1);
-	case GRPC_MESSAGE_COMPRESS_ZSTD:
-	return zstd::zstd_decompress(input, output);
+      return zlib_decompress(input, output, 1, max_output_length);
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+      return zstd_decompress(input, output, max_output_length,
+                             options->window_log_max);
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      return lz4_decompress(input, output, max_output_length);
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
   gpr_log(GPR_ERROR, "invalid compression algorithm %d", algorithm);
   return 0;
 }
+
+int grpc_msg_decompress_with_options(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_decompress_options* options, grpc_slice_buffer* input,
+    grpc_slice_buffer* output) {
+  const int r = decompress_with_options(algorithm, options, input, output);
+  if (r == -1) {
+    GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LIMIT_EXCEEDED();
+  }
+  return r;
+}
+
+/* The ratio of decompressed to compressed size that
+ * grpc_msg_decompress_memory_estimate() assumes when the message does not
+ * declare its size. */
+#define ESTIMATED_COMPRESSION_RATIO 4
+
+size_t grpc_msg_decompress_memory_estimate(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_decompress_options* options, grpc_slice_buffer* input) {
+  size_t output_length =
+      GPR_MIN(options->max_output_length,
+              input->length * ESTIMATED_COMPRESSION_RATIO);
+  switch (algorithm) {
+    case GRPC_MESSAGE_COMPRESS_NONE:
+    case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
+      return 0;
+    case GRPC_MESSAGE_COMPRESS_DEFLATE:
+    case GRPC_MESSAGE_COMPRESS_GZIP:
+      /* zlib's 32 KB window and inflate state, and the output */
+      return (size_t{1} << 15) + (size_t{1} << 13) + output_length;
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      /* two linked 64 KB blocks, and the output */
+      return 2 * (64 * 1024) + output_length;
+    case GRPC_MESSAGE_COMPRESS_ZSTD: {
+      uint8_t header_storage[ZSTD_FRAME_HEADER_SIZE_MAX];
+      const uint8_t* header = nullptr;
+      const size_t header_length = frame_header(
+          input, ZSTD_FRAME_HEADER_SIZE_MAX, header_storage, &header);
+      const unsigned long long content_size =
+          header_length == 0 ? ZSTD_CONTENTSIZE_ERROR
+                             : ZSTD_getFrameContentSize(header, header_length);
+      if (content_size < ZSTD_CONTENTSIZE_ERROR) {
+        output_length = static_cast<size_t>(
+            GPR_MIN(content_size, options->max_output_length));
+      }
+      /* the window, of up to zstd's default cap of 2^27 bytes, never
+       * outgrows the message it decompresses */
+      const int window_log =
+          options->window_log_max > 0 ? options->window_log_max : 27;
+      return GPR_MIN(size_t{1} << window_log, output_length) + output_length;
+    }
+  }
+  return 0;
+}
+
+/* Slices returned by grpc_msg_decompressor_next() hold up to this many bytes:
+   large enough to amortize the per slice overhead, small enough that a reader
+   of a huge message never holds much of it at once. */
+#define DECOMPRESSOR_OUTPUT_SIZE (64 * 1024)
+
+struct grpc_msg_decompressor {
+  grpc_message_compression_algorithm algorithm;
+  grpc_slice_buffer* input;
+  /* the input slice being decompressed, and how much of it was consumed */
+  size_t input_index;
+  size_t input_offset;
+  z_stream* zs;
+  ZSTD_DCtx* dctx;
+  grpc_zstd_dictionary* dictionary;
+  LZ4F_dctx* lz4_dctx;
+  /* the output budget, and how much of it was used */
+  size_t max_output_length;
+  size_t output_length;
+  /* 1 once the end of the message was reached, -1 after an error */
+  int state;
+  /* whether the error was running out of output budget */
+  bool exceeded_limit;
+};
+
+/* Returns 1 if any input remains after the current input position. */
+static int decompressor_has_input(grpc_msg_decompressor* d) {
+  for (size_t i = d->input_index; i < d->input->count; i++) {
+    if (GRPC_SLICE_LENGTH(d->input->slices[i]) >
+        (i == d->input_index ? d->input_offset : 0)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Moves the input position past 'consumed' more bytes of the current slice,
+   and on to the next slice once this one is used up. */
+static void decompressor_advance(grpc_msg_decompressor* d, size_t consumed) {
+  d->input_offset += consumed;
+  if (d->input_offset == GRPC_SLICE_LENGTH(d->input->slices[d->input_index])) {
+    d->input_index++;
+    d->input_offset = 0;
+  }
+}
+
+/* Inflates into 'out' until it is full or the input runs out. Like
+   zlib_decompress(), accepts input that ends before the end of the stream. */
+static int zlib_decompress_next(grpc_msg_decompressor* d, uint8_t* out,
+                                size_t out_size, size_t* produced) {
+  z_stream* zs = d->zs;
+  zs->next_out = out;
+  zs->avail_out = static_cast<uInt>(out_size);
+  while (zs->avail_out > 0) {
+    /* once the input is used up, inflate only flushes what it holds */
+    const bool has_slice = d->input_index < d->input->count;
+    uInt available = 0;
+    zs->next_in = nullptr;
+    if (has_slice) {
+      grpc_slice& slice = d->input->slices[d->input_index];
+      available = static_cast<uInt>(GRPC_SLICE_LENGTH(slice) - d->input_offset);
+      zs->next_in = GRPC_SLICE_START_PTR(slice) + d->input_offset;
+    }
+    zs->avail_in = available;
+    int r = inflate(zs, Z_NO_FLUSH);
+    if (has_slice) decompressor_advance(d, available - zs->avail_in);
+    if (r == Z_STREAM_END) {
+      if (decompressor_has_input(d)) {
+        gpr_log(GPR_INFO, "zlib: not all input consumed");
+        return 0;
+      }
+      d->state = 1;
+      break;
+    }
+    if (r < 0 && r != Z_BUF_ERROR /* not fatal */) {
+      gpr_log(GPR_INFO, "zlib error (%d)", r);
+      return 0;
+    }
+    if (!has_slice) {
+      if (zs->avail_out > 0) d->state = 1;
+      break;
+    }
+  }
+  *produced = out_size - zs->avail_out;
+  return 1;
+}
+
+/* Decompresses into 'out' until it is full or the input runs out. Like
+   zstd_decompress_body(), accepts any number of frames, the last of which may
+   be unterminated. */
+static int zstd_decompress_next(grpc_msg_decompressor* d, uint8_t* out,
+                                size_t out_size, size_t* produced) {
+  ZSTD_outBuffer outbuf = {out, out_size, 0};
+  while (outbuf.pos < outbuf.size) {
+    /* once the input is used up, zstd only flushes what it holds */
+    const bool has_slice = d->input_index < d->input->count;
+    ZSTD_inBuffer in = {nullptr, 0, 0};
+    if (has_slice) {
+      const grpc_slice& slice = d->input->slices[d->input_index];
+      in.src = GRPC_SLICE_START_PTR(slice);
+      in.size = GRPC_SLICE_LENGTH(slice);
+      in.pos = d->input_offset;
+    }
+    const size_t in_pos = in.pos;
+    size_t r = ZSTD_decompressStream(d->dctx, &outbuf, &in);
+    if (ZSTD_isError(r)) {
+      zstd_decompress_error(r);
+      return 0;
+    }
+    if (has_slice) {
+      decompressor_advance(d, in.pos - in_pos);
+    } else {
+      if (outbuf.pos < outbuf.size) d->state = 1;
+      break;
+    }
+  }
+  *produced = outbuf.pos;
+  return 1;
+}
+
+/* Decompresses into 'out' until it is full or the input runs out. Like
+   lz4_decompress(), accepts any number of frames, but not a truncated one. */
+static int lz4_decompress_next(grpc_msg_decompressor* d, uint8_t* out,
+                               size_t out_size, size_t* produced) {
+  size_t pos = 0;
+  while (pos < out_size) {
+    /* once the input is used up, lz4 only flushes what it holds */
+    const bool has_slice = d->input_index < d->input->count;
+    const uint8_t* src = nullptr;
+    size_t consumed = 0;
+    if (has_slice) {
+      const grpc_slice& slice = d->input->slices[d->input_index];
+      src = GRPC_SLICE_START_PTR(slice) + d->input_offset;
+      consumed = GRPC_SLICE_LENGTH(slice) - d->input_offset;
+    }
+    size_t length = out_size - pos;
+    const size_t r = LZ4F_decompress(d->lz4_dctx, out + pos, &length, src,
+                                     &consumed, nullptr);
+    if (LZ4F_isError(r)) {
+      gpr_log(GPR_INFO, "lz4 error (%s)", LZ4F_getErrorName(r));
+      return 0;
+    }
+    pos += length;
+    if (has_slice) {
+      decompressor_advance(d, consumed);
+    } else {
+      if (pos < out_size) {
+        /* lz4 returns 0 once the frame has ended */
+        if (r != 0) {
+          gpr_log(GPR_INFO, "lz4: truncated frame");
+          return 0;
+        }
+        d->state = 1;
+      }
+      break;
+    }
+  }
+  *produced = pos;
+  return 1;
+}
+
+/* Copies uncompressed input into 'out' until it is full or the input runs
+   out. */
+static int copy_next(grpc_msg_decompressor* d, uint8_t* out, size_t out_size,
+                     size_t* produced) {
+  size_t n = 0;
+  while (n < out_size && d->input_index < d->input->count) {
+    const grpc_slice& slice = d->input->slices[d->input_index];
+    const size_t chunk =
+        GPR_MIN(out_size - n, GRPC_SLICE_LENGTH(slice) - d->input_offset);
+    memcpy(out + n, GRPC_SLICE_START_PTR(slice) + d->input_offset, chunk);
+    n += chunk;
+    decompressor_advance(d, chunk);
+  }
+  if (d->input_index == d->input->count) d->state = 1;
+  *produced = n;
+  return 1;
+}
+
+grpc_msg_decompressor* grpc_msg_decompressor_create(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_decompress_options* options, grpc_slice_buffer* input) {
+  grpc_zstd_dictionary* dictionary = nullptr;
+  switch (algorithm) {
+    case GRPC_MESSAGE_COMPRESS_NONE:
+    case GRPC_MESSAGE_COMPRESS_DEFLATE:
+    case GRPC_MESSAGE_COMPRESS_GZIP:
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      break;
+    case GRPC_MESSAGE_COMPRESS_ZSTD: {
+      uint8_t header_storage[ZSTD_FRAME_HEADER_SIZE_MAX];
+      const uint8_t* header = nullptr;
+      const size_t header_length = frame_header(
+          input, ZSTD_FRAME_HEADER_SIZE_MAX, header_storage, &header);
+      if (!zstd_frame_dictionary(header, header_length, &dictionary)) {
+        return nullptr;
+      }
+      break;
+    }
+    case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
+      gpr_log(GPR_ERROR, "invalid compression algorithm %d", algorithm);
+      return nullptr;
+  }
+  grpc_msg_decompressor* d =
+      static_cast<grpc_msg_decompressor*>(gpr_zalloc(sizeof(*d)));
+  d->algorithm = algorithm;
+  d->input = input;
+  d->dictionary = dictionary;
+  d->max_output_length = options->max_output_length;
+  switch (algorithm) {
+    case GRPC_MESSAGE_COMPRESS_DEFLATE:
+    case GRPC_MESSAGE_COMPRESS_GZIP:
+      d->zs =
+          grpc_inflate_stream_acquire(algorithm == GRPC_MESSAGE_COMPRESS_GZIP);
+      break;
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+      d->dctx = zstd_dctx_acquire(dictionary, options->window_log_max);
+      break;
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      d->lz4_dctx = grpc_lz4_dctx_acquire();
+      break;
+    default:
+      break;
+  }
+  return d;
+}
+
+/* Fails the decompressor once its output exceeds the budget. */
+static int decompressor_exceeded(grpc_msg_decompressor* d) {
+  GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LIMIT_EXCEEDED();
+  gpr_log(GPR_INFO, "decompressed message exceeds %" PRIuPTR " bytes",
+          d->max_output_length);
+  d->state = -1;
+  d->exceeded_limit = true;
+  return -1;
+}
+
+int grpc_msg_decompressor_next(grpc_msg_decompressor* d, grpc_slice* output) {
+  if (d->state != 0) return d->state == 1 ? 0 : -1;
+  if (d->algorithm == GRPC_MESSAGE_COMPRESS_NONE) {
+    if (!decompressor_has_input(d)) {
+      d->state = 1;
+      return 0;
+    }
+    while (GRPC_SLICE_LENGTH(d->input->slices[d->input_index]) == 0) {
+      d->input_index++;
+    }
+    const size_t length = GRPC_SLICE_LENGTH(d->input->slices[d->input_index]);
+    if (length > d->max_output_length - d->output_length) {
+      return decompressor_exceeded(d);
+    }
+    d->output_length += length;
+    *output = grpc_slice_ref_internal(d->input->slices[d->input_index++]);
+    return 1;
+  }
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(DECOMPRESSOR_OUTPUT_SIZE);
+  size_t produced;
+  const int r = grpc_msg_decompressor_read(d, GRPC_SLICE_START_PTR(outbuf),
+                                           DECOMPRESSOR_OUTPUT_SIZE, &produced);
+  if (r != 1) {
+    grpc_slice_unref_internal(outbuf);
+    return r;
+  }
+  *output = trim_outbuf(outbuf, produced);
+  return 1;
+}
+
+int grpc_msg_decompressor_read(grpc_msg_decompressor* d, uint8_t* output,
+                               size_t size, size_t* length) {
+  GPR_ASSERT(size > 0);
+  *length = 0;
+  if (d->state != 0) return d->state == 1 ? 0 : -1;
+  /* decompress at most one byte past the budget: enough to tell that the
+     message exceeds it, without spending more on a message that does */
+  const size_t budget = d->max_output_length - d->output_length;
+  if (budget < size) size = budget + 1;
+  int ok;
+  switch (d->algorithm) {
+    case GRPC_MESSAGE_COMPRESS_DEFLATE:
+    case GRPC_MESSAGE_COMPRESS_GZIP:
+      ok = zlib_decompress_next(d, output, size, length);
+      break;
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+      ok = zstd_decompress_next(d, output, size, length);
+      break;
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      ok = lz4_decompress_next(d, output, size, length);
+      break;
+    default:
+      ok = copy_next(d, output, size, length);
+      break;
+  }
+  if (!ok) {
+    d->state = -1;
+    *length = 0;
+    return -1;
+  }
+  if (*length > budget) {
+    *length = 0;
+    return decompressor_exceeded(d);
+  }
+  d->output_length += *length;
+  if (*length == 0) {
+    /* the previous read ended exactly where the message does */
+    GPR_ASSERT(d->state == 1);
+    return 0;
+  }
+  return 1;
+}
+
+int grpc_msg_decompressor_exceeded_limit(grpc_msg_decompressor* d) {
+  return d->exceeded_limit;
+}
+
+void grpc_msg_decompressor_destroy(grpc_msg_decompressor* d) {
+  if (d->zs != nullptr) {
+    grpc_inflate_stream_release(d->zs,
+                                d->algorithm == GRPC_MESSAGE_COMPRESS_GZIP);
+  }
+  if (d->dctx != nullptr) grpc_zstd_dctx_release(d->dctx);
+  if (d->lz4_dctx != nullptr) grpc_lz4_dctx_release(d->lz4_dctx);
+  if (d->dictionary != nullptr) grpc_zstd_dictionary_unref(d->dictionary);
+  gpr_free(d);
+}
+
+/* the global stats of the messages compressed or decompressed with one
+   algorithm */
+typedef struct {
+  grpc_stats_counters input_bytes;
+  grpc_stats_counters output_bytes;
+  grpc_stats_counters micros;
+  /* GRPC_STATS_COUNTER_COUNT for decompression */
+  grpc_stats_counters not_smaller;
+  /* ratio of the uncompressed to the compressed size, in tenths */
+  grpc_stats_histograms ratio;
+} algorithm_stats;
+
+static const algorithm_stats
+    compression_stats[GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT] = {
+        {GRPC_STATS_COUNTER_COUNT, GRPC_STATS_COUNTER_COUNT,
+         GRPC_STATS_COUNTER_COUNT, GRPC_STATS_COUNTER_COUNT,
+         GRPC_STATS_HISTOGRAM_COUNT},
+        {GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_INPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_OUTPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_MICROS,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_NOT_SMALLER,
+         GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_DEFLATE_RATIO},
+        {GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_INPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_OUTPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_MICROS,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_NOT_SMALLER,
+         GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_GZIP_RATIO},
+        {GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_INPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_OUTPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_MICROS,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_NOT_SMALLER,
+         GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_ZSTD_RATIO},
+        {GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_INPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_OUTPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_MICROS,
+         GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_NOT_SMALLER,
+         GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_LZ4_RATIO},
+};
+
+static const algorithm_stats
+    decompression_stats[GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT] = {
+        {GRPC_STATS_COUNTER_COUNT, GRPC_STATS_COUNTER_COUNT,
+         GRPC_STATS_COUNTER_COUNT, GRPC_STATS_COUNTER_COUNT,
+         GRPC_STATS_HISTOGRAM_COUNT},
+        {GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_DEFLATE_INPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_DEFLATE_OUTPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_DEFLATE_MICROS,
+         GRPC_STATS_COUNTER_COUNT,
+         GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_DEFLATE_RATIO},
+        {GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_GZIP_INPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_GZIP_OUTPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_GZIP_MICROS,
+         GRPC_STATS_COUNTER_COUNT,
+         GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_GZIP_RATIO},
+        {GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_ZSTD_INPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_ZSTD_OUTPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_ZSTD_MICROS,
+         GRPC_STATS_COUNTER_COUNT,
+         GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_ZSTD_RATIO},
+        {GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LZ4_INPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LZ4_OUTPUT_BYTES,
+         GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LZ4_MICROS,
+         GRPC_STATS_COUNTER_COUNT,
+         GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_LZ4_RATIO},
+};
+
+static void record_stats(const algorithm_stats* stats,
+                         size_t uncompressed_bytes, size_t compressed_bytes,
+                         int64_t micros) {
+  GRPC_STATS_ADD_COUNTER(stats->micros, micros);
+  if (compressed_bytes > 0) {
+    grpc_stats_inc_histogram[stats->ratio](static_cast<int>(
+        GPR_MIN(uncompressed_bytes * 10 / compressed_bytes, 1024)));
+  }
+}
+
+void grpc_msg_compress_record_stats(
+    grpc_message_compression_algorithm algorithm, size_t input_bytes,
+    size_t output_bytes, int64_t micros) {
+  if (algorithm >= GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT) return;
+  const algorithm_stats* stats = &compression_stats[algorithm];
+  if (stats->ratio == GRPC_STATS_HISTOGRAM_COUNT) return;
+  GRPC_STATS_ADD_COUNTER(stats->input_bytes, input_bytes);
+  GRPC_STATS_ADD_COUNTER(stats->output_bytes, output_bytes);
+  if (output_bytes >= input_bytes) {
+    GRPC_STATS_INC_COUNTER(stats->not_smaller);
+  }
+  record_stats(stats, input_bytes, output_bytes, micros);
+}
+
+void grpc_msg_decompress_record_stats(
+    grpc_message_compression_algorithm algorithm, size_t input_bytes,
+    size_t output_bytes, int64_t micros) {
+  if (algorithm >= GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT) return;
+  const algorithm_stats* stats = &decompression_stats[algorithm];
+  if (stats->ratio == GRPC_STATS_HISTOGRAM_COUNT) return;
+  GRPC_STATS_ADD_COUNTER(stats->input_bytes, input_bytes);
+  GRPC_STATS_ADD_COUNTER(stats->output_bytes, output_bytes);
+  record_stats(stats, output_bytes, input_bytes, micros);
+}
@@ -21,20 +21,179 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <grpc/compression.h>
 #include <grpc/slice_buffer.h>
 
 #include "src/core/lib/compression/compression_internal.h"
 
+/* options of grpc_msg_compress_with_options. */
+typedef struct grpc_msg_compress_options {
+  /* algorithm specific compression level. Only zstd currently honors it; the
+     other algorithms use their default level. */
+  int level;
+  /* zstd messages are compressed with this dictionary when it is not NULL.
+     Other algorithms ignore it. */
+  grpc_zstd_dictionary* dictionary;
+  /* when positive, zstd messages are compressed on up to this many zstd worker
+     threads. The calling thread blocks until the whole message is compressed,
+     and the output is a regular zstd frame. Falls back to compressing on the
+     calling thread when zstd was built without multi-threading support. */
+  int workers;
+  /* when positive, zstd messages are compressed with a window of
+     2^window_log_max bytes, or of the message size if that is smaller. Bounds
+     the memory that compressing and decompressing the message takes. */
+  int window_log_max;
+} grpc_msg_compress_options;
+
+/* sets 'options' to the defaults, which grpc_msg_compress uses: the default
+   zstd level, and none of the other options. */
+void grpc_msg_compress_options_init(grpc_msg_compress_options* options);
+
 /* compress 'input' to 'output' using 'algorithm'.
    On success, appends compressed slices to output and returns 1.
    On failure, appends uncompressed slices to output and returns 0. */
 int grpc_msg_compress(grpc_message_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+/* as grpc_msg_compress, with 'options'. */
+int grpc_msg_compress_with_options(grpc_message_compression_algorithm algorithm,
+                                   const grpc_msg_compress_options* options,
+                                   grpc_slice_buffer* input,
+                                   grpc_slice_buffer* output);
+
+/* estimates the memory, in bytes, that compressing a message of 'length'
+   bytes with 'options' takes: the compressor's history window and tables, and
+   the output. Meant to be charged to a resource quota before compressing. */
+size_t grpc_msg_compress_memory_estimate(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_compress_options* options, size_t length);
+
+/* estimates whether compressing 'input' would save at least
+   'min_savings_percent' percent of its size, by compressing samples of it.
+   Returns 1 when compression looks worthwhile, and also when 'input' is too
+   small to be worth probing or 'min_savings_percent' is not positive. */
+int grpc_msg_is_compressible(const grpc_slice_buffer* input,
+                             int min_savings_percent);
+
+/* incremental compression of a message that is produced a piece at a time,
+   such as while it is serialized, so that it is never held uncompressed in
+   full. */
+typedef struct grpc_msg_compressor grpc_msg_compressor;
+
+/* returns a compressor of a message into 'algorithm' with 'options', or NULL
+   if 'algorithm' does not compress. options->workers is ignored; a zstd
+   dictionary in 'options' must outlive the compressor. */
+grpc_msg_compressor* grpc_msg_compressor_create(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_compress_options* options);
+
+/* compresses the next 'length' bytes of the message from 'input', which may
+   be reused as soon as this returns, appending the compressed output that is
+   ready to 'output'. Returns 1 on success and 0 on failure; every later call
+   fails as well. */
+int grpc_msg_compressor_write(grpc_msg_compressor* compressor,
+                              const uint8_t* input, size_t length,
+                              grpc_slice_buffer* output);
+
+/* ends the message, appending the rest of the compressed output to 'output'.
+   Returns 1 on success and 0 on failure. Unlike grpc_msg_compress, the output
+   is complete even when it is not smaller than the message. */
+int grpc_msg_compressor_finish(grpc_msg_compressor* compressor,
+                               grpc_slice_buffer* output);
+
+void grpc_msg_compressor_destroy(grpc_msg_compressor* compressor);
+
+/* options of grpc_msg_decompress_with_options and
+   grpc_msg_decompressor_create. */
+typedef struct grpc_msg_decompress_options {
+  /* decompressing a message to more than this many bytes fails. SIZE_MAX for
+     no limit. */
+  size_t max_output_length;
+  /* when positive, zstd frames that need a window of more than
+     2^window_log_max bytes fail to decompress, whatever frames precede them.
+     Frames small enough for zstd to decompress straight into the output need
+     no window, and are accepted. */
+  int window_log_max;
+} grpc_msg_decompress_options;
+
+/* sets 'options' to the defaults, which grpc_msg_decompress uses: no limit
+   on the output, and zstd's own window cap. */
+void grpc_msg_decompress_options_init(grpc_msg_decompress_options* options);
+
 /* decompress 'input' to 'output' using 'algorithm'.
    On success, appends slices to output and returns 1.
-   On failure, output is unchanged, and returns 0. */
+   On failure, output is unchanged, and returns 0.
+   zstd frames compressed with a dictionary are decompressed with the loaded
+   dictionary of the same ID, and fail if there is none. */
 int grpc_msg_decompress(grpc_message_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+/* as grpc_msg_decompress, with 'options'. Returns -1, leaving output
+   unchanged, if the decompressed message would be longer than
+   options->max_output_length bytes. Decompression stops as soon as the output
+   exceeds the limit, or before it starts when the frame header declares a
+   larger content size, so a small hostile message costs neither the memory
+   nor the CPU of decompressing it whole. */
+int grpc_msg_decompress_with_options(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_decompress_options* options, grpc_slice_buffer* input,
+    grpc_slice_buffer* output);
+
+/* estimates the memory, in bytes, that decompressing 'input' with 'options'
+   takes: the decompressor's history window and the output, whose size is the
+   one a zstd frame declares or else a typical ratio of the input, within
+   options->max_output_length. Meant to be charged to a resource quota before
+   decompressing. */
+size_t grpc_msg_decompress_memory_estimate(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_decompress_options* options, grpc_slice_buffer* input);
+
+/* incremental decompression of a message, for readers that consume it a slice
+   at a time and should not hold all of it decompressed at once. */
+typedef struct grpc_msg_decompressor grpc_msg_decompressor;
+
+/* returns a decompressor of 'input', which must stay unchanged until the
+   decompressor is destroyed, or NULL if 'input' is known up front not to be
+   decompressible with 'algorithm' (such as zstd frames compressed with a
+   dictionary that is not loaded). */
+grpc_msg_decompressor* grpc_msg_decompressor_create(
+    grpc_message_compression_algorithm algorithm,
+    const grpc_msg_decompress_options* options, grpc_slice_buffer* input);
+
+/* decompresses the next part of the message into a new slice in 'output'.
+   Returns 1 on success, 0 at the end of the message, and -1 if the rest of
+   the input cannot be decompressed or the message turns out longer than
+   options->max_output_length; every later call returns the same. Never
+   decompresses more than one byte past that limit. */
+int grpc_msg_decompressor_next(grpc_msg_decompressor* decompressor,
+                               grpc_slice* output);
+
+/* as grpc_msg_decompressor_next, decompressing up to 'size' bytes into
+   'output' and storing how many were written in '*length'. Lets a reader
+   decompress every part of a message into the same memory, which stays in
+   the CPU caches while it is consumed. */
+int grpc_msg_decompressor_read(grpc_msg_decompressor* decompressor,
+                               uint8_t* output, size_t size, size_t* length);
+
+/* returns 1 if the decompressor failed because the message is longer than
+   options->max_output_length, rather than because it is corrupt. */
+int grpc_msg_decompressor_exceeded_limit(grpc_msg_decompressor* decompressor);
+
+void grpc_msg_decompressor_destroy(grpc_msg_decompressor* decompressor);
+
+/* records in the global stats that a message of 'input_bytes' was compressed
+   with 'algorithm' into 'output_bytes' in 'micros' microseconds. Messages
+   sent uncompressed because compression did not make them smaller are
+   recorded with 'output_bytes' equal to 'input_bytes'. Requires an ExecCtx. */
+void grpc_msg_compress_record_stats(
+    grpc_message_compression_algorithm algorithm, size_t input_bytes,
+    size_t output_bytes, int64_t micros);
+
+/* records in the global stats that a message of 'input_bytes' was
+   decompressed with 'algorithm' into 'output_bytes' in 'micros' microseconds.
+   Requires an ExecCtx. */
+void grpc_msg_decompress_record_stats(
+    grpc_message_compression_algorithm algorithm, size_t input_bytes,
+    size_t output_bytes, int64_t micros);
+
 #endif /* GRPC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H */
@@ -22,6 +22,7 @@
 
 #include "src/core/lib/compression/stream_compression.h"
 #include "src/core/lib/compression/stream_compression_gzip.h"
+#include "src/core/lib/compression/stream_compression_zstd.h"
 #include "src/core/lib/slice/slice_utils.h"
 
 extern const grpc_stream_compression_vtable
@@ -52,6 +53,9 @@ grpc_stream_compression_context* grpc_stream_compression_context_create(
     case GRPC_STREAM_COMPRESSION_GZIP_COMPRESS:
     case GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS:
       return grpc_stream_compression_gzip_vtable.context_create(method);
+    case GRPC_STREAM_COMPRESSION_ZSTD_COMPRESS:
+    case GRPC_STREAM_COMPRESSION_ZSTD_DECOMPRESS:
+      return grpc_stream_compression_zstd_vtable.context_create(method);
     default:
       gpr_log(GPR_ERROR, "Unknown stream compression method: %d", method);
       return nullptr;
@@ -74,6 +78,10 @@ int grpc_stream_compression_method_parse(
     *method = is_compress ? GRPC_STREAM_COMPRESSION_GZIP_COMPRESS
                           : GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS;
     return 1;
+  } else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_ZSTD)) {
+    *method = is_compress ? GRPC_STREAM_COMPRESSION_ZSTD_COMPRESS
+                          : GRPC_STREAM_COMPRESSION_ZSTD_DECOMPRESS;
+    return 1;
   } else {
     return 0;
   }
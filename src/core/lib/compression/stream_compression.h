@@ -40,6 +40,8 @@ typedef enum grpc_stream_compression_method {
   GRPC_STREAM_COMPRESSION_IDENTITY_DECOMPRESS,
   GRPC_STREAM_COMPRESSION_GZIP_COMPRESS,
   GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS,
+  GRPC_STREAM_COMPRESSION_ZSTD_COMPRESS,
+  GRPC_STREAM_COMPRESSION_ZSTD_DECOMPRESS,
   GRPC_STREAM_COMPRESSION_METHOD_COUNT
 } grpc_stream_compression_method;
 
@@ -84,9 +86,9 @@ bool grpc_stream_compress(grpc_stream_compression_context* ctx,
 /**
  * Decompress bytes provided in \a in with a given context. Emits at most \a
  * max_output_size decompressed bytes into \a out. If decompression process
- * reached the end of a gzip stream, \a end_of_context is set to true; otherwise
- * it is set to false. The total number of bytes emitted is outputted in \a
- * output_size.
+ * reached the end of a gzip stream or zstd frame, \a end_of_context is set to
+ * true; otherwise it is set to false. The total number of bytes emitted is
+ * outputted in \a output_size.
  */
 bool grpc_stream_decompress(grpc_stream_compression_context* ctx,
                             grpc_slice_buffer* in, grpc_slice_buffer* out,
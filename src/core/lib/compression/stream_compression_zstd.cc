@@ -0,0 +1,234 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/compression/stream_compression_zstd.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+
+#include <zstd.h>
+
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/context_pool.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
+
+#define OUTPUT_BLOCK_SIZE (4096)
+
+/* A whole HTTP/2 stream is a single zstd frame: every message is compressed
+ * against the ones before it. SYNC flushes end a zstd block, which makes all
+ * the data so far decodable, and FINISH ends the frame. */
+typedef struct grpc_stream_compression_context_zstd {
+  grpc_stream_compression_context base;
+
+  /* Exactly one of cctx and dctx is set. */
+  ZSTD_CCtx* cctx;
+  ZSTD_DCtx* dctx;
+  /* Whether the decompression context may hold decompressed bytes that did not
+   * fit in the previous output. */
+  bool pending_output;
+} grpc_stream_compression_context_zstd;
+
+/* Appends the used part of slice_out to out. */
+static void zstd_add_output(grpc_slice slice_out, size_t used,
+                            grpc_slice_buffer* out) {
+  if (used == 0) {
+    grpc_slice_unref_internal(slice_out);
+    return;
+  }
+  GRPC_SLICE_SET_LENGTH(slice_out, used);
+  grpc_slice_buffer_add(out, slice_out);
+}
+
+/* Drops the first consumed bytes of the first slice of in. */
+static void zstd_consume_input(grpc_slice_buffer* in, size_t consumed) {
+  grpc_slice* slice = grpc_slice_buffer_peek_first(in);
+  if (consumed < GRPC_SLICE_LENGTH(*slice)) {
+    grpc_slice_buffer_sub_first(in, consumed, GRPC_SLICE_LENGTH(*slice));
+  } else {
+    grpc_slice_buffer_remove_first(in);
+  }
+}
+
+static bool grpc_stream_compress_zstd(grpc_stream_compression_context* ctx,
+                                      grpc_slice_buffer* in,
+                                      grpc_slice_buffer* out,
+                                      size_t* output_size,
+                                      size_t max_output_size,
+                                      grpc_stream_compression_flush flush) {
+  if (ctx == nullptr) {
+    return false;
+  }
+  grpc_stream_compression_context_zstd* zstd_ctx =
+      reinterpret_cast<grpc_stream_compression_context_zstd*>(ctx);
+  GPR_ASSERT(zstd_ctx->cctx != nullptr);
+  ZSTD_EndDirective end;
+  switch (flush) {
+    case GRPC_STREAM_COMPRESSION_FLUSH_SYNC:
+      end = ZSTD_e_flush;
+      break;
+    case GRPC_STREAM_COMPRESSION_FLUSH_FINISH:
+      end = ZSTD_e_end;
+      break;
+    default:
+      end = ZSTD_e_continue;
+  }
+
+  grpc_core::ExecCtx exec_ctx;
+  const size_t original_max_output_size = max_output_size;
+  bool done = false;
+  while (max_output_size > 0 && !done) {
+    const size_t slice_size = GPR_MIN(max_output_size, OUTPUT_BLOCK_SIZE);
+    grpc_slice slice_out = GRPC_SLICE_MALLOC(slice_size);
+    ZSTD_outBuffer output = {GRPC_SLICE_START_PTR(slice_out), slice_size, 0};
+    while (output.pos < output.size && !done) {
+      size_t r;
+      if (in->length > 0) {
+        grpc_slice* slice = grpc_slice_buffer_peek_first(in);
+        ZSTD_inBuffer input = {GRPC_SLICE_START_PTR(*slice),
+                               GRPC_SLICE_LENGTH(*slice), 0};
+        r = ZSTD_compressStream2(zstd_ctx->cctx, &output, &input,
+                                 ZSTD_e_continue);
+        zstd_consume_input(in, input.pos);
+      } else if (end == ZSTD_e_continue) {
+        done = true;
+        break;
+      } else {
+        ZSTD_inBuffer input = {nullptr, 0, 0};
+        r = ZSTD_compressStream2(zstd_ctx->cctx, &output, &input, end);
+        /* 0 once everything is flushed. */
+        done = r == 0;
+      }
+      if (ZSTD_isError(r)) {
+        gpr_log(GPR_ERROR, "zstd error (%s)", ZSTD_getErrorName(r));
+        grpc_slice_unref_internal(slice_out);
+        return false;
+      }
+    }
+    zstd_add_output(slice_out, output.pos, out);
+    max_output_size -= output.pos;
+  }
+
+  if (output_size) {
+    *output_size = original_max_output_size - max_output_size;
+  }
+  return true;
+}
+
+static bool grpc_stream_decompress_zstd(grpc_stream_compression_context* ctx,
+                                        grpc_slice_buffer* in,
+                                        grpc_slice_buffer* out,
+                                        size_t* output_size,
+                                        size_t max_output_size,
+                                        bool* end_of_context) {
+  if (ctx == nullptr) {
+    return false;
+  }
+  grpc_stream_compression_context_zstd* zstd_ctx =
+      reinterpret_cast<grpc_stream_compression_context_zstd*>(ctx);
+  GPR_ASSERT(zstd_ctx->dctx != nullptr);
+
+  grpc_core::ExecCtx exec_ctx;
+  const size_t original_max_output_size = max_output_size;
+  bool eoc = false;
+  while (max_output_size > 0 && (in->length > 0 || zstd_ctx->pending_output) &&
+         !eoc) {
+    const size_t slice_size = GPR_MIN(max_output_size, OUTPUT_BLOCK_SIZE);
+    grpc_slice slice_out = GRPC_SLICE_MALLOC(slice_size);
+    ZSTD_outBuffer output = {GRPC_SLICE_START_PTR(slice_out), slice_size, 0};
+    while (output.pos < output.size &&
+           (in->length > 0 || zstd_ctx->pending_output) && !eoc) {
+      grpc_slice* slice =
+          in->length > 0 ? grpc_slice_buffer_peek_first(in) : nullptr;
+      ZSTD_inBuffer input = {nullptr, 0, 0};
+      if (slice != nullptr) {
+        input.src = GRPC_SLICE_START_PTR(*slice);
+        input.size = GRPC_SLICE_LENGTH(*slice);
+      }
+      size_t r = ZSTD_decompressStream(zstd_ctx->dctx, &output, &input);
+      if (ZSTD_isError(r)) {
+        gpr_log(GPR_ERROR, "zstd error (%s)", ZSTD_getErrorName(r));
+        grpc_slice_unref_internal(slice_out);
+        return false;
+      }
+      if (slice != nullptr) {
+        zstd_consume_input(in, input.pos);
+      }
+      /* 0 once a frame is completely decoded and flushed. */
+      eoc = r == 0;
+      zstd_ctx->pending_output = !eoc && output.pos == output.size;
+    }
+    zstd_add_output(slice_out, output.pos, out);
+    max_output_size -= output.pos;
+  }
+
+  if (end_of_context) {
+    *end_of_context = eoc;
+  }
+  if (output_size) {
+    *output_size = original_max_output_size - max_output_size;
+  }
+  return true;
+}
+
+static grpc_stream_compression_context*
+grpc_stream_compression_context_create_zstd(
+    grpc_stream_compression_method method) {
+  GPR_ASSERT(method == GRPC_STREAM_COMPRESSION_ZSTD_COMPRESS ||
+             method == GRPC_STREAM_COMPRESSION_ZSTD_DECOMPRESS);
+  grpc_stream_compression_context_zstd* zstd_ctx =
+      static_cast<grpc_stream_compression_context_zstd*>(
+          gpr_zalloc(sizeof(grpc_stream_compression_context_zstd)));
+  if (method == GRPC_STREAM_COMPRESSION_ZSTD_DECOMPRESS) {
+    zstd_ctx->dctx = grpc_zstd_dctx_acquire();
+  } else {
+    zstd_ctx->cctx = grpc_zstd_cctx_acquire();
+    size_t r = ZSTD_CCtx_setParameter(zstd_ctx->cctx, ZSTD_c_compressionLevel,
+                                      GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL);
+    if (ZSTD_isError(r)) {
+      grpc_zstd_cctx_release(zstd_ctx->cctx);
+      gpr_free(zstd_ctx);
+      return nullptr;
+    }
+  }
+
+  zstd_ctx->base.vtable = &grpc_stream_compression_zstd_vtable;
+  return reinterpret_cast<grpc_stream_compression_context*>(zstd_ctx);
+}
+
+static void grpc_stream_compression_context_destroy_zstd(
+    grpc_stream_compression_context* ctx) {
+  if (ctx == nullptr) {
+    return;
+  }
+  grpc_stream_compression_context_zstd* zstd_ctx =
+      reinterpret_cast<grpc_stream_compression_context_zstd*>(ctx);
+  if (zstd_ctx->dctx != nullptr) {
+    grpc_zstd_dctx_release(zstd_ctx->dctx);
+  } else {
+    grpc_zstd_cctx_release(zstd_ctx->cctx);
+  }
+  gpr_free(ctx);
+}
+
+const grpc_stream_compression_vtable grpc_stream_compression_zstd_vtable = {
+    grpc_stream_compress_zstd, grpc_stream_decompress_zstd,
+    grpc_stream_compression_context_create_zstd,
+    grpc_stream_compression_context_destroy_zstd};
@@ -0,0 +1,170 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/compression/zstd_dictionary.h"
+
+#include <map>
+#include <string>
+
+#include <grpc/support/log.h>
+#include <grpc/support/sync.h>
+
+#include <zdict.h>
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/surface/api_trace.h"
+
+struct grpc_zstd_dictionary {
+  grpc_zstd_dictionary(uint32_t id, ZSTD_DDict* ddict, const void* data,
+                       size_t size)
+      : id(id), ddict(ddict), data(static_cast<const char*>(data), size) {}
+
+  ~grpc_zstd_dictionary() {
+    for (const auto& p : cdicts) {
+      ZSTD_freeCDict(p.second);
+    }
+    ZSTD_freeDDict(ddict);
+  }
+
+  grpc_core::RefCount refs;
+  const uint32_t id;
+  ZSTD_DDict* const ddict;
+  /* the raw dictionary, from which the CDicts are created on demand */
+  const std::string data;
+  grpc_core::Mutex mu;
+  /* compression level -> CDict */
+  std::map<int, ZSTD_CDict*> cdicts;
+};
+
+namespace {
+
+gpr_once g_once = GPR_ONCE_INIT;
+grpc_core::Mutex* g_mu;
+/* Loaded dictionaries by ID. Entries do not hold a reference: they are erased
+ * by the last unref. */
+std::map<uint32_t, grpc_zstd_dictionary*>* g_dictionaries;
+
+void init_dictionaries() {
+  g_mu = new grpc_core::Mutex();
+  g_dictionaries = new std::map<uint32_t, grpc_zstd_dictionary*>();
+}
+
+void* dictionary_arg_copy(void* p) {
+  grpc_zstd_dictionary_ref(static_cast<grpc_zstd_dictionary*>(p));
+  return p;
+}
+
+void dictionary_arg_destroy(void* p) {
+  grpc_zstd_dictionary_unref(static_cast<grpc_zstd_dictionary*>(p));
+}
+
+int dictionary_arg_cmp(void* p, void* q) { return GPR_ICMP(p, q); }
+
+const grpc_arg_pointer_vtable dictionary_arg_vtable = {
+    dictionary_arg_copy, dictionary_arg_destroy, dictionary_arg_cmp};
+
+}  // namespace
+
+grpc_zstd_dictionary* grpc_zstd_dictionary_create(const void* data,
+                                                  size_t size) {
+  GRPC_API_TRACE("grpc_zstd_dictionary_create(data=%p, size=%" PRIuPTR ")", 2,
+                 (data, size));
+  /* Raw content dictionaries have no ID, so a receiver could not tell which
+   * dictionary a frame needs: only accept trained ones. */
+  const uint32_t id = ZDICT_getDictID(data, size);
+  if (id == 0) return nullptr;
+  gpr_once_init(&g_once, init_dictionaries);
+  {
+    grpc_core::MutexLock lock(g_mu);
+    auto it = g_dictionaries->find(id);
+    if (it != g_dictionaries->end() && it->second->refs.RefIfNonZero()) {
+      return it->second;
+    }
+  }
+  ZSTD_DDict* ddict = ZSTD_createDDict(data, size);
+  if (ddict == nullptr) return nullptr;
+  grpc_zstd_dictionary* dictionary =
+      new grpc_zstd_dictionary(id, ddict, data, size);
+  grpc_core::MutexLock lock(g_mu);
+  auto it = g_dictionaries->find(id);
+  if (it != g_dictionaries->end() && it->second->refs.RefIfNonZero()) {
+    /* lost a race with another thread loading the same dictionary */
+    delete dictionary;
+    return it->second;
+  }
+  /* Replaces any entry whose last reference is being dropped concurrently;
+   * grpc_zstd_dictionary_unref() only erases the entry it owns. */
+  (*g_dictionaries)[id] = dictionary;
+  return dictionary;
+}
+
+void grpc_zstd_dictionary_ref(grpc_zstd_dictionary* dictionary) {
+  dictionary->refs.Ref();
+}
+
+void grpc_zstd_dictionary_unref(grpc_zstd_dictionary* dictionary) {
+  if (!dictionary->refs.Unref()) return;
+  {
+    grpc_core::MutexLock lock(g_mu);
+    auto it = g_dictionaries->find(dictionary->id);
+    if (it != g_dictionaries->end() && it->second == dictionary) {
+      g_dictionaries->erase(it);
+    }
+  }
+  delete dictionary;
+}
+
+const grpc_arg_pointer_vtable* grpc_zstd_dictionary_arg_vtable(void) {
+  return &dictionary_arg_vtable;
+}
+
+grpc_zstd_dictionary* grpc_zstd_dictionary_find(uint32_t id) {
+  gpr_once_init(&g_once, init_dictionaries);
+  grpc_core::MutexLock lock(g_mu);
+  auto it = g_dictionaries->find(id);
+  if (it == g_dictionaries->end() || !it->second->refs.RefIfNonZero()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
+uint32_t grpc_zstd_dictionary_id(const grpc_zstd_dictionary* dictionary) {
+  return dictionary->id;
+}
+
+const ZSTD_CDict* grpc_zstd_dictionary_cdict(grpc_zstd_dictionary* dictionary,
+                                             int level) {
+  level = GPR_CLAMP(level, ZSTD_minCLevel(), ZSTD_maxCLevel());
+  grpc_core::MutexLock lock(&dictionary->mu);
+  ZSTD_CDict*& cdict = dictionary->cdicts[level];
+  if (cdict == nullptr) {
+    cdict = ZSTD_createCDict(dictionary->data.data(), dictionary->data.size(),
+                             level);
+    GPR_ASSERT(cdict != nullptr);
+  }
+  return cdict;
+}
+
+const ZSTD_DDict* grpc_zstd_dictionary_ddict(
+    const grpc_zstd_dictionary* dictionary) {
+  return dictionary->ddict;
+}
@@ -0,0 +1,53 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_COMPRESSION_ZSTD_DICTIONARY_H
+#define GRPC_CORE_LIB_COMPRESSION_ZSTD_DICTIONARY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <grpc/compression.h>
+
+#include <zstd.h>
+
+/* Digested zstd dictionaries, shared process-wide.
+ *
+ * A dictionary is identified by the ID recorded in its header, which zstd also
+ * writes into the header of every frame compressed with it. Receivers find the
+ * dictionary for a frame by that ID, so the same dictionary must be loaded on
+ * both ends. Creating a dictionary whose ID is already loaded returns the
+ * existing object, so each dictionary is digested once per process no matter
+ * how many channels use it. */
+
+/** Returns a new reference to the loaded dictionary with ID \a id, or NULL if
+ * no dictionary with that ID is currently loaded. */
+grpc_zstd_dictionary* grpc_zstd_dictionary_find(uint32_t id);
+
+/** Returns the ID of \a dictionary (never 0). */
+uint32_t grpc_zstd_dictionary_id(const grpc_zstd_dictionary* dictionary);
+
+/** Returns \a dictionary digested for compression at \a level. The CDict is
+ * created on first use and owned by \a dictionary. */
+const ZSTD_CDict* grpc_zstd_dictionary_cdict(grpc_zstd_dictionary* dictionary,
+                                             int level);
+
+/** Returns \a dictionary digested for decompression. */
+const ZSTD_DDict* grpc_zstd_dictionary_ddict(
+    const grpc_zstd_dictionary* dictionary);
+
+#endif /* GRPC_CORE_LIB_COMPRESSION_ZSTD_DICTIONARY_H */
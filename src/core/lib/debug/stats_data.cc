@@ -124,6 +124,42 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "cq_ev_queue_trylock_failures",
     "cq_ev_queue_trylock_successes",
     "cq_ev_queue_transient_pop_failures",
+    "message_compression_compressed",
+    "message_compression_skipped_small",
+    "message_compression_skipped_incompressible",
+    "message_compression_not_smaller",
+    "message_compression_deflate_input_bytes",
+    "message_compression_deflate_output_bytes",
+    "message_compression_deflate_micros",
+    "message_compression_deflate_not_smaller",
+    "message_compression_gzip_input_bytes",
+    "message_compression_gzip_output_bytes",
+    "message_compression_gzip_micros",
+    "message_compression_gzip_not_smaller",
+    "message_compression_zstd_input_bytes",
+    "message_compression_zstd_output_bytes",
+    "message_compression_zstd_micros",
+    "message_compression_zstd_not_smaller",
+    "message_decompression_deflate_input_bytes",
+    "message_decompression_deflate_output_bytes",
+    "message_decompression_deflate_micros",
+    "message_decompression_gzip_input_bytes",
+    "message_decompression_gzip_output_bytes",
+    "message_decompression_gzip_micros",
+    "message_decompression_zstd_input_bytes",
+    "message_decompression_zstd_output_bytes",
+    "message_decompression_zstd_micros",
+    "message_compression_lz4_input_bytes",
+    "message_compression_lz4_output_bytes",
+    "message_compression_lz4_micros",
+    "message_compression_lz4_not_smaller",
+    "message_decompression_lz4_input_bytes",
+    "message_decompression_lz4_output_bytes",
+    "message_decompression_lz4_micros",
+    "message_compression_skipped_memory_pressure",
+    "message_compression_level_lowered_memory_pressure",
+    "message_decompression_window_rejected",
+    "message_decompression_limit_exceeded",
 };
 const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of client side calls created by this process",
@@ -251,6 +287,55 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "queue.",
     "Number of times NULL was popped out of completion queue's event queue "
     "even though the event queue was not empty",
+    "Number of messages sent compressed",
+    "Number of messages sent uncompressed because they were smaller than the "
+    "minimum message size for compression",
+    "Number of messages sent uncompressed because compressing samples of them "
+    "saved too little",
+    "Number of messages compressed and then sent uncompressed because "
+    "compression did not make them smaller",
+    "Number of bytes of messages compressed with deflate, before compression",
+    "Number of bytes of messages compressed with deflate, after compression",
+    "Number of microseconds spent compressing messages with deflate",
+    "Number of messages compressed with deflate and then sent uncompressed "
+    "because compression did not make them smaller",
+    "Number of bytes of messages compressed with gzip, before compression",
+    "Number of bytes of messages compressed with gzip, after compression",
+    "Number of microseconds spent compressing messages with gzip",
+    "Number of messages compressed with gzip and then sent uncompressed "
+    "because compression did not make them smaller",
+    "Number of bytes of messages compressed with zstd, before compression",
+    "Number of bytes of messages compressed with zstd, after compression",
+    "Number of microseconds spent compressing messages with zstd",
+    "Number of messages compressed with zstd and then sent uncompressed "
+    "because compression did not make them smaller",
+    "Number of bytes of messages decompressed with deflate, before "
+    "decompression",
+    "Number of bytes of messages decompressed with deflate, after "
+    "decompression",
+    "Number of microseconds spent decompressing messages with deflate",
+    "Number of bytes of messages decompressed with gzip, before decompression",
+    "Number of bytes of messages decompressed with gzip, after decompression",
+    "Number of microseconds spent decompressing messages with gzip",
+    "Number of bytes of messages decompressed with zstd, before decompression",
+    "Number of bytes of messages decompressed with zstd, after decompression",
+    "Number of microseconds spent decompressing messages with zstd",
+    "Number of bytes of messages compressed with lz4, before compression",
+    "Number of bytes of messages compressed with lz4, after compression",
+    "Number of microseconds spent compressing messages with lz4",
+    "Number of messages compressed with lz4 and then sent uncompressed because "
+    "compression did not make them smaller",
+    "Number of bytes of messages decompressed with lz4, before decompression",
+    "Number of bytes of messages decompressed with lz4, after decompression",
+    "Number of microseconds spent decompressing messages with lz4",
+    "Number of messages sent uncompressed because the resource quota could not "
+    "afford compressing them",
+    "Number of zstd messages compressed at the fastest level because of memory "
+    "pressure on the resource quota",
+    "Number of received zstd frames that failed to decompress because their "
+    "window exceeds the channel's cap",
+    "Number of received messages rejected because they decompress to more than "
+    "the channel's limit",
 };
 const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
     "call_initial_size",
@@ -266,6 +351,14 @@ const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
     "http2_send_trailing_metadata_per_write",
     "http2_send_flowctl_per_write",
     "server_cqs_checked",
+    "message_compression_deflate_ratio",
+    "message_compression_gzip_ratio",
+    "message_compression_zstd_ratio",
+    "message_decompression_deflate_ratio",
+    "message_decompression_gzip_ratio",
+    "message_decompression_zstd_ratio",
+    "message_compression_lz4_ratio",
+    "message_decompression_lz4_ratio",
 };
 const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Initial size of the grpc_call arena created at call start",
@@ -282,6 +375,22 @@ const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Number of flow control updates written per TCP write",
     "How many completion queues were checked looking for a CQ that had "
     "requested the incoming call",
+    "Ratio of the sizes of messages compressed with deflate before and after "
+    "compression, in tenths",
+    "Ratio of the sizes of messages compressed with gzip before and after "
+    "compression, in tenths",
+    "Ratio of the sizes of messages compressed with zstd before and after "
+    "compression, in tenths",
+    "Ratio of the sizes of messages decompressed with deflate after and before "
+    "decompression, in tenths",
+    "Ratio of the sizes of messages decompressed with gzip after and before "
+    "decompression, in tenths",
+    "Ratio of the sizes of messages decompressed with zstd after and before "
+    "decompression, in tenths",
+    "Ratio of the sizes of messages compressed with lz4 before and after "
+    "compression, in tenths",
+    "Ratio of the sizes of messages decompressed with lz4 after and before "
+    "decompression, in tenths",
 };
 const int grpc_stats_table_0[65] = {
     0,      1,      2,      3,      4,     5,     7,     9,     11,    14,
@@ -661,17 +770,221 @@ void grpc_stats_inc_server_cqs_checked(int value) {
       GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
       grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 8));
 }
-const int grpc_stats_histo_buckets[13] = {64, 128, 64, 64, 64, 64, 64,
-                                          64, 64,  64, 64, 64, 8};
-const int grpc_stats_histo_start[13] = {0,   64,  192, 256, 320, 384, 448,
-                                        512, 576, 640, 704, 768, 832};
-const int* const grpc_stats_histo_bucket_boundaries[13] = {
+void grpc_stats_inc_message_compression_deflate_ratio(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_DEFLATE_RATIO, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_DEFLATE_RATIO, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_DEFLATE_RATIO,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
+void grpc_stats_inc_message_compression_gzip_ratio(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_GZIP_RATIO, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_GZIP_RATIO, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_GZIP_RATIO,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
+void grpc_stats_inc_message_compression_zstd_ratio(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_ZSTD_RATIO, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_ZSTD_RATIO, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_ZSTD_RATIO,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
+void grpc_stats_inc_message_decompression_deflate_ratio(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_DEFLATE_RATIO, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_DEFLATE_RATIO, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_DEFLATE_RATIO,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
+void grpc_stats_inc_message_decompression_gzip_ratio(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_GZIP_RATIO, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_GZIP_RATIO, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_GZIP_RATIO,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
+void grpc_stats_inc_message_decompression_zstd_ratio(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_ZSTD_RATIO, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_ZSTD_RATIO, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_ZSTD_RATIO,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
+void grpc_stats_inc_message_compression_lz4_ratio(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_LZ4_RATIO, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_LZ4_RATIO, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_LZ4_RATIO,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
+void grpc_stats_inc_message_decompression_lz4_ratio(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_LZ4_RATIO, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_LZ4_RATIO, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_LZ4_RATIO,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
+const int grpc_stats_histo_buckets[21] = {64, 128, 64, 64, 64, 64, 64, 64, 64,
+                                          64, 64,  64, 8,  64, 64, 64, 64, 64,
+                                          64, 64,  64};
+const int grpc_stats_histo_start[21] = {0,   64,  192,  256,  320,  384,  448,
+                                        512, 576, 640,  704,  768,  832,  840,
+                                        904, 968, 1032, 1096, 1160, 1224, 1288};
+const int* const grpc_stats_histo_bucket_boundaries[21] = {
     grpc_stats_table_0, grpc_stats_table_2, grpc_stats_table_4,
     grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_4,
     grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_6,
     grpc_stats_table_6, grpc_stats_table_6, grpc_stats_table_6,
-    grpc_stats_table_8};
-void (*const grpc_stats_inc_histogram[13])(int x) = {
+    grpc_stats_table_8, grpc_stats_table_6, grpc_stats_table_6,
+    grpc_stats_table_6, grpc_stats_table_6, grpc_stats_table_6,
+    grpc_stats_table_6, grpc_stats_table_6, grpc_stats_table_6};
+void (*const grpc_stats_inc_histogram[21])(int x) = {
     grpc_stats_inc_call_initial_size,
     grpc_stats_inc_poll_events_returned,
     grpc_stats_inc_tcp_write_size,
@@ -684,4 +997,12 @@ void (*const grpc_stats_inc_histogram[13])(int x) = {
     grpc_stats_inc_http2_send_message_per_write,
     grpc_stats_inc_http2_send_trailing_metadata_per_write,
     grpc_stats_inc_http2_send_flowctl_per_write,
-    grpc_stats_inc_server_cqs_checked};
+    grpc_stats_inc_server_cqs_checked,
+    grpc_stats_inc_message_compression_deflate_ratio,
+    grpc_stats_inc_message_compression_gzip_ratio,
+    grpc_stats_inc_message_compression_zstd_ratio,
+    grpc_stats_inc_message_decompression_deflate_ratio,
+    grpc_stats_inc_message_decompression_gzip_ratio,
+    grpc_stats_inc_message_decompression_zstd_ratio,
+    grpc_stats_inc_message_compression_lz4_ratio,
+    grpc_stats_inc_message_decompression_lz4_ratio};
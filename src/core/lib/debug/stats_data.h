@@ -125,6 +125,42 @@ typedef enum {
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_FAILURES,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_SUCCESSES,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_COMPRESSED,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_SKIPPED_SMALL,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_SKIPPED_INCOMPRESSIBLE,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_NOT_SMALLER,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_INPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_OUTPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_MICROS,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_NOT_SMALLER,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_INPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_OUTPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_MICROS,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_NOT_SMALLER,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_INPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_OUTPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_MICROS,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_NOT_SMALLER,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_DEFLATE_INPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_DEFLATE_OUTPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_DEFLATE_MICROS,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_GZIP_INPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_GZIP_OUTPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_GZIP_MICROS,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_ZSTD_INPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_ZSTD_OUTPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_ZSTD_MICROS,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_INPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_OUTPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_MICROS,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_NOT_SMALLER,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LZ4_INPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LZ4_OUTPUT_BYTES,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LZ4_MICROS,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_SKIPPED_MEMORY_PRESSURE,
+  GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LEVEL_LOWERED_MEMORY_PRESSURE,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_WINDOW_REJECTED,
+  GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LIMIT_EXCEEDED,
   GRPC_STATS_COUNTER_COUNT
 } grpc_stats_counters;
 extern const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT];
@@ -143,6 +179,14 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_DEFLATE_RATIO,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_GZIP_RATIO,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_ZSTD_RATIO,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_DEFLATE_RATIO,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_GZIP_RATIO,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_ZSTD_RATIO,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_LZ4_RATIO,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_LZ4_RATIO,
   GRPC_STATS_HISTOGRAM_COUNT
 } grpc_stats_histograms;
 extern const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT];
@@ -174,7 +218,23 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE_BUCKETS = 64,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_FIRST_SLOT = 832,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_BUCKETS = 8,
-  GRPC_STATS_HISTOGRAM_BUCKETS = 840
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_DEFLATE_RATIO_FIRST_SLOT = 840,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_DEFLATE_RATIO_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_GZIP_RATIO_FIRST_SLOT = 904,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_GZIP_RATIO_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_ZSTD_RATIO_FIRST_SLOT = 968,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_ZSTD_RATIO_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_DEFLATE_RATIO_FIRST_SLOT = 1032,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_DEFLATE_RATIO_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_GZIP_RATIO_FIRST_SLOT = 1096,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_GZIP_RATIO_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_ZSTD_RATIO_FIRST_SLOT = 1160,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_ZSTD_RATIO_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_LZ4_RATIO_FIRST_SLOT = 1224,
+  GRPC_STATS_HISTOGRAM_MESSAGE_COMPRESSION_LZ4_RATIO_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_LZ4_RATIO_FIRST_SLOT = 1288,
+  GRPC_STATS_HISTOGRAM_MESSAGE_DECOMPRESSION_LZ4_RATIO_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_BUCKETS = 1352
 } grpc_stats_histogram_constants;
 #if defined(GRPC_COLLECT_STATS) || !defined(NDEBUG)
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED() \
@@ -395,6 +455,102 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_SUCCESSES)
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_COMPRESSED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_COMPRESSED)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_SKIPPED_SMALL() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_SKIPPED_SMALL)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_SKIPPED_INCOMPRESSIBLE() \
+  GRPC_STATS_INC_COUNTER(                                           \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_SKIPPED_INCOMPRESSIBLE)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_NOT_SMALLER() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_NOT_SMALLER)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_INPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                        \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_INPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_OUTPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                         \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_OUTPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_MICROS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_MICROS)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_NOT_SMALLER() \
+  GRPC_STATS_INC_COUNTER(                                        \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_DEFLATE_NOT_SMALLER)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_INPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                     \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_INPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_OUTPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                      \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_OUTPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_MICROS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_MICROS)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_NOT_SMALLER() \
+  GRPC_STATS_INC_COUNTER(                                     \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_GZIP_NOT_SMALLER)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_INPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                     \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_INPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_OUTPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                      \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_OUTPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_MICROS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_MICROS)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_NOT_SMALLER() \
+  GRPC_STATS_INC_COUNTER(                                     \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_NOT_SMALLER)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_DEFLATE_INPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                          \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_DEFLATE_INPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_DEFLATE_OUTPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                           \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_DEFLATE_OUTPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_DEFLATE_MICROS() \
+  GRPC_STATS_INC_COUNTER(                                     \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_DEFLATE_MICROS)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_GZIP_INPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                       \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_GZIP_INPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_GZIP_OUTPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                        \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_GZIP_OUTPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_GZIP_MICROS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_GZIP_MICROS)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_ZSTD_INPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                       \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_ZSTD_INPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_ZSTD_OUTPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                        \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_ZSTD_OUTPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_ZSTD_MICROS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_ZSTD_MICROS)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_INPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_INPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_OUTPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                     \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_OUTPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_MICROS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_MICROS)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_NOT_SMALLER() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LZ4_NOT_SMALLER)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LZ4_INPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                      \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LZ4_INPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LZ4_OUTPUT_BYTES() \
+  GRPC_STATS_INC_COUNTER(                                       \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LZ4_OUTPUT_BYTES)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LZ4_MICROS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LZ4_MICROS)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_SKIPPED_MEMORY_PRESSURE() \
+  GRPC_STATS_INC_COUNTER(                                            \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_SKIPPED_MEMORY_PRESSURE)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LEVEL_LOWERED_MEMORY_PRESSURE() \
+  GRPC_STATS_INC_COUNTER(                                                  \
+      GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_LEVEL_LOWERED_MEMORY_PRESSURE)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_WINDOW_REJECTED() \
+  GRPC_STATS_INC_COUNTER(                                      \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_WINDOW_REJECTED)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LIMIT_EXCEEDED() \
+  GRPC_STATS_INC_COUNTER(                                     \
+      GRPC_STATS_COUNTER_MESSAGE_DECOMPRESSION_LIMIT_EXCEEDED)
 #define GRPC_STATS_INC_CALL_INITIAL_SIZE(value) \
   grpc_stats_inc_call_initial_size((int)(value))
 void grpc_stats_inc_call_initial_size(int x);
@@ -434,6 +590,30 @@ void grpc_stats_inc_http2_send_flowctl_per_write(int x);
 #define GRPC_STATS_INC_SERVER_CQS_CHECKED(value) \
   grpc_stats_inc_server_cqs_checked((int)(value))
 void grpc_stats_inc_server_cqs_checked(int x);
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_RATIO(value) \
+  grpc_stats_inc_message_compression_deflate_ratio((int)(value))
+void grpc_stats_inc_message_compression_deflate_ratio(int x);
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_RATIO(value) \
+  grpc_stats_inc_message_compression_gzip_ratio((int)(value))
+void grpc_stats_inc_message_compression_gzip_ratio(int x);
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_RATIO(value) \
+  grpc_stats_inc_message_compression_zstd_ratio((int)(value))
+void grpc_stats_inc_message_compression_zstd_ratio(int x);
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_DEFLATE_RATIO(value) \
+  grpc_stats_inc_message_decompression_deflate_ratio((int)(value))
+void grpc_stats_inc_message_decompression_deflate_ratio(int x);
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_GZIP_RATIO(value) \
+  grpc_stats_inc_message_decompression_gzip_ratio((int)(value))
+void grpc_stats_inc_message_decompression_gzip_ratio(int x);
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_ZSTD_RATIO(value) \
+  grpc_stats_inc_message_decompression_zstd_ratio((int)(value))
+void grpc_stats_inc_message_decompression_zstd_ratio(int x);
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_RATIO(value) \
+  grpc_stats_inc_message_compression_lz4_ratio((int)(value))
+void grpc_stats_inc_message_compression_lz4_ratio(int x);
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LZ4_RATIO(value) \
+  grpc_stats_inc_message_decompression_lz4_ratio((int)(value))
+void grpc_stats_inc_message_decompression_lz4_ratio(int x);
 #else
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED()
 #define GRPC_STATS_INC_SERVER_CALLS_CREATED()
@@ -533,6 +713,42 @@ void grpc_stats_inc_server_cqs_checked(int x);
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_FAILURES()
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_SUCCESSES()
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_COMPRESSED()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_SKIPPED_SMALL()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_SKIPPED_INCOMPRESSIBLE()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_NOT_SMALLER()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_INPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_OUTPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_MICROS()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_NOT_SMALLER()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_INPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_OUTPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_MICROS()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_NOT_SMALLER()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_INPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_OUTPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_MICROS()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_NOT_SMALLER()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_DEFLATE_INPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_DEFLATE_OUTPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_DEFLATE_MICROS()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_GZIP_INPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_GZIP_OUTPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_GZIP_MICROS()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_ZSTD_INPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_ZSTD_OUTPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_ZSTD_MICROS()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_INPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_OUTPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_MICROS()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_NOT_SMALLER()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LZ4_INPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LZ4_OUTPUT_BYTES()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LZ4_MICROS()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_SKIPPED_MEMORY_PRESSURE()
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LEVEL_LOWERED_MEMORY_PRESSURE()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_WINDOW_REJECTED()
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LIMIT_EXCEEDED()
 #define GRPC_STATS_INC_CALL_INITIAL_SIZE(value)
 #define GRPC_STATS_INC_POLL_EVENTS_RETURNED(value)
 #define GRPC_STATS_INC_TCP_WRITE_SIZE(value)
@@ -546,10 +762,18 @@ void grpc_stats_inc_server_cqs_checked(int x);
 #define GRPC_STATS_INC_HTTP2_SEND_TRAILING_METADATA_PER_WRITE(value)
 #define GRPC_STATS_INC_HTTP2_SEND_FLOWCTL_PER_WRITE(value)
 #define GRPC_STATS_INC_SERVER_CQS_CHECKED(value)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_DEFLATE_RATIO(value)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_GZIP_RATIO(value)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_ZSTD_RATIO(value)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_DEFLATE_RATIO(value)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_GZIP_RATIO(value)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_ZSTD_RATIO(value)
+#define GRPC_STATS_INC_MESSAGE_COMPRESSION_LZ4_RATIO(value)
+#define GRPC_STATS_INC_MESSAGE_DECOMPRESSION_LZ4_RATIO(value)
 #endif /* defined(GRPC_COLLECT_STATS) || !defined(NDEBUG) */
-extern const int grpc_stats_histo_buckets[13];
-extern const int grpc_stats_histo_start[13];
-extern const int* const grpc_stats_histo_bucket_boundaries[13];
-extern void (*const grpc_stats_inc_histogram[13])(int x);
+extern const int grpc_stats_histo_buckets[21];
+extern const int grpc_stats_histo_start[21];
+extern const int* const grpc_stats_histo_bucket_boundaries[21];
+extern void (*const grpc_stats_inc_histogram[21])(int x);
 
 #endif /* GRPC_CORE_LIB_DEBUG_STATS_DATA_H */
@@ -95,4 +95,40 @@ server_requested_calls_per_iteration:FLOAT,
 server_slowpath_requests_queued_per_iteration:FLOAT,
 cq_ev_queue_trylock_failures_per_iteration:FLOAT,
 cq_ev_queue_trylock_successes_per_iteration:FLOAT,
-cq_ev_queue_transient_pop_failures_per_iteration:FLOAT
+cq_ev_queue_transient_pop_failures_per_iteration:FLOAT,
+message_compression_compressed_per_iteration:FLOAT,
+message_compression_skipped_small_per_iteration:FLOAT,
+message_compression_skipped_incompressible_per_iteration:FLOAT,
+message_compression_not_smaller_per_iteration:FLOAT,
+message_compression_deflate_input_bytes_per_iteration:FLOAT,
+message_compression_deflate_output_bytes_per_iteration:FLOAT,
+message_compression_deflate_micros_per_iteration:FLOAT,
+message_compression_deflate_not_smaller_per_iteration:FLOAT,
+message_compression_gzip_input_bytes_per_iteration:FLOAT,
+message_compression_gzip_output_bytes_per_iteration:FLOAT,
+message_compression_gzip_micros_per_iteration:FLOAT,
+message_compression_gzip_not_smaller_per_iteration:FLOAT,
+message_compression_zstd_input_bytes_per_iteration:FLOAT,
+message_compression_zstd_output_bytes_per_iteration:FLOAT,
+message_compression_zstd_micros_per_iteration:FLOAT,
+message_compression_zstd_not_smaller_per_iteration:FLOAT,
+message_decompression_deflate_input_bytes_per_iteration:FLOAT,
+message_decompression_deflate_output_bytes_per_iteration:FLOAT,
+message_decompression_deflate_micros_per_iteration:FLOAT,
+message_decompression_gzip_input_bytes_per_iteration:FLOAT,
+message_decompression_gzip_output_bytes_per_iteration:FLOAT,
+message_decompression_gzip_micros_per_iteration:FLOAT,
+message_decompression_zstd_input_bytes_per_iteration:FLOAT,
+message_decompression_zstd_output_bytes_per_iteration:FLOAT,
+message_decompression_zstd_micros_per_iteration:FLOAT,
+message_compression_lz4_input_bytes_per_iteration:FLOAT,
+message_compression_lz4_output_bytes_per_iteration:FLOAT,
+message_compression_lz4_micros_per_iteration:FLOAT,
+message_compression_lz4_not_smaller_per_iteration:FLOAT,
+message_decompression_lz4_input_bytes_per_iteration:FLOAT,
+message_decompression_lz4_output_bytes_per_iteration:FLOAT,
+message_decompression_lz4_micros_per_iteration:FLOAT,
+message_compression_skipped_memory_pressure_per_iteration:FLOAT,
+message_compression_level_lowered_memory_pressure_per_iteration:FLOAT,
+message_decompression_window_rejected_per_iteration:FLOAT,
+message_decompression_limit_exceeded_per_iteration:FLOAT
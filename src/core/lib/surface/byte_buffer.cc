@@ -22,9 +22,26 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice_internal.h"
 
+struct grpc_byte_buffer_compressor {
+  grpc_compression_algorithm compression;
+  grpc_msg_compressor* compressor;
+  grpc_slice_buffer output;
+  /* for the stats: bytes written so far, and time spent compressing them */
+  size_t input_bytes;
+  int64_t micros;
+};
+
+/* Microseconds elapsed since 'start'. */
+static int64_t micros_since(gpr_timespec start) {
+  return static_cast<int64_t>(gpr_timespec_to_micros(
+      gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start)));
+}
+
 grpc_byte_buffer* grpc_raw_byte_buffer_create(grpc_slice* slices,
                                               size_t nslices) {
   return grpc_raw_compressed_byte_buffer_create(slices, nslices,
@@ -39,6 +56,8 @@ grpc_byte_buffer* grpc_raw_compressed_byte_buffer_create(
       static_cast<grpc_byte_buffer*>(gpr_malloc(sizeof(grpc_byte_buffer)));
   bb->type = GRPC_BB_RAW;
   bb->data.raw.compression = compression;
+  bb->data.raw.zstd_window_log_max = 0;
+  bb->data.raw.max_decompressed_length = -1;
   grpc_slice_buffer_init(&bb->data.raw.slice_buffer);
   for (i = 0; i < nslices; i++) {
     grpc_slice_ref_internal(slices[i]);
@@ -47,6 +66,62 @@ grpc_byte_buffer* grpc_raw_compressed_byte_buffer_create(
   return bb;
 }
 
+grpc_byte_buffer_compressor* grpc_byte_buffer_compressor_create(
+    grpc_compression_algorithm compression, int zstd_level,
+    int zstd_window_log_max) {
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  options.level = zstd_level;
+  options.window_log_max = zstd_window_log_max;
+  grpc_msg_compressor* compressor = grpc_msg_compressor_create(
+      grpc_compression_algorithm_to_message_compression_algorithm(compression),
+      &options);
+  if (compressor == nullptr) return nullptr;
+  grpc_byte_buffer_compressor* c = static_cast<grpc_byte_buffer_compressor*>(
+      gpr_malloc(sizeof(grpc_byte_buffer_compressor)));
+  c->compression = compression;
+  c->compressor = compressor;
+  grpc_slice_buffer_init(&c->output);
+  c->input_bytes = 0;
+  c->micros = 0;
+  return c;
+}
+
+int grpc_byte_buffer_compressor_write(grpc_byte_buffer_compressor* c,
+                                      const void* data, size_t length) {
+  grpc_core::ExecCtx exec_ctx;
+  const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  const int ok = grpc_msg_compressor_write(
+      c->compressor, static_cast<const uint8_t*>(data), length, &c->output);
+  c->input_bytes += length;
+  c->micros += micros_since(start);
+  return ok;
+}
+
+grpc_byte_buffer* grpc_byte_buffer_compressor_finish(
+    grpc_byte_buffer_compressor* c) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_byte_buffer* bb = nullptr;
+  const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  if (grpc_msg_compressor_finish(c->compressor, &c->output)) {
+    grpc_msg_compress_record_stats(
+        grpc_compression_algorithm_to_message_compression_algorithm(
+            c->compression),
+        c->input_bytes, c->output.length, c->micros + micros_since(start));
+    bb = static_cast<grpc_byte_buffer*>(gpr_malloc(sizeof(grpc_byte_buffer)));
+    bb->type = GRPC_BB_RAW;
+    bb->data.raw.compression = c->compression;
+    bb->data.raw.zstd_window_log_max = 0;
+    bb->data.raw.max_decompressed_length = -1;
+    grpc_slice_buffer_init(&bb->data.raw.slice_buffer);
+    grpc_slice_buffer_swap(&bb->data.raw.slice_buffer, &c->output);
+  }
+  grpc_msg_compressor_destroy(c->compressor);
+  grpc_slice_buffer_destroy_internal(&c->output);
+  gpr_free(c);
+  return bb;
+}
+
 grpc_byte_buffer* grpc_raw_byte_buffer_from_reader(
     grpc_byte_buffer_reader* reader) {
   grpc_byte_buffer* bb =
@@ -54,20 +129,31 @@ grpc_byte_buffer* grpc_raw_byte_buffer_from_reader(
   grpc_slice slice;
   bb->type = GRPC_BB_RAW;
   bb->data.raw.compression = GRPC_COMPRESS_NONE;
+  bb->data.raw.zstd_window_log_max = 0;
+  bb->data.raw.max_decompressed_length = -1;
   grpc_slice_buffer_init(&bb->data.raw.slice_buffer);
 
   while (grpc_byte_buffer_reader_next(reader, &slice)) {
     grpc_slice_buffer_add(&bb->data.raw.slice_buffer, slice);
   }
+  if (grpc_byte_buffer_reader_failed(reader)) {
+    grpc_byte_buffer_destroy(bb);
+    return nullptr;
+  }
   return bb;
 }
 
 grpc_byte_buffer* grpc_byte_buffer_copy(grpc_byte_buffer* bb) {
   switch (bb->type) {
-    case GRPC_BB_RAW:
-      return grpc_raw_compressed_byte_buffer_create(
+    case GRPC_BB_RAW: {
+      grpc_byte_buffer* copy = grpc_raw_compressed_byte_buffer_create(
           bb->data.raw.slice_buffer.slices, bb->data.raw.slice_buffer.count,
           bb->data.raw.compression);
+      copy->data.raw.zstd_window_log_max = bb->data.raw.zstd_window_log_max;
+      copy->data.raw.max_decompressed_length =
+          bb->data.raw.max_decompressed_length;
+      return copy;
+    }
   }
   GPR_UNREACHABLE_CODE(return nullptr);
 }
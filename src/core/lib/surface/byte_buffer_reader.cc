@@ -32,6 +32,32 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice_internal.h"
 
+/* Peeked slices are decompressed into one buffer of this size, reused from
+ * slice to slice. A parser consuming them reads data that was just written
+ * and is still in the CPU caches, and no memory is allocated per slice. */
+#define PEEK_BUFFER_SIZE (32 * 1024)
+
+/* Decompression state of a reader of a compressed buffer. */
+struct grpc_byte_buffer_reader_decompressor {
+  grpc_msg_decompressor* decompressor;
+  /* The slice most recently returned by peek, valid until the next call. */
+  grpc_slice current;
+  /* Backs current once the first slice was read; allocated on first use. */
+  uint8_t* peek_buffer;
+  /* The first slice, decompressed by grpc_byte_buffer_reader_init() to catch
+   * input that cannot be decompressed at all. */
+  grpc_slice first;
+  bool has_first;
+  bool failed;
+  /* whether it failed because the message exceeds max_decompressed_length */
+  bool exceeded_limit;
+  /* For the stats: the bytes decompressed so far, the time spent on them, and
+   * whether the end of the message was reached and recorded. */
+  size_t output_bytes;
+  int64_t micros;
+  bool finished;
+};
+
 static int is_compressed(grpc_byte_buffer* buffer) {
   switch (buffer->type) {
     case GRPC_BB_RAW:
@@ -43,33 +69,132 @@ static int is_compressed(grpc_byte_buffer* buffer) {
   return 1 /* GPR_TRUE */;
 }
 
+/* Takes the result of a grpc_msg_decompressor call started at 'start' that
+ * produced 'length' bytes, recording the stats of the message once its end is
+ * reached, and recording and logging the first failure. Returns 1 if data was
+ * decompressed. */
+static int check_decompressed(grpc_byte_buffer_reader* reader, int result,
+                              size_t length, gpr_timespec start) {
+  grpc_byte_buffer_reader_decompressor* d = reader->decompressor;
+  d->micros += static_cast<int64_t>(gpr_timespec_to_micros(
+      gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start)));
+  if (result == 1) d->output_bytes += length;
+  if (result == 0 && !d->finished) {
+    d->finished = true;
+    grpc_msg_decompress_record_stats(
+        grpc_compression_algorithm_to_message_compression_algorithm(
+            reader->buffer_in->data.raw.compression),
+        reader->buffer_in->data.raw.slice_buffer.length, d->output_bytes,
+        d->micros);
+  }
+  if (result == -1 && !d->failed) {
+    d->failed = true;
+    d->exceeded_limit =
+        grpc_msg_decompressor_exceeded_limit(d->decompressor) != 0;
+    if (!d->exceeded_limit) {
+      gpr_log(GPR_ERROR,
+              "Unexpected error decompressing data for algorithm with enum "
+              "value '%d'.",
+              reader->buffer_in->data.raw.compression);
+    }
+  }
+  return result == 1;
+}
+
+/* Decompresses the next slice of a compressed buffer. Returns 1 with the slice
+ * in \a slice, or 0 at the end of the data or on failure. */
+static int decompress_next(grpc_byte_buffer_reader* reader,
+                           grpc_slice* slice) {
+  grpc_byte_buffer_reader_decompressor* d = reader->decompressor;
+  if (d->has_first) {
+    d->has_first = false;
+    *slice = d->first;
+    d->first = grpc_empty_slice();
+    return 1;
+  }
+  const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  const int result = grpc_msg_decompressor_next(d->decompressor, slice);
+  return check_decompressed(reader, result,
+                            result == 1 ? GRPC_SLICE_LENGTH(*slice) : 0, start);
+}
+
+/* As decompress_next, but decompresses into the reader's peek buffer rather
+ * than into a new slice. */
+static int decompress_peek(grpc_byte_buffer_reader* reader,
+                           grpc_slice** slice) {
+  grpc_byte_buffer_reader_decompressor* d = reader->decompressor;
+  grpc_slice_unref_internal(d->current);
+  d->current = grpc_empty_slice();
+  if (d->has_first) {
+    GPR_ASSERT(decompress_next(reader, &d->current));
+  } else {
+    if (d->peek_buffer == nullptr) {
+      d->peek_buffer = static_cast<uint8_t*>(gpr_malloc(PEEK_BUFFER_SIZE));
+    }
+    size_t length;
+    const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+    const int result = grpc_msg_decompressor_read(
+        d->decompressor, d->peek_buffer, PEEK_BUFFER_SIZE, &length);
+    if (!check_decompressed(reader, result, length, start)) return 0;
+    /* owned by the reader, like the slices of an uncompressed buffer */
+    d->current = grpc_slice_from_static_buffer(d->peek_buffer, length);
+  }
+  *slice = &d->current;
+  return 1;
+}
+
 int grpc_byte_buffer_reader_init(grpc_byte_buffer_reader* reader,
                                  grpc_byte_buffer* buffer) {
   grpc_core::ExecCtx exec_ctx;
-  grpc_slice_buffer decompressed_slices_buffer;
   reader->buffer_in = buffer;
+  reader->decompressor = nullptr;
   switch (reader->buffer_in->type) {
     case GRPC_BB_RAW:
-      grpc_slice_buffer_init(&decompressed_slices_buffer);
       if (is_compressed(reader->buffer_in)) {
-        if (grpc_msg_decompress(
-
-                grpc_compression_algorithm_to_message_compression_algorithm(
-                    reader->buffer_in->data.raw.compression),
-                &reader->buffer_in->data.raw.slice_buffer,
-                &decompressed_slices_buffer) == 0) {
+        /* decompressed a slice at a time by peek and next */
+        grpc_msg_decompress_options options;
+        grpc_msg_decompress_options_init(&options);
+        options.window_log_max =
+            reader->buffer_in->data.raw.zstd_window_log_max;
+        if (reader->buffer_in->data.raw.max_decompressed_length >= 0) {
+          options.max_output_length = static_cast<size_t>(
+              reader->buffer_in->data.raw.max_decompressed_length);
+        }
+        grpc_msg_decompressor* decompressor = grpc_msg_decompressor_create(
+            grpc_compression_algorithm_to_message_compression_algorithm(
+                reader->buffer_in->data.raw.compression),
+            &options, &reader->buffer_in->data.raw.slice_buffer);
+        grpc_byte_buffer_reader_decompressor* d = nullptr;
+        if (decompressor != nullptr) {
+          d = static_cast<grpc_byte_buffer_reader_decompressor*>(
+              gpr_malloc(sizeof(*d)));
+          d->decompressor = decompressor;
+          d->current = grpc_empty_slice();
+          d->peek_buffer = nullptr;
+          d->first = grpc_empty_slice();
+          d->has_first = false;
+          d->failed = false;
+          d->exceeded_limit = false;
+          d->output_bytes = 0;
+          d->micros = 0;
+          d->finished = false;
+          reader->decompressor = d;
+          d->has_first = decompress_next(reader, &d->first) != 0;
+        }
+        if (d == nullptr) {
           gpr_log(GPR_ERROR,
                   "Unexpected error decompressing data for algorithm with enum "
                   "value '%d'.",
                   reader->buffer_in->data.raw.compression);
+        }
+        /* a message over the limit still initializes, and fails on its first
+         * read, so that grpc_byte_buffer_reader_exceeded_limit can tell */
+        if (d == nullptr || (d->failed && !d->exceeded_limit)) {
+          grpc_byte_buffer_reader_destroy(reader);
           memset(reader, 0, sizeof(*reader));
           return 0;
-        } else { /* all fine */
-          reader->buffer_out =
-              grpc_raw_byte_buffer_create(decompressed_slices_buffer.slices,
-                                          decompressed_slices_buffer.count);
         }
-        grpc_slice_buffer_destroy_internal(&decompressed_slices_buffer);
+        reader->buffer_out = nullptr;
       } else { /* not compressed, use the input buffer as output */
         reader->buffer_out = reader->buffer_in;
       }
@@ -81,13 +206,15 @@ int grpc_byte_buffer_reader_init(grpc_byte_buffer_reader* reader,
 }
 
 void grpc_byte_buffer_reader_destroy(grpc_byte_buffer_reader* reader) {
-  switch (reader->buffer_in->type) {
-    case GRPC_BB_RAW:
-      /* keeping the same if-else structure as in the init function */
-      if (is_compressed(reader->buffer_in)) {
-        grpc_byte_buffer_destroy(reader->buffer_out);
-      }
-      break;
+  grpc_byte_buffer_reader_decompressor* d = reader->decompressor;
+  if (d != nullptr) {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_msg_decompressor_destroy(d->decompressor);
+    grpc_slice_unref_internal(d->current);
+    grpc_slice_unref_internal(d->first);
+    gpr_free(d->peek_buffer);
+    gpr_free(d);
+    reader->decompressor = nullptr;
   }
 }
 
@@ -95,6 +222,11 @@ int grpc_byte_buffer_reader_peek(grpc_byte_buffer_reader* reader,
                                  grpc_slice** slice) {
   switch (reader->buffer_in->type) {
     case GRPC_BB_RAW: {
+      grpc_byte_buffer_reader_decompressor* d = reader->decompressor;
+      if (d != nullptr) {
+        grpc_core::ExecCtx exec_ctx;
+        return decompress_peek(reader, slice);
+      }
       grpc_slice_buffer* slice_buffer;
       slice_buffer = &reader->buffer_out->data.raw.slice_buffer;
       if (reader->current.index < slice_buffer->count) {
@@ -112,6 +244,10 @@ int grpc_byte_buffer_reader_next(grpc_byte_buffer_reader* reader,
                                  grpc_slice* slice) {
   switch (reader->buffer_in->type) {
     case GRPC_BB_RAW: {
+      if (reader->decompressor != nullptr) {
+        grpc_core::ExecCtx exec_ctx;
+        return decompress_next(reader, slice);
+      }
       grpc_slice_buffer* slice_buffer;
       slice_buffer = &reader->buffer_out->data.raw.slice_buffer;
       if (reader->current.index < slice_buffer->count) {
@@ -126,21 +262,38 @@ int grpc_byte_buffer_reader_next(grpc_byte_buffer_reader* reader,
   return 0;
 }
 
+int grpc_byte_buffer_reader_failed(grpc_byte_buffer_reader* reader) {
+  return reader->decompressor != nullptr && reader->decompressor->failed;
+}
+
+int grpc_byte_buffer_reader_exceeded_limit(grpc_byte_buffer_reader* reader) {
+  return reader->decompressor != nullptr &&
+         reader->decompressor->exceeded_limit;
+}
+
 grpc_slice grpc_byte_buffer_reader_readall(grpc_byte_buffer_reader* reader) {
   grpc_slice in_slice;
-  size_t bytes_read = 0;
-  const size_t input_size = grpc_byte_buffer_length(reader->buffer_out);
-  grpc_slice out_slice = GRPC_SLICE_MALLOC(input_size);
-  uint8_t* const outbuf = GRPC_SLICE_START_PTR(out_slice); /* just an alias */
-
+  grpc_slice_buffer slices;
   grpc_core::ExecCtx exec_ctx;
+  grpc_slice_buffer_init(&slices);
   while (grpc_byte_buffer_reader_next(reader, &in_slice) != 0) {
-    const size_t slice_length = GRPC_SLICE_LENGTH(in_slice);
-    memcpy(&(outbuf[bytes_read]), GRPC_SLICE_START_PTR(in_slice), slice_length);
+    grpc_slice_buffer_add(&slices, in_slice);
+  }
+  if (grpc_byte_buffer_reader_failed(reader)) {
+    /* don't hand out the part decompressed before the failure as if it was
+     * the whole message */
+    grpc_slice_buffer_destroy_internal(&slices);
+    return grpc_empty_slice();
+  }
+  grpc_slice out_slice = GRPC_SLICE_MALLOC(slices.length);
+  uint8_t* const outbuf = GRPC_SLICE_START_PTR(out_slice); /* just an alias */
+  size_t bytes_read = 0;
+  for (size_t i = 0; i < slices.count; i++) {
+    const size_t slice_length = GRPC_SLICE_LENGTH(slices.slices[i]);
+    memcpy(&(outbuf[bytes_read]), GRPC_SLICE_START_PTR(slices.slices[i]),
+           slice_length);
     bytes_read += slice_length;
-    grpc_slice_unref_internal(in_slice);
-    GPR_ASSERT(bytes_read <= input_size);
   }
-
+  grpc_slice_buffer_destroy_internal(&slices);
   return out_slice;
 }
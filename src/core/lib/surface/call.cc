@@ -33,6 +33,8 @@
 
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/compression/algorithm_metadata.h"
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/alloc.h"
 #include "src/core/lib/gpr/string.h"
@@ -41,6 +43,7 @@
 #include "src/core/lib/gprpp/arena.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
@@ -143,6 +146,8 @@ struct grpc_call {
         metadata_batch[i][j].deadline = GRPC_MILLIS_INF_FUTURE;
       }
     }
+    // Lets the compression filter compress messages ahead of it.
+    context[GRPC_CONTEXT_MESSAGE_COMPRESSOR].value = &message_compressor;
   }
 
   ~grpc_call() {
@@ -185,7 +190,10 @@ struct grpc_call {
      Element 0 is initial metadata, element 1 is trailing metadata. */
   grpc_metadata_array* buffered_metadata[2] = {};
 
-  grpc_metadata compression_md;
+  /* Internal metadata conveying the compression algorithm (and, for zstd,
+     the level) derived from a compression level to the compression filter. */
+  grpc_metadata compression_md[2];
+  char zstd_level_string[GPR_LTOA_MIN_BUFSIZE];
 
   // A char* indicating the peer name.
   gpr_atm peer_string = 0;
@@ -209,6 +217,10 @@ struct grpc_call {
   /* Contexts for various subsystems (security, tracing, ...). */
   grpc_call_context_element context[GRPC_CONTEXT_COUNT] = {};
 
+  /* The compressor of the compression filter, for
+     grpc_call_compress_message. */
+  grpc_core::CallMessageCompressorSlot message_compressor;
+
   /* for the client, extra metadata is initial metadata; for the
      server, it's trailing metadata */
   grpc_linked_mdelem send_extra_metadata[MAX_SEND_EXTRA_METADATA_COUNT];
@@ -222,6 +234,7 @@ struct grpc_call {
   grpc_slice receiving_slice = grpc_empty_slice();
   grpc_closure receiving_slice_ready;
   grpc_closure receiving_stream_ready;
+  grpc_closure decompress_message_on_executor;
   grpc_closure receiving_initial_metadata_ready;
   grpc_closure receiving_trailing_metadata_ready;
   uint32_t test_only_last_message_flags = 0;
@@ -468,6 +481,9 @@ grpc_error* grpc_call_create(const grpc_call_create_args* args,
         grpc_channel_get_channelz_node(call->channel);
     if (channelz_channel != nullptr) {
       channelz_channel->RecordCallStarted();
+      // Lets the compression filter record the messages it compresses.
+      call->context[GRPC_CONTEXT_CHANNELZ_COMPRESSION_COUNTER].value =
+          channelz_channel->compression_counter();
     }
   } else {
     grpc_core::channelz::ServerNode* channelz_server =
@@ -647,6 +663,29 @@ char* grpc_call_get_peer(grpc_call* call) {
   return gpr_strdup("unknown");
 }
 
+int grpc_call_compress_message(grpc_call* call, grpc_byte_buffer* message,
+                               grpc_byte_buffer** compressed) {
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_API_TRACE(
+      "grpc_call_compress_message(call=%p, message=%p, compressed=%p)", 3,
+      (call, message, compressed));
+  if (message->type != GRPC_BB_RAW ||
+      message->data.raw.compression != GRPC_COMPRESS_NONE) {
+    return -1;
+  }
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  grpc_compression_algorithm algorithm = GRPC_COMPRESS_NONE;
+  const int r = call->message_compressor.Compress(
+      &message->data.raw.slice_buffer, &output, &algorithm);
+  if (r == 1) {
+    *compressed = grpc_raw_compressed_byte_buffer_create(nullptr, 0, algorithm);
+    grpc_slice_buffer_swap(&(*compressed)->data.raw.slice_buffer, &output);
+  }
+  grpc_slice_buffer_destroy_internal(&output);
+  return r;
+}
+
 grpc_call* grpc_call_from_top_element(grpc_call_element* elem) {
   return CALL_FROM_TOP_ELEM(elem);
 }
@@ -1242,6 +1281,79 @@ static void finish_batch_step(batch_control* bctl) {
   }
 }
 
+/* Replaces the compressed message in *call->receiving_buffer with its
+ * decompressed contents. If decompression fails, the compressed message is
+ * left for grpc_byte_buffer_reader_init() to report the failure, as for
+ * messages that are not decompressed by the call. If the message exceeds the
+ * buffer's decompressed length limit, or the channel's resource quota cannot
+ * afford an estimate of the memory decompressing it takes, it is dropped and
+ * the call fails. The estimate is released once the message is decompressed:
+ * from then on it belongs to the application, like an uncompressed message,
+ * whose slices the call does not charge either. */
+static void decompress_received_message(grpc_call* call) {
+  grpc_byte_buffer* compressed = *call->receiving_buffer;
+  const grpc_message_compression_algorithm algorithm =
+      grpc_compression_algorithm_to_message_compression_algorithm(
+          compressed->data.raw.compression);
+  const int max_length = compressed->data.raw.max_decompressed_length;
+  grpc_msg_decompress_options options;
+  grpc_msg_decompress_options_init(&options);
+  if (max_length >= 0) {
+    options.max_output_length = static_cast<size_t>(max_length);
+  }
+  options.window_log_max = compressed->data.raw.zstd_window_log_max;
+  grpc_resource_user* resource_user =
+      call->channel->decompression_resource_user;
+  size_t charged_bytes = 0;
+  if (resource_user != nullptr) {
+    charged_bytes = grpc_msg_decompress_memory_estimate(
+        algorithm, &options, &compressed->data.raw.slice_buffer);
+    if (!grpc_resource_user_safe_alloc(resource_user, charged_bytes)) {
+      cancel_with_status(call, GRPC_STATUS_RESOURCE_EXHAUSTED,
+                         "Not enough memory to decompress received message");
+      grpc_byte_buffer_destroy(compressed);
+      *call->receiving_buffer = nullptr;
+      return;
+    }
+  }
+  grpc_byte_buffer* decompressed = grpc_raw_byte_buffer_create(nullptr, 0);
+  const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  const int r = grpc_msg_decompress_with_options(
+      algorithm, &options, &compressed->data.raw.slice_buffer,
+      &decompressed->data.raw.slice_buffer);
+  if (charged_bytes > 0) {
+    grpc_resource_user_free(resource_user, charged_bytes);
+  }
+  if (r == 1) {
+    grpc_msg_decompress_record_stats(
+        algorithm, compressed->data.raw.slice_buffer.length,
+        decompressed->data.raw.slice_buffer.length,
+        static_cast<int64_t>(gpr_timespec_to_micros(
+            gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start))));
+    grpc_byte_buffer_destroy(compressed);
+    *call->receiving_buffer = decompressed;
+    return;
+  }
+  grpc_byte_buffer_destroy(decompressed);
+  if (r == -1) {
+    char* error_msg;
+    gpr_asprintf(&error_msg,
+                 "Received message larger than max once decompressed (%d)",
+                 max_length);
+    cancel_with_status(call, GRPC_STATUS_RESOURCE_EXHAUSTED, error_msg);
+    gpr_free(error_msg);
+    grpc_byte_buffer_destroy(compressed);
+    *call->receiving_buffer = nullptr;
+  }
+}
+
+static void decompress_message_on_executor(void* bctlp,
+                                           grpc_error* /*error*/) {
+  batch_control* bctl = static_cast<batch_control*>(bctlp);
+  decompress_received_message(bctl->call);
+  finish_batch_step(bctl);
+}
+
 static void continue_receiving_slices(batch_control* bctl) {
   grpc_error* error;
   grpc_call* call = bctl->call;
@@ -1251,6 +1363,26 @@ static void continue_receiving_slices(batch_control* bctl) {
     if (remaining == 0) {
       call->receiving_message = 0;
       call->receiving_stream.reset();
+      const size_t offload_min_message_size =
+          call->channel->decompression_offload_min_message_size;
+      grpc_byte_buffer* buffer = *call->receiving_buffer;
+      if (buffer->data.raw.compression != GRPC_COMPRESS_NONE) {
+        if (offload_min_message_size > 0 &&
+            buffer->data.raw.slice_buffer.length >= offload_min_message_size) {
+          grpc_core::Executor::Run(
+              GRPC_CLOSURE_INIT(&call->decompress_message_on_executor,
+                                decompress_message_on_executor, bctl,
+                                grpc_schedule_on_exec_ctx),
+              GRPC_ERROR_NONE, grpc_core::ExecutorType::DEFAULT,
+              grpc_core::ExecutorJobType::LONG);
+          return;
+        }
+        // The application's reader has no quota to charge, so channels with
+        // one decompress their messages here.
+        if (call->channel->decompression_resource_user != nullptr) {
+          decompress_received_message(call);
+        }
+      }
       finish_batch_step(bctl);
       return;
     }
@@ -1325,6 +1457,21 @@ static void process_data_after_md(batch_control* bctl) {
               (grpc_stream_compression_algorithm)0));
       *call->receiving_buffer =
           grpc_raw_compressed_byte_buffer_create(nullptr, 0, algo);
+      // Whoever decompresses the message, the call or the application's
+      // reader, enforces the channel's limits.
+      (*call->receiving_buffer)->data.raw.zstd_window_log_max =
+          call->channel->zstd_window_log_max;
+      (*call->receiving_buffer)->data.raw.max_decompressed_length =
+          call->channel->max_decompressed_message_length;
+      void* compression_counter =
+          call->context[GRPC_CONTEXT_CHANNELZ_COMPRESSION_COUNTER].value;
+      if (compression_counter != nullptr) {
+        static_cast<grpc_core::channelz::CompressionCountingHelper*>(
+            compression_counter)
+            ->RecordCompressedMessageReceived(
+                call->incoming_message_compression_algorithm,
+                call->receiving_stream->length());
+      }
     } else {
       *call->receiving_buffer = grpc_raw_byte_buffer_create(nullptr, 0);
     }
@@ -1613,10 +1760,12 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
         // GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY, we shouldn't override that
         // with the compression algorithm mapped from compression level.
         /* process compression level */
-        grpc_metadata& compression_md = call->compression_md;
-        compression_md.key = grpc_empty_slice();
-        compression_md.value = grpc_empty_slice();
-        compression_md.flags = 0;
+        grpc_metadata* compression_md = call->compression_md;
+        for (grpc_metadata& md : call->compression_md) {
+          md.key = grpc_empty_slice();
+          md.value = grpc_empty_slice();
+          md.flags = 0;
+        }
         size_t additional_metadata_count = 0;
         grpc_compression_level effective_compression_level =
             GRPC_COMPRESS_LEVEL_NONE;
@@ -1641,9 +1790,20 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
           // The following metadata will be checked and removed by the message
           // compression filter. It will be used as the call's compression
           // algorithm.
-          compression_md.key = GRPC_MDSTR_GRPC_INTERNAL_ENCODING_REQUEST;
-          compression_md.value = grpc_compression_algorithm_slice(calgo);
+          compression_md[0].key = GRPC_MDSTR_GRPC_INTERNAL_ENCODING_REQUEST;
+          compression_md[0].value = grpc_compression_algorithm_slice(calgo);
           additional_metadata_count++;
+          // Likewise for the zstd level the compression level maps to.
+          if (calgo == GRPC_COMPRESS_ZSTD) {
+            gpr_ltoa(grpc_compression_level_to_zstd_level(
+                         effective_compression_level),
+                     call->zstd_level_string);
+            compression_md[1].key = grpc_slice_from_static_string(
+                GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY);
+            compression_md[1].value =
+                grpc_slice_from_static_string(call->zstd_level_string);
+            additional_metadata_count++;
+          }
         }
         if (op->data.send_initial_metadata.count + additional_metadata_count >
             INT_MAX) {
@@ -1655,7 +1815,7 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
         if (!prepare_application_metadata(
                 call, static_cast<int>(op->data.send_initial_metadata.count),
                 op->data.send_initial_metadata.metadata, 0, call->is_client,
-                &compression_md, static_cast<int>(additional_metadata_count))) {
+                compression_md, static_cast<int>(additional_metadata_count))) {
           error = GRPC_CALL_ERROR_INVALID_METADATA;
           goto done_with_error;
         }
@@ -1690,10 +1850,18 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
         uint32_t flags = op->flags;
         /* If the outgoing buffer is already compressed, mark it as so in the
            flags. These will be picked up by the compression filter and further
-           (wasteful) attempts at compression skipped. */
-        if (op->data.send_message.send_message->data.raw.compression >
-            GRPC_COMPRESS_NONE) {
-          flags |= GRPC_WRITE_INTERNAL_COMPRESS;
+           (wasteful) attempts at compression skipped. The algorithm lets
+           the filter catch buffers compressed with another algorithm than
+           the call's. */
+        const grpc_compression_algorithm compression =
+            op->data.send_message.send_message->data.raw.compression;
+        if (compression > GRPC_COMPRESS_NONE) {
+          const grpc_message_compression_algorithm message_algorithm =
+              grpc_compression_algorithm_to_message_compression_algorithm(
+                  compression);
+          flags |= GRPC_WRITE_INTERNAL_COMPRESS |
+                   (static_cast<uint32_t>(message_algorithm)
+                    << GRPC_WRITE_INTERNAL_ALGORITHM_SHIFT);
         }
         stream_op->send_message = true;
         call->sending_message = true;
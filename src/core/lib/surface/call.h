@@ -24,11 +24,57 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/context.h"
 #include "src/core/lib/gprpp/arena.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/surface/api_trace.h"
 
 #include <grpc/grpc.h>
 #include <grpc/impl/codegen/compression_types.h>
 
+namespace grpc_core {
+
+/* Compresses the messages that a call sends as its compression filter does,
+ * for grpc_call_compress_message. */
+class CallMessageCompressor {
+ public:
+  virtual ~CallMessageCompressor() = default;
+
+  /* Compresses \a input into \a output, setting \a *algorithm, and returns
+   * as grpc_call_compress_message does. Called from any thread. */
+  virtual int Compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+                       grpc_compression_algorithm* algorithm) = 0;
+};
+
+/* Holds the compressor of the call's compression filter, if any. The filter
+ * of a client call lives in the call attempt's subchannel stack: it drops its
+ * compressor when the attempt ends, which waits for a compression with it to
+ * finish. */
+class CallMessageCompressorSlot {
+ public:
+  void Set(CallMessageCompressor* compressor) {
+    MutexLock lock(&mu_);
+    compressor_ = compressor;
+  }
+
+  /* Drops \a compressor, unless another attempt replaced it already. */
+  void Clear(CallMessageCompressor* compressor) {
+    MutexLock lock(&mu_);
+    if (compressor_ == compressor) compressor_ = nullptr;
+  }
+
+  int Compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+               grpc_compression_algorithm* algorithm) {
+    MutexLock lock(&mu_);
+    if (compressor_ == nullptr) return -1;
+    return compressor_->Compress(input, output, algorithm);
+  }
+
+ private:
+  Mutex mu_;
+  CallMessageCompressor* compressor_ = nullptr;
+};
+
+}  // namespace grpc_core
+
 typedef void (*grpc_ioreq_completion_func)(grpc_call* call, int success,
                                            void* user_data);
 
@@ -34,6 +34,7 @@
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/channel/channelz_registry.h"
+#include "src/core/lib/compression/compression_args.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
@@ -92,6 +93,15 @@ grpc_channel* grpc_channel_create_with_builder(
           grpc_call_get_initial_size_estimate());
 
   grpc_compression_options_init(&channel->compression_options);
+  channel->decompression_offload_min_message_size = 0;
+  channel->zstd_window_log_max =
+      grpc_channel_args_compression_zstd_window_log_max(args);
+  /* defaulted as the message size filter defaults it */
+  int max_receive_message_length = grpc_channel_args_want_minimal_stack(args)
+                                       ? -1
+                                       : GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH;
+  bool max_decompressed_message_length_set = false;
+  bool compression_passthrough = false;
   for (size_t i = 0; i < args->num_args; i++) {
     if (0 ==
         strcmp(args->args[i].key, GRPC_COMPRESSION_CHANNEL_DEFAULT_LEVEL)) {
@@ -114,6 +124,24 @@ grpc_channel* grpc_channel_create_with_builder(
       channel->compression_options.enabled_algorithms_bitset =
           static_cast<uint32_t>(args->args[i].value.integer) |
           0x1; /* always support no compression */
+    } else if (0 == strcmp(args->args[i].key,
+                           GRPC_COMPRESSION_CHANNEL_OFFLOAD_MIN_MESSAGE_SIZE)) {
+      channel->decompression_offload_min_message_size =
+          grpc_channel_arg_get_integer(&args->args[i], {0, 0, INT_MAX});
+    } else if (0 ==
+               strcmp(args->args[i].key,
+                      GRPC_ARG_MAX_RECEIVE_DECOMPRESSED_MESSAGE_LENGTH)) {
+      channel->max_decompressed_message_length =
+          grpc_channel_arg_get_integer(&args->args[i], {-1, -1, INT_MAX});
+      max_decompressed_message_length_set = true;
+    } else if (0 == strcmp(args->args[i].key,
+                           GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH)) {
+      max_receive_message_length = grpc_channel_arg_get_integer(
+          &args->args[i], {max_receive_message_length, -1, INT_MAX});
+    } else if (0 == strcmp(args->args[i].key,
+                           GRPC_COMPRESSION_CHANNEL_PASSTHROUGH)) {
+      compression_passthrough =
+          grpc_channel_arg_get_bool(&args->args[i], false);
     } else if (0 == strcmp(args->args[i].key, GRPC_ARG_CHANNELZ_CHANNEL_NODE)) {
       if (args->args[i].type == GRPC_ARG_POINTER) {
         GPR_ASSERT(args->args[i].value.pointer.p != nullptr);
@@ -126,6 +154,27 @@ grpc_channel* grpc_channel_create_with_builder(
       }
     }
   }
+  // Unless set, received messages may decompress to no more than the max
+  // receive message length, so that a small message can't expand without
+  // bound.
+  if (!max_decompressed_message_length_set) {
+    channel->max_decompressed_message_length = max_receive_message_length;
+  }
+  // Messages are forwarded compressed, so they must reach the application
+  // that way.
+  if (compression_passthrough) {
+    channel->decompression_offload_min_message_size = 0;
+  }
+  channel->decompression_resource_user = nullptr;
+  if (!compression_passthrough) {
+    grpc_resource_quota* resource_quota =
+        grpc_resource_quota_from_channel_args(args, false);
+    if (resource_quota != nullptr) {
+      channel->decompression_resource_user =
+          grpc_resource_user_create(resource_quota, "message_decompress");
+      grpc_resource_quota_unref_internal(resource_quota);
+    }
+  }
 
   grpc_channel_args_destroy(args);
   return channel;
@@ -510,6 +559,10 @@ static void destroy_channel(void* arg, grpc_error* /*error*/) {
   }
   grpc_channel_stack_destroy(CHANNEL_STACK_FROM_CHANNEL(channel));
   channel->registration_table.Destroy();
+  if (channel->decompression_resource_user != nullptr) {
+    grpc_resource_user_shutdown(channel->decompression_resource_user);
+    grpc_resource_user_unref(channel->decompression_resource_user);
+  }
   if (channel->resource_user != nullptr) {
     grpc_resource_user_free(channel->resource_user,
                             GRPC_RESOURCE_QUOTA_CHANNEL_SIZE);
@@ -93,6 +93,20 @@ struct CallRegistrationTable {
 struct grpc_channel {
   int is_client;
   grpc_compression_options compression_options;
+  /* Received messages of at least this size are decompressed on the executor,
+   * 0 if never. */
+  size_t decompression_offload_min_message_size;
+  /* Received zstd messages needing a window larger than 2^this fail to
+   * decompress, 0 if none do. */
+  int zstd_window_log_max;
+  /* Reading a received compressed message fails once it decompresses to more
+   * than this many bytes, -1 if it never does. Defaults to the max receive
+   * message length. */
+  int max_decompressed_message_length;
+  /* Charged for the received messages the call decompresses, so that
+   * decompression fails the call with RESOURCE_EXHAUSTED rather than exceed
+   * the channel's resource quota. Null without a quota. */
+  grpc_resource_user* decompression_resource_user;
 
   gpr_atm call_size_estimate;
   grpc_resource_user* resource_user;
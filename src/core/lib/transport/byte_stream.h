@@ -28,8 +28,14 @@
 /** Internal bit flag for grpc_begin_message's \a flags signaling the use of
  * compression for the message */
 #define GRPC_WRITE_INTERNAL_COMPRESS (0x80000000u)
+/** Internal bits of grpc_begin_message's \a flags holding the
+ * grpc_message_compression_algorithm of a message that was already compressed
+ * when it was handed to the call */
+#define GRPC_WRITE_INTERNAL_ALGORITHM_SHIFT 24
+#define GRPC_WRITE_INTERNAL_ALGORITHM_MASK (0x0f000000u)
 /** Mask of all valid internal flags. */
-#define GRPC_WRITE_INTERNAL_USED_MASK (GRPC_WRITE_INTERNAL_COMPRESS)
+#define GRPC_WRITE_INTERNAL_USED_MASK \
+  (GRPC_WRITE_INTERNAL_COMPRESS | GRPC_WRITE_INTERNAL_ALGORITHM_MASK)
 
 namespace grpc_core {
 
@@ -30,7 +30,7 @@
 
 #include "src/core/lib/slice/slice_internal.h"
 
-static constexpr uint8_t g_bytes[] = {58,112,97,116,104,58,109,101,116,104,111,100,58,115,116,97,116,117,115,58,97,117,116,104,111,114,105,116,121,58,115,99,104,101,109,101,116,101,103,114,112,99,45,109,101,115,115,97,103,101,103,114,112,99,45,115,116,97,116,117,115,103,114,112,99,45,112,97,121,108,111,97,100,45,98,105,110,103,114,112,99,45,101,110,99,111,100,105,110,103,103,114,112,99,45,97,99,99,101,112,116,45,101,110,99,111,100,105,110,103,103,114,112,99,45,115,101,114,118,101,114,45,115,116,97,116,115,45,98,105,110,103,114,112,99,45,116,97,103,115,45,98,105,110,103,114,112,99,45,116,114,97,99,101,45,98,105,110,99,111,110,116,101,110,116,45,116,121,112,101,99,111,110,116,101,110,116,45,101,110,99,111,100,105,110,103,97,99,99,101,112,116,45,101,110,99,111,100,105,110,103,103,114,112,99,45,105,110,116,101,114,110,97,108,45,101,110,99,111,100,105,110,103,45,114,101,113,117,101,115,116,103,114,112,99,45,105,110,116,101,114,110,97,108,45,115,116,114,101,97,109,45,101,110,99,111,100,105,110,103,45,114,101,113,117,101,115,116,117,115,101,114,45,97,103,101,110,116,104,111,115,116,103,114,112,99,45,112,114,101,118,105,111,117,115,45,114,112,99,45,97,116,116,101,109,112,116,115,103,114,112,99,45,114,101,116,114,121,45,112,117,115,104,98,97,99,107,45,109,115,120,45,101,110,100,112,111,105,110,116,45,108,111,97,100,45,109,101,116,114,105,99,115,45,98,105,110,103,114,112,99,45,116,105,109,101,111,117,116,49,50,51,52,103,114,112,99,46,119,97,105,116,95,102,111,114,95,114,101,97,100,121,103,114,112,99,46,116,105,109,101,111,117,116,103,114,112,99,46,109,97,120,95,114,101,113,117,101,115,116,95,109,101,115,115,97,103,101,95,98,121,116,101,115,103,114,112,99,46,109,97,120,95,114,101,115,112,111,110,115,101,95,109,101,115,115,97,103,101,95,98,121,116,101,115,47,103,114,112,99,46,108,98,46,118,49,46,76,111,97,100,66,97,108,97,110,99,101,114,47,66,97,108,97,110,99,101,76,111,97,100,47,101,110,118,111,121,46,115,101,114,118,105,99,101,46,108,111,97,100,95,115,116,97,116,115,46,118,50,46,76,111,97,100,82,101,112,111,114,116,105,110,103,83,101,114,118,105,99,101,47,83,116,114,101,97,109,76,111,97,100,83,116,97,116,115,47,103,114,112,99,46,104,101,97,108,116,104,46,118,49,46,72,101,97,108,116,104,47,87,97,116,99,104,47,101,110,118,111,121,46,115,101,114,118,105,99,101,46,100,105,115,99,111,118,101,114,121,46,118,50,46,65,103,103,114,101,103,97,116,101,100,68,105,115,99,111,118,101,114,121,83,101,114,118,105,99,101,47,83,116,114,101,97,109,65,103,103,114,101,103,97,116,101,100,82,101,115,111,117,114,99,101,115,100,101,102,108,97,116,101,103,122,105,112,122,115,116,100,115,116,114,101,97,109,47,103,122,105,112,115,116,114,101,97,109,47,122,115,116,100,71,69,84,80,79,83,84,47,47,105,110,100,101,120,46,104,116,109,108,104,116,116,112,104,116,116,112,115,50,48,48,50,48,52,50,48,54,51,48,52,52,48,48,52,48,52,53,48,48,97,99,99,101,112,116,45,99,104,97,114,115,101,116,103,122,105,112,44,100,101,102,108,97,116,101,97,99,99,101,112,116,45,108,97,110,103,117,97,103,101,97,99,99,101,112,116,45,114,97,110,103,101,115,97,99,99,101,112,116,97,99,99,101,115,115,45,99,111,110,116,114,111,108,45,97,108,108,111,119,45,111,114,105,103,105,110,97,103,101,97,108,108,111,119,97,117,116,104,111,114,105,122,97,116,105,111,110,99,97,99,104,101,45,99,111,110,116,114,111,108,99,111,110,116,101,110,116,45,100,105,115,112,111,115,105,116,105,111,110,99,111,110,116,101,110,116,45,108,97,110,103,117,97,103,101,99,111,110,116,101,110,116,45,108,101,110,103,116,104,99,111,110,116,101,110,116,45,108,111,99,97,116,105,111,110,99,111,110,116,101,110,116,45,114,97,110,103,101,99,111,111,107,105,101,100,97,116,101,101,116,97,103,101,120,112,101,99,116,101,120,112,105,114,101,115,102,114,111,109,105,102,45,109,97,116,99,104,105,102,45,109,111,100,105,102,105,101,100,45,115,105,110,99,101,105,102,45,110,111,110,101,45,109,97,116,99,104,105,102,45,114,97,110,103,101,105,102,45,117,110,109,111,100,105,102,105,101,100,45,115,105,110,99,101,108,97,115,116,45,109,111,100,105,102,105,101,100,108,105,110,107,108,111,99,97,116,105,111,110,109,97,120,45,102,111,114,119,97,114,100,115,112,114,111,120,121,45,97,117,116,104,101,110,116,105,99,97,116,101,112,114,111,120,121,45,97,117,116,104,111,114,105,122,97,116,105,111,110,114,97,110,103,101,114,101,102,101,114,101,114,114,101,102,114,101,115,104,114,101,116,114,121,45,97,102,116,101,114,115,101,114,118,101,114,115,101,116,45,99,111,111,107,105,101,115,116,114,105,99,116,45,116,114,97,110,115,112,111,114,116,45,115,101,99,117,114,105,116,121,116,114,97,110,115,102,101,114,45,101,110,99,111,100,105,110,103,118,97,114,121,118,105,97,119,119,119,45,97,117,116,104,101,110,116,105,99,97,116,101,48,105,100,101,110,116,105,116,121,116,114,97,105,108,101,114,115,97,112,112,108,105,99,97,116,105,111,110,47,103,114,112,99,103,114,112,99,80,85,84,108,98,45,99,111,115,116,45,98,105,110,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,105,100,101,110,116,105,116,121,44,103,122,105,112,100,101,102,108,97,116,101,44,103,122,105,112,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,103,122,105,112,105,100,101,110,116,105,116,121,44,122,115,116,100,100,101,102,108,97,116,101,44,122,115,116,100,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,122,115,116,100,103,122,105,112,44,122,115,116,100,105,100,101,110,116,105,116,121,44,103,122,105,112,44,122,115,116,100,100,101,102,108,97,116,101,44,103,122,105,112,44,122,115,116,100,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,103,122,105,112,44,122,115,116,100};
+static constexpr uint8_t g_bytes[] = {58,112,97,116,104,58,109,101,116,104,111,100,58,115,116,97,116,117,115,58,97,117,116,104,111,114,105,116,121,58,115,99,104,101,109,101,116,101,103,114,112,99,45,109,101,115,115,97,103,101,103,114,112,99,45,115,116,97,116,117,115,103,114,112,99,45,112,97,121,108,111,97,100,45,98,105,110,103,114,112,99,45,101,110,99,111,100,105,110,103,103,114,112,99,45,97,99,99,101,112,116,45,101,110,99,111,100,105,110,103,103,114,112,99,45,115,101,114,118,101,114,45,115,116,97,116,115,45,98,105,110,103,114,112,99,45,116,97,103,115,45,98,105,110,103,114,112,99,45,116,114,97,99,101,45,98,105,110,99,111,110,116,101,110,116,45,116,121,112,101,99,111,110,116,101,110,116,45,101,110,99,111,100,105,110,103,97,99,99,101,112,116,45,101,110,99,111,100,105,110,103,103,114,112,99,45,105,110,116,101,114,110,97,108,45,101,110,99,111,100,105,110,103,45,114,101,113,117,101,115,116,103,114,112,99,45,105,110,116,101,114,110,97,108,45,115,116,114,101,97,109,45,101,110,99,111,100,105,110,103,45,114,101,113,117,101,115,116,117,115,101,114,45,97,103,101,110,116,104,111,115,116,103,114,112,99,45,112,114,101,118,105,111,117,115,45,114,112,99,45,97,116,116,101,109,112,116,115,103,114,112,99,45,114,101,116,114,121,45,112,117,115,104,98,97,99,107,45,109,115,120,45,101,110,100,112,111,105,110,116,45,108,111,97,100,45,109,101,116,114,105,99,115,45,98,105,110,103,114,112,99,45,116,105,109,101,111,117,116,49,50,51,52,103,114,112,99,46,119,97,105,116,95,102,111,114,95,114,101,97,100,121,103,114,112,99,46,116,105,109,101,111,117,116,103,114,112,99,46,109,97,120,95,114,101,113,117,101,115,116,95,109,101,115,115,97,103,101,95,98,121,116,101,115,103,114,112,99,46,109,97,120,95,114,101,115,112,111,110,115,101,95,109,101,115,115,97,103,101,95,98,121,116,101,115,47,103,114,112,99,46,108,98,46,118,49,46,76,111,97,100,66,97,108,97,110,99,101,114,47,66,97,108,97,110,99,101,76,111,97,100,47,101,110,118,111,121,46,115,101,114,118,105,99,101,46,108,111,97,100,95,115,116,97,116,115,46,118,50,46,76,111,97,100,82,101,112,111,114,116,105,110,103,83,101,114,118,105,99,101,47,83,116,114,101,97,109,76,111,97,100,83,116,97,116,115,47,103,114,112,99,46,104,101,97,108,116,104,46,118,49,46,72,101,97,108,116,104,47,87,97,116,99,104,47,101,110,118,111,121,46,115,101,114,118,105,99,101,46,100,105,115,99,111,118,101,114,121,46,118,50,46,65,103,103,114,101,103,97,116,101,100,68,105,115,99,111,118,101,114,121,83,101,114,118,105,99,101,47,83,116,114,101,97,109,65,103,103,114,101,103,97,116,101,100,82,101,115,111,117,114,99,101,115,100,101,102,108,97,116,101,103,122,105,112,122,115,116,100,108,122,52,115,116,114,101,97,109,47,103,122,105,112,115,116,114,101,97,109,47,122,115,116,100,71,69,84,80,79,83,84,47,47,105,110,100,101,120,46,104,116,109,108,104,116,116,112,104,116,116,112,115,50,48,48,50,48,52,50,48,54,51,48,52,52,48,48,52,48,52,53,48,48,97,99,99,101,112,116,45,99,104,97,114,115,101,116,103,122,105,112,44,100,101,102,108,97,116,101,97,99,99,101,112,116,45,108,97,110,103,117,97,103,101,97,99,99,101,112,116,45,114,97,110,103,101,115,97,99,99,101,112,116,97,99,99,101,115,115,45,99,111,110,116,114,111,108,45,97,108,108,111,119,45,111,114,105,103,105,110,97,103,101,97,108,108,111,119,97,117,116,104,111,114,105,122,97,116,105,111,110,99,97,99,104,101,45,99,111,110,116,114,111,108,99,111,110,116,101,110,116,45,100,105,115,112,111,115,105,116,105,111,110,99,111,110,116,101,110,116,45,108,97,110,103,117,97,103,101,99,111,110,116,101,110,116,45,108,101,110,103,116,104,99,111,110,116,101,110,116,45,108,111,99,97,116,105,111,110,99,111,110,116,101,110,116,45,114,97,110,103,101,99,111,111,107,105,101,100,97,116,101,101,116,97,103,101,120,112,101,99,116,101,120,112,105,114,101,115,102,114,111,109,105,102,45,109,97,116,99,104,105,102,45,109,111,100,105,102,105,101,100,45,115,105,110,99,101,105,102,45,110,111,110,101,45,109,97,116,99,104,105,102,45,114,97,110,103,101,105,102,45,117,110,109,111,100,105,102,105,101,100,45,115,105,110,99,101,108,97,115,116,45,109,111,100,105,102,105,101,100,108,105,110,107,108,111,99,97,116,105,111,110,109,97,120,45,102,111,114,119,97,114,100,115,112,114,111,120,121,45,97,117,116,104,101,110,116,105,99,97,116,101,112,114,111,120,121,45,97,117,116,104,111,114,105,122,97,116,105,111,110,114,97,110,103,101,114,101,102,101,114,101,114,114,101,102,114,101,115,104,114,101,116,114,121,45,97,102,116,101,114,115,101,114,118,101,114,115,101,116,45,99,111,111,107,105,101,115,116,114,105,99,116,45,116,114,97,110,115,112,111,114,116,45,115,101,99,117,114,105,116,121,116,114,97,110,115,102,101,114,45,101,110,99,111,100,105,110,103,118,97,114,121,118,105,97,119,119,119,45,97,117,116,104,101,110,116,105,99,97,116,101,48,105,100,101,110,116,105,116,121,116,114,97,105,108,101,114,115,97,112,112,108,105,99,97,116,105,111,110,47,103,114,112,99,103,114,112,99,80,85,84,108,98,45,99,111,115,116,45,98,105,110,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,105,100,101,110,116,105,116,121,44,103,122,105,112,100,101,102,108,97,116,101,44,103,122,105,112,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,103,122,105,112,105,100,101,110,116,105,116,121,44,122,115,116,100,100,101,102,108,97,116,101,44,122,115,116,100,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,122,115,116,100,103,122,105,112,44,122,115,116,100,105,100,101,110,116,105,116,121,44,103,122,105,112,44,122,115,116,100,100,101,102,108,97,116,101,44,103,122,105,112,44,122,115,116,100,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,103,122,105,112,44,122,115,116,100,105,100,101,110,116,105,116,121,44,108,122,52,100,101,102,108,97,116,101,44,108,122,52,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,108,122,52,103,122,105,112,44,108,122,52,105,100,101,110,116,105,116,121,44,103,122,105,112,44,108,122,52,100,101,102,108,97,116,101,44,103,122,105,112,44,108,122,52,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,103,122,105,112,44,108,122,52,122,115,116,100,44,108,122,52,105,100,101,110,116,105,116,121,44,122,115,116,100,44,108,122,52,100,101,102,108,97,116,101,44,122,115,116,100,44,108,122,52,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,122,115,116,100,44,108,122,52,103,122,105,112,44,122,115,116,100,44,108,122,52,105,100,101,110,116,105,116,121,44,103,122,105,112,44,122,115,116,100,44,108,122,52,100,101,102,108,97,116,101,44,103,122,105,112,44,122,115,116,100,44,108,122,52,105,100,101,110,116,105,116,121,44,100,101,102,108,97,116,101,44,103,122,105,112,44,122,115,116,100,44,108,122,52};
 
 grpc_slice_refcount grpc_core::StaticSliceRefcount::kStaticSubRefcount;
 
@@ -159,6 +159,22 @@ struct StaticMetadataCtx {
   StaticSliceRefcount(114), 
   StaticSliceRefcount(115), 
   StaticSliceRefcount(116), 
+  StaticSliceRefcount(117), 
+  StaticSliceRefcount(118), 
+  StaticSliceRefcount(119), 
+  StaticSliceRefcount(120), 
+  StaticSliceRefcount(121), 
+  StaticSliceRefcount(122), 
+  StaticSliceRefcount(123), 
+  StaticSliceRefcount(124), 
+  StaticSliceRefcount(125), 
+  StaticSliceRefcount(126), 
+  StaticSliceRefcount(127), 
+  StaticSliceRefcount(128), 
+  StaticSliceRefcount(129), 
+  StaticSliceRefcount(130), 
+  StaticSliceRefcount(131), 
+  StaticSliceRefcount(132), 
 };
 
 
@@ -206,183 +222,216 @@ grpc_core::StaticMetadataSlice(&refcounts[37].base, 80, g_bytes+594),
 grpc_core::StaticMetadataSlice(&refcounts[38].base, 7, g_bytes+674),
 grpc_core::StaticMetadataSlice(&refcounts[39].base, 4, g_bytes+681),
 grpc_core::StaticMetadataSlice(&refcounts[40].base, 4, g_bytes+685),
-grpc_core::StaticMetadataSlice(&refcounts[41].base, 11, g_bytes+689),
-grpc_core::StaticMetadataSlice(&refcounts[42].base, 11, g_bytes+700),
-grpc_core::StaticMetadataSlice(&refcounts[43].base, 3, g_bytes+711),
-grpc_core::StaticMetadataSlice(&refcounts[44].base, 4, g_bytes+714),
-grpc_core::StaticMetadataSlice(&refcounts[45].base, 1, g_bytes+718),
-grpc_core::StaticMetadataSlice(&refcounts[46].base, 11, g_bytes+719),
-grpc_core::StaticMetadataSlice(&refcounts[47].base, 4, g_bytes+730),
-grpc_core::StaticMetadataSlice(&refcounts[48].base, 5, g_bytes+734),
-grpc_core::StaticMetadataSlice(&refcounts[49].base, 3, g_bytes+739),
+grpc_core::StaticMetadataSlice(&refcounts[41].base, 3, g_bytes+689),
+grpc_core::StaticMetadataSlice(&refcounts[42].base, 11, g_bytes+692),
+grpc_core::StaticMetadataSlice(&refcounts[43].base, 11, g_bytes+703),
+grpc_core::StaticMetadataSlice(&refcounts[44].base, 3, g_bytes+714),
+grpc_core::StaticMetadataSlice(&refcounts[45].base, 4, g_bytes+717),
+grpc_core::StaticMetadataSlice(&refcounts[46].base, 1, g_bytes+721),
+grpc_core::StaticMetadataSlice(&refcounts[47].base, 11, g_bytes+722),
+grpc_core::StaticMetadataSlice(&refcounts[48].base, 4, g_bytes+733),
+grpc_core::StaticMetadataSlice(&refcounts[49].base, 5, g_bytes+737),
 grpc_core::StaticMetadataSlice(&refcounts[50].base, 3, g_bytes+742),
 grpc_core::StaticMetadataSlice(&refcounts[51].base, 3, g_bytes+745),
 grpc_core::StaticMetadataSlice(&refcounts[52].base, 3, g_bytes+748),
 grpc_core::StaticMetadataSlice(&refcounts[53].base, 3, g_bytes+751),
 grpc_core::StaticMetadataSlice(&refcounts[54].base, 3, g_bytes+754),
 grpc_core::StaticMetadataSlice(&refcounts[55].base, 3, g_bytes+757),
-grpc_core::StaticMetadataSlice(&refcounts[56].base, 14, g_bytes+760),
-grpc_core::StaticMetadataSlice(&refcounts[57].base, 12, g_bytes+774),
-grpc_core::StaticMetadataSlice(&refcounts[58].base, 15, g_bytes+786),
-grpc_core::StaticMetadataSlice(&refcounts[59].base, 13, g_bytes+801),
-grpc_core::StaticMetadataSlice(&refcounts[60].base, 6, g_bytes+814),
-grpc_core::StaticMetadataSlice(&refcounts[61].base, 27, g_bytes+820),
-grpc_core::StaticMetadataSlice(&refcounts[62].base, 3, g_bytes+847),
-grpc_core::StaticMetadataSlice(&refcounts[63].base, 5, g_bytes+850),
-grpc_core::StaticMetadataSlice(&refcounts[64].base, 13, g_bytes+855),
-grpc_core::StaticMetadataSlice(&refcounts[65].base, 13, g_bytes+868),
-grpc_core::StaticMetadataSlice(&refcounts[66].base, 19, g_bytes+881),
-grpc_core::StaticMetadataSlice(&refcounts[67].base, 16, g_bytes+900),
-grpc_core::StaticMetadataSlice(&refcounts[68].base, 14, g_bytes+916),
-grpc_core::StaticMetadataSlice(&refcounts[69].base, 16, g_bytes+930),
-grpc_core::StaticMetadataSlice(&refcounts[70].base, 13, g_bytes+946),
-grpc_core::StaticMetadataSlice(&refcounts[71].base, 6, g_bytes+959),
-grpc_core::StaticMetadataSlice(&refcounts[72].base, 4, g_bytes+965),
-grpc_core::StaticMetadataSlice(&refcounts[73].base, 4, g_bytes+969),
-grpc_core::StaticMetadataSlice(&refcounts[74].base, 6, g_bytes+973),
-grpc_core::StaticMetadataSlice(&refcounts[75].base, 7, g_bytes+979),
-grpc_core::StaticMetadataSlice(&refcounts[76].base, 4, g_bytes+986),
-grpc_core::StaticMetadataSlice(&refcounts[77].base, 8, g_bytes+990),
-grpc_core::StaticMetadataSlice(&refcounts[78].base, 17, g_bytes+998),
-grpc_core::StaticMetadataSlice(&refcounts[79].base, 13, g_bytes+1015),
-grpc_core::StaticMetadataSlice(&refcounts[80].base, 8, g_bytes+1028),
-grpc_core::StaticMetadataSlice(&refcounts[81].base, 19, g_bytes+1036),
-grpc_core::StaticMetadataSlice(&refcounts[82].base, 13, g_bytes+1055),
-grpc_core::StaticMetadataSlice(&refcounts[83].base, 4, g_bytes+1068),
-grpc_core::StaticMetadataSlice(&refcounts[84].base, 8, g_bytes+1072),
-grpc_core::StaticMetadataSlice(&refcounts[85].base, 12, g_bytes+1080),
-grpc_core::StaticMetadataSlice(&refcounts[86].base, 18, g_bytes+1092),
-grpc_core::StaticMetadataSlice(&refcounts[87].base, 19, g_bytes+1110),
-grpc_core::StaticMetadataSlice(&refcounts[88].base, 5, g_bytes+1129),
-grpc_core::StaticMetadataSlice(&refcounts[89].base, 7, g_bytes+1134),
-grpc_core::StaticMetadataSlice(&refcounts[90].base, 7, g_bytes+1141),
-grpc_core::StaticMetadataSlice(&refcounts[91].base, 11, g_bytes+1148),
-grpc_core::StaticMetadataSlice(&refcounts[92].base, 6, g_bytes+1159),
-grpc_core::StaticMetadataSlice(&refcounts[93].base, 10, g_bytes+1165),
-grpc_core::StaticMetadataSlice(&refcounts[94].base, 25, g_bytes+1175),
-grpc_core::StaticMetadataSlice(&refcounts[95].base, 17, g_bytes+1200),
-grpc_core::StaticMetadataSlice(&refcounts[96].base, 4, g_bytes+1217),
-grpc_core::StaticMetadataSlice(&refcounts[97].base, 3, g_bytes+1221),
-grpc_core::StaticMetadataSlice(&refcounts[98].base, 16, g_bytes+1224),
-grpc_core::StaticMetadataSlice(&refcounts[99].base, 1, g_bytes+1240),
-grpc_core::StaticMetadataSlice(&refcounts[100].base, 8, g_bytes+1241),
-grpc_core::StaticMetadataSlice(&refcounts[101].base, 8, g_bytes+1249),
-grpc_core::StaticMetadataSlice(&refcounts[102].base, 16, g_bytes+1257),
-grpc_core::StaticMetadataSlice(&refcounts[103].base, 4, g_bytes+1273),
-grpc_core::StaticMetadataSlice(&refcounts[104].base, 3, g_bytes+1277),
-grpc_core::StaticMetadataSlice(&refcounts[105].base, 11, g_bytes+1280),
-grpc_core::StaticMetadataSlice(&refcounts[106].base, 16, g_bytes+1291),
-grpc_core::StaticMetadataSlice(&refcounts[107].base, 13, g_bytes+1307),
-grpc_core::StaticMetadataSlice(&refcounts[108].base, 12, g_bytes+1320),
-grpc_core::StaticMetadataSlice(&refcounts[109].base, 21, g_bytes+1332),
-grpc_core::StaticMetadataSlice(&refcounts[110].base, 13, g_bytes+1353),
-grpc_core::StaticMetadataSlice(&refcounts[111].base, 12, g_bytes+1366),
-grpc_core::StaticMetadataSlice(&refcounts[112].base, 21, g_bytes+1378),
-grpc_core::StaticMetadataSlice(&refcounts[113].base, 9, g_bytes+1399),
-grpc_core::StaticMetadataSlice(&refcounts[114].base, 18, g_bytes+1408),
-grpc_core::StaticMetadataSlice(&refcounts[115].base, 17, g_bytes+1426),
-grpc_core::StaticMetadataSlice(&refcounts[116].base, 26, g_bytes+1443),
+grpc_core::StaticMetadataSlice(&refcounts[56].base, 3, g_bytes+760),
+grpc_core::StaticMetadataSlice(&refcounts[57].base, 14, g_bytes+763),
+grpc_core::StaticMetadataSlice(&refcounts[58].base, 12, g_bytes+777),
+grpc_core::StaticMetadataSlice(&refcounts[59].base, 15, g_bytes+789),
+grpc_core::StaticMetadataSlice(&refcounts[60].base, 13, g_bytes+804),
+grpc_core::StaticMetadataSlice(&refcounts[61].base, 6, g_bytes+817),
+grpc_core::StaticMetadataSlice(&refcounts[62].base, 27, g_bytes+823),
+grpc_core::StaticMetadataSlice(&refcounts[63].base, 3, g_bytes+850),
+grpc_core::StaticMetadataSlice(&refcounts[64].base, 5, g_bytes+853),
+grpc_core::StaticMetadataSlice(&refcounts[65].base, 13, g_bytes+858),
+grpc_core::StaticMetadataSlice(&refcounts[66].base, 13, g_bytes+871),
+grpc_core::StaticMetadataSlice(&refcounts[67].base, 19, g_bytes+884),
+grpc_core::StaticMetadataSlice(&refcounts[68].base, 16, g_bytes+903),
+grpc_core::StaticMetadataSlice(&refcounts[69].base, 14, g_bytes+919),
+grpc_core::StaticMetadataSlice(&refcounts[70].base, 16, g_bytes+933),
+grpc_core::StaticMetadataSlice(&refcounts[71].base, 13, g_bytes+949),
+grpc_core::StaticMetadataSlice(&refcounts[72].base, 6, g_bytes+962),
+grpc_core::StaticMetadataSlice(&refcounts[73].base, 4, g_bytes+968),
+grpc_core::StaticMetadataSlice(&refcounts[74].base, 4, g_bytes+972),
+grpc_core::StaticMetadataSlice(&refcounts[75].base, 6, g_bytes+976),
+grpc_core::StaticMetadataSlice(&refcounts[76].base, 7, g_bytes+982),
+grpc_core::StaticMetadataSlice(&refcounts[77].base, 4, g_bytes+989),
+grpc_core::StaticMetadataSlice(&refcounts[78].base, 8, g_bytes+993),
+grpc_core::StaticMetadataSlice(&refcounts[79].base, 17, g_bytes+1001),
+grpc_core::StaticMetadataSlice(&refcounts[80].base, 13, g_bytes+1018),
+grpc_core::StaticMetadataSlice(&refcounts[81].base, 8, g_bytes+1031),
+grpc_core::StaticMetadataSlice(&refcounts[82].base, 19, g_bytes+1039),
+grpc_core::StaticMetadataSlice(&refcounts[83].base, 13, g_bytes+1058),
+grpc_core::StaticMetadataSlice(&refcounts[84].base, 4, g_bytes+1071),
+grpc_core::StaticMetadataSlice(&refcounts[85].base, 8, g_bytes+1075),
+grpc_core::StaticMetadataSlice(&refcounts[86].base, 12, g_bytes+1083),
+grpc_core::StaticMetadataSlice(&refcounts[87].base, 18, g_bytes+1095),
+grpc_core::StaticMetadataSlice(&refcounts[88].base, 19, g_bytes+1113),
+grpc_core::StaticMetadataSlice(&refcounts[89].base, 5, g_bytes+1132),
+grpc_core::StaticMetadataSlice(&refcounts[90].base, 7, g_bytes+1137),
+grpc_core::StaticMetadataSlice(&refcounts[91].base, 7, g_bytes+1144),
+grpc_core::StaticMetadataSlice(&refcounts[92].base, 11, g_bytes+1151),
+grpc_core::StaticMetadataSlice(&refcounts[93].base, 6, g_bytes+1162),
+grpc_core::StaticMetadataSlice(&refcounts[94].base, 10, g_bytes+1168),
+grpc_core::StaticMetadataSlice(&refcounts[95].base, 25, g_bytes+1178),
+grpc_core::StaticMetadataSlice(&refcounts[96].base, 17, g_bytes+1203),
+grpc_core::StaticMetadataSlice(&refcounts[97].base, 4, g_bytes+1220),
+grpc_core::StaticMetadataSlice(&refcounts[98].base, 3, g_bytes+1224),
+grpc_core::StaticMetadataSlice(&refcounts[99].base, 16, g_bytes+1227),
+grpc_core::StaticMetadataSlice(&refcounts[100].base, 1, g_bytes+1243),
+grpc_core::StaticMetadataSlice(&refcounts[101].base, 8, g_bytes+1244),
+grpc_core::StaticMetadataSlice(&refcounts[102].base, 8, g_bytes+1252),
+grpc_core::StaticMetadataSlice(&refcounts[103].base, 16, g_bytes+1260),
+grpc_core::StaticMetadataSlice(&refcounts[104].base, 4, g_bytes+1276),
+grpc_core::StaticMetadataSlice(&refcounts[105].base, 3, g_bytes+1280),
+grpc_core::StaticMetadataSlice(&refcounts[106].base, 11, g_bytes+1283),
+grpc_core::StaticMetadataSlice(&refcounts[107].base, 16, g_bytes+1294),
+grpc_core::StaticMetadataSlice(&refcounts[108].base, 13, g_bytes+1310),
+grpc_core::StaticMetadataSlice(&refcounts[109].base, 12, g_bytes+1323),
+grpc_core::StaticMetadataSlice(&refcounts[110].base, 21, g_bytes+1335),
+grpc_core::StaticMetadataSlice(&refcounts[111].base, 13, g_bytes+1356),
+grpc_core::StaticMetadataSlice(&refcounts[112].base, 12, g_bytes+1369),
+grpc_core::StaticMetadataSlice(&refcounts[113].base, 21, g_bytes+1381),
+grpc_core::StaticMetadataSlice(&refcounts[114].base, 9, g_bytes+1402),
+grpc_core::StaticMetadataSlice(&refcounts[115].base, 18, g_bytes+1411),
+grpc_core::StaticMetadataSlice(&refcounts[116].base, 17, g_bytes+1429),
+grpc_core::StaticMetadataSlice(&refcounts[117].base, 26, g_bytes+1446),
+grpc_core::StaticMetadataSlice(&refcounts[118].base, 12, g_bytes+1472),
+grpc_core::StaticMetadataSlice(&refcounts[119].base, 11, g_bytes+1484),
+grpc_core::StaticMetadataSlice(&refcounts[120].base, 20, g_bytes+1495),
+grpc_core::StaticMetadataSlice(&refcounts[121].base, 8, g_bytes+1515),
+grpc_core::StaticMetadataSlice(&refcounts[122].base, 17, g_bytes+1523),
+grpc_core::StaticMetadataSlice(&refcounts[123].base, 16, g_bytes+1540),
+grpc_core::StaticMetadataSlice(&refcounts[124].base, 25, g_bytes+1556),
+grpc_core::StaticMetadataSlice(&refcounts[125].base, 8, g_bytes+1581),
+grpc_core::StaticMetadataSlice(&refcounts[126].base, 17, g_bytes+1589),
+grpc_core::StaticMetadataSlice(&refcounts[127].base, 16, g_bytes+1606),
+grpc_core::StaticMetadataSlice(&refcounts[128].base, 25, g_bytes+1622),
+grpc_core::StaticMetadataSlice(&refcounts[129].base, 13, g_bytes+1647),
+grpc_core::StaticMetadataSlice(&refcounts[130].base, 22, g_bytes+1660),
+grpc_core::StaticMetadataSlice(&refcounts[131].base, 21, g_bytes+1682),
+grpc_core::StaticMetadataSlice(&refcounts[132].base, 30, g_bytes+1703),
 };
 StaticMetadata static_mdelem_table[GRPC_STATIC_MDELEM_COUNT] = {
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[3].base, 10, g_bytes+19),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 0),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[1].base, 7, g_bytes+5),grpc_core::StaticMetadataSlice(&refcounts[43].base, 3, g_bytes+711), 1),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[1].base, 7, g_bytes+5),grpc_core::StaticMetadataSlice(&refcounts[44].base, 4, g_bytes+714), 2),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[0].base, 5, g_bytes+0),grpc_core::StaticMetadataSlice(&refcounts[45].base, 1, g_bytes+718), 3),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[0].base, 5, g_bytes+0),grpc_core::StaticMetadataSlice(&refcounts[46].base, 11, g_bytes+719), 4),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[4].base, 7, g_bytes+29),grpc_core::StaticMetadataSlice(&refcounts[47].base, 4, g_bytes+730), 5),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[4].base, 7, g_bytes+29),grpc_core::StaticMetadataSlice(&refcounts[48].base, 5, g_bytes+734), 6),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[49].base, 3, g_bytes+739), 7),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[50].base, 3, g_bytes+742), 8),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[51].base, 3, g_bytes+745), 9),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[52].base, 3, g_bytes+748), 10),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[53].base, 3, g_bytes+751), 11),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[54].base, 3, g_bytes+754), 12),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[55].base, 3, g_bytes+757), 13),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[56].base, 14, g_bytes+760),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 14),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[57].base, 12, g_bytes+774), 15),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[1].base, 7, g_bytes+5),grpc_core::StaticMetadataSlice(&refcounts[44].base, 3, g_bytes+714), 1),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[1].base, 7, g_bytes+5),grpc_core::StaticMetadataSlice(&refcounts[45].base, 4, g_bytes+717), 2),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[0].base, 5, g_bytes+0),grpc_core::StaticMetadataSlice(&refcounts[46].base, 1, g_bytes+721), 3),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[0].base, 5, g_bytes+0),grpc_core::StaticMetadataSlice(&refcounts[47].base, 11, g_bytes+722), 4),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[4].base, 7, g_bytes+29),grpc_core::StaticMetadataSlice(&refcounts[48].base, 4, g_bytes+733), 5),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[4].base, 7, g_bytes+29),grpc_core::StaticMetadataSlice(&refcounts[49].base, 5, g_bytes+737), 6),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[50].base, 3, g_bytes+742), 7),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[51].base, 3, g_bytes+745), 8),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[52].base, 3, g_bytes+748), 9),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[53].base, 3, g_bytes+751), 10),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[54].base, 3, g_bytes+754), 11),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[55].base, 3, g_bytes+757), 12),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[2].base, 7, g_bytes+12),grpc_core::StaticMetadataSlice(&refcounts[56].base, 3, g_bytes+760), 13),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[57].base, 14, g_bytes+763),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 14),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[58].base, 12, g_bytes+777), 15),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[40].base, 4, g_bytes+685), 16),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[58].base, 15, g_bytes+786),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 17),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[59].base, 13, g_bytes+801),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 18),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[60].base, 6, g_bytes+814),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 19),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[61].base, 27, g_bytes+820),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 20),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[62].base, 3, g_bytes+847),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 21),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[63].base, 5, g_bytes+850),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 22),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[64].base, 13, g_bytes+855),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 23),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[65].base, 13, g_bytes+868),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 24),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[66].base, 19, g_bytes+881),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 25),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[59].base, 15, g_bytes+789),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 17),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[60].base, 13, g_bytes+804),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 18),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[61].base, 6, g_bytes+817),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 19),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[62].base, 27, g_bytes+823),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 20),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[63].base, 3, g_bytes+850),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 21),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[64].base, 5, g_bytes+853),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 22),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[65].base, 13, g_bytes+858),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 23),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[66].base, 13, g_bytes+871),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 24),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[67].base, 19, g_bytes+884),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 25),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[15].base, 16, g_bytes+170),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 26),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[67].base, 16, g_bytes+900),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 27),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[68].base, 14, g_bytes+916),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 28),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[69].base, 16, g_bytes+930),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 29),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[70].base, 13, g_bytes+946),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 30),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[68].base, 16, g_bytes+903),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 27),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[69].base, 14, g_bytes+919),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 28),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[70].base, 16, g_bytes+933),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 29),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[71].base, 13, g_bytes+949),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 30),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[14].base, 12, g_bytes+158),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 31),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[71].base, 6, g_bytes+959),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 32),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[72].base, 4, g_bytes+965),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 33),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[73].base, 4, g_bytes+969),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 34),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[74].base, 6, g_bytes+973),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 35),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[75].base, 7, g_bytes+979),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 36),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[76].base, 4, g_bytes+986),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 37),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[72].base, 6, g_bytes+962),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 32),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[73].base, 4, g_bytes+968),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 33),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[74].base, 4, g_bytes+972),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 34),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[75].base, 6, g_bytes+976),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 35),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[76].base, 7, g_bytes+982),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 36),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[77].base, 4, g_bytes+989),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 37),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[20].base, 4, g_bytes+278),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 38),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[77].base, 8, g_bytes+990),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 39),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[78].base, 17, g_bytes+998),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 40),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[79].base, 13, g_bytes+1015),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 41),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[80].base, 8, g_bytes+1028),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 42),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[81].base, 19, g_bytes+1036),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 43),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[82].base, 13, g_bytes+1055),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 44),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[83].base, 4, g_bytes+1068),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 45),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[84].base, 8, g_bytes+1072),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 46),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[85].base, 12, g_bytes+1080),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 47),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[86].base, 18, g_bytes+1092),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 48),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[87].base, 19, g_bytes+1110),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 49),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[88].base, 5, g_bytes+1129),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 50),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[89].base, 7, g_bytes+1134),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 51),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[90].base, 7, g_bytes+1141),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 52),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[91].base, 11, g_bytes+1148),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 53),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[92].base, 6, g_bytes+1159),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 54),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[93].base, 10, g_bytes+1165),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 55),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[94].base, 25, g_bytes+1175),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 56),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[95].base, 17, g_bytes+1200),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 57),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[78].base, 8, g_bytes+993),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 39),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[79].base, 17, g_bytes+1001),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 40),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[80].base, 13, g_bytes+1018),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 41),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[81].base, 8, g_bytes+1031),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 42),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[82].base, 19, g_bytes+1039),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 43),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[83].base, 13, g_bytes+1058),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 44),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[84].base, 4, g_bytes+1071),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 45),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[85].base, 8, g_bytes+1075),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 46),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[86].base, 12, g_bytes+1083),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 47),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[87].base, 18, g_bytes+1095),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 48),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[88].base, 19, g_bytes+1113),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 49),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[89].base, 5, g_bytes+1132),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 50),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[90].base, 7, g_bytes+1137),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 51),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[91].base, 7, g_bytes+1144),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 52),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[92].base, 11, g_bytes+1151),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 53),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[93].base, 6, g_bytes+1162),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 54),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[94].base, 10, g_bytes+1168),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 55),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[95].base, 25, g_bytes+1178),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 56),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[96].base, 17, g_bytes+1203),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 57),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[19].base, 10, g_bytes+268),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 58),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[96].base, 4, g_bytes+1217),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 59),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[97].base, 3, g_bytes+1221),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 60),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[98].base, 16, g_bytes+1224),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 61),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[7].base, 11, g_bytes+50),grpc_core::StaticMetadataSlice(&refcounts[99].base, 1, g_bytes+1240), 62),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[97].base, 4, g_bytes+1220),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 59),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[98].base, 3, g_bytes+1224),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 60),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[99].base, 16, g_bytes+1227),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 61),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[7].base, 11, g_bytes+50),grpc_core::StaticMetadataSlice(&refcounts[100].base, 1, g_bytes+1243), 62),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[7].base, 11, g_bytes+50),grpc_core::StaticMetadataSlice(&refcounts[25].base, 1, g_bytes+369), 63),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[7].base, 11, g_bytes+50),grpc_core::StaticMetadataSlice(&refcounts[26].base, 1, g_bytes+370), 64),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[9].base, 13, g_bytes+77),grpc_core::StaticMetadataSlice(&refcounts[100].base, 8, g_bytes+1241), 65),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[9].base, 13, g_bytes+77),grpc_core::StaticMetadataSlice(&refcounts[101].base, 8, g_bytes+1244), 65),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[9].base, 13, g_bytes+77),grpc_core::StaticMetadataSlice(&refcounts[39].base, 4, g_bytes+681), 66),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[9].base, 13, g_bytes+77),grpc_core::StaticMetadataSlice(&refcounts[38].base, 7, g_bytes+674), 67),
 StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[9].base, 13, g_bytes+77),grpc_core::StaticMetadataSlice(&refcounts[40].base, 4, g_bytes+685), 68),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[5].base, 2, g_bytes+36),grpc_core::StaticMetadataSlice(&refcounts[101].base, 8, g_bytes+1249), 69),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[14].base, 12, g_bytes+158),grpc_core::StaticMetadataSlice(&refcounts[102].base, 16, g_bytes+1257), 70),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[4].base, 7, g_bytes+29),grpc_core::StaticMetadataSlice(&refcounts[103].base, 4, g_bytes+1273), 71),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[1].base, 7, g_bytes+5),grpc_core::StaticMetadataSlice(&refcounts[104].base, 3, g_bytes+1277), 72),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 73),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[15].base, 16, g_bytes+170),grpc_core::StaticMetadataSlice(&refcounts[100].base, 8, g_bytes+1241), 74),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[15].base, 16, g_bytes+170),grpc_core::StaticMetadataSlice(&refcounts[39].base, 4, g_bytes+681), 75),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[15].base, 16, g_bytes+170),grpc_core::StaticMetadataSlice(&refcounts[40].base, 4, g_bytes+685), 76),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[105].base, 11, g_bytes+1280),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 77),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[100].base, 8, g_bytes+1241), 78),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[38].base, 7, g_bytes+674), 79),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[106].base, 16, g_bytes+1291), 80),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[39].base, 4, g_bytes+681), 81),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[107].base, 13, g_bytes+1307), 82),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[108].base, 12, g_bytes+1320), 83),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[109].base, 21, g_bytes+1332), 84),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[40].base, 4, g_bytes+685), 85),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[110].base, 13, g_bytes+1353), 86),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[111].base, 12, g_bytes+1366), 87),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[112].base, 21, g_bytes+1378), 88),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[113].base, 9, g_bytes+1399), 89),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[114].base, 18, g_bytes+1408), 90),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[115].base, 17, g_bytes+1426), 91),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[116].base, 26, g_bytes+1443), 92),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[100].base, 8, g_bytes+1241), 93),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[39].base, 4, g_bytes+681), 94),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[107].base, 13, g_bytes+1307), 95),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[110].base, 13, g_bytes+1353), 96),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[113].base, 9, g_bytes+1399), 97),
-StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[114].base, 18, g_bytes+1408), 98),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[9].base, 13, g_bytes+77),grpc_core::StaticMetadataSlice(&refcounts[41].base, 3, g_bytes+689), 69),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[5].base, 2, g_bytes+36),grpc_core::StaticMetadataSlice(&refcounts[102].base, 8, g_bytes+1252), 70),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[14].base, 12, g_bytes+158),grpc_core::StaticMetadataSlice(&refcounts[103].base, 16, g_bytes+1260), 71),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[4].base, 7, g_bytes+29),grpc_core::StaticMetadataSlice(&refcounts[104].base, 4, g_bytes+1276), 72),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[1].base, 7, g_bytes+5),grpc_core::StaticMetadataSlice(&refcounts[105].base, 3, g_bytes+1280), 73),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 74),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[15].base, 16, g_bytes+170),grpc_core::StaticMetadataSlice(&refcounts[101].base, 8, g_bytes+1244), 75),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[15].base, 16, g_bytes+170),grpc_core::StaticMetadataSlice(&refcounts[39].base, 4, g_bytes+681), 76),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[15].base, 16, g_bytes+170),grpc_core::StaticMetadataSlice(&refcounts[40].base, 4, g_bytes+685), 77),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[106].base, 11, g_bytes+1283),grpc_core::StaticMetadataSlice(&refcounts[29].base, 0, g_bytes+373), 78),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[101].base, 8, g_bytes+1244), 79),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[38].base, 7, g_bytes+674), 80),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[107].base, 16, g_bytes+1294), 81),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[39].base, 4, g_bytes+681), 82),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[108].base, 13, g_bytes+1310), 83),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[109].base, 12, g_bytes+1323), 84),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[110].base, 21, g_bytes+1335), 85),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[40].base, 4, g_bytes+685), 86),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[111].base, 13, g_bytes+1356), 87),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[112].base, 12, g_bytes+1369), 88),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[113].base, 21, g_bytes+1381), 89),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[114].base, 9, g_bytes+1402), 90),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[115].base, 18, g_bytes+1411), 91),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[116].base, 17, g_bytes+1429), 92),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[117].base, 26, g_bytes+1446), 93),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[41].base, 3, g_bytes+689), 94),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[118].base, 12, g_bytes+1472), 95),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[119].base, 11, g_bytes+1484), 96),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[120].base, 20, g_bytes+1495), 97),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[121].base, 8, g_bytes+1515), 98),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[122].base, 17, g_bytes+1523), 99),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[123].base, 16, g_bytes+1540), 100),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[124].base, 25, g_bytes+1556), 101),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[125].base, 8, g_bytes+1581), 102),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[126].base, 17, g_bytes+1589), 103),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[127].base, 16, g_bytes+1606), 104),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[128].base, 25, g_bytes+1622), 105),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[129].base, 13, g_bytes+1647), 106),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[130].base, 22, g_bytes+1660), 107),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[131].base, 21, g_bytes+1682), 108),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[10].base, 20, g_bytes+90),grpc_core::StaticMetadataSlice(&refcounts[132].base, 30, g_bytes+1703), 109),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[101].base, 8, g_bytes+1244), 110),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[39].base, 4, g_bytes+681), 111),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[108].base, 13, g_bytes+1310), 112),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[111].base, 13, g_bytes+1356), 113),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[114].base, 9, g_bytes+1402), 114),
+StaticMetadata(grpc_core::StaticMetadataSlice(&refcounts[16].base, 15, g_bytes+186),grpc_core::StaticMetadataSlice(&refcounts[115].base, 18, g_bytes+1411), 115),
 };
 
 /* Warning: the core static metadata currently operates under the soft constraint
@@ -739,155 +788,240 @@ grpc_mdelem static_mdelem_manifested[GRPC_STATIC_MDELEM_COUNT] = {
     GRPC_MAKE_MDELEM(
         &static_mdelem_table[68].data(),
         GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ENCODING_LZ4: 
+     "grpc-encoding": "lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[69].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_TE_TRAILERS: 
      "te": "trailers" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[69].data(),
+        &static_mdelem_table[70].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_CONTENT_TYPE_APPLICATION_SLASH_GRPC: 
      "content-type": "application/grpc" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[70].data(),
+        &static_mdelem_table[71].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_SCHEME_GRPC: 
      ":scheme": "grpc" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[71].data(),
+        &static_mdelem_table[72].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_METHOD_PUT: 
      ":method": "PUT" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[72].data(),
+        &static_mdelem_table[73].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_ACCEPT_ENCODING_EMPTY: 
      "accept-encoding": "" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[73].data(),
+        &static_mdelem_table[74].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_CONTENT_ENCODING_IDENTITY: 
      "content-encoding": "identity" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[74].data(),
+        &static_mdelem_table[75].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_CONTENT_ENCODING_GZIP: 
      "content-encoding": "gzip" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[75].data(),
+        &static_mdelem_table[76].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_CONTENT_ENCODING_ZSTD: 
      "content-encoding": "zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[76].data(),
+        &static_mdelem_table[77].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_LB_COST_BIN_EMPTY: 
      "lb-cost-bin": "" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[77].data(),
+        &static_mdelem_table[78].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY: 
      "grpc-accept-encoding": "identity" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[78].data(),
+        &static_mdelem_table[79].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE: 
      "grpc-accept-encoding": "deflate" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[79].data(),
+        &static_mdelem_table[80].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE: 
      "grpc-accept-encoding": "identity,deflate" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[80].data(),
+        &static_mdelem_table[81].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP: 
      "grpc-accept-encoding": "gzip" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[81].data(),
+        &static_mdelem_table[82].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP: 
      "grpc-accept-encoding": "identity,gzip" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[82].data(),
+        &static_mdelem_table[83].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP: 
      "grpc-accept-encoding": "deflate,gzip" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[83].data(),
+        &static_mdelem_table[84].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP: 
      "grpc-accept-encoding": "identity,deflate,gzip" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[84].data(),
+        &static_mdelem_table[85].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_ZSTD: 
      "grpc-accept-encoding": "zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[85].data(),
+        &static_mdelem_table[86].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_ZSTD: 
      "grpc-accept-encoding": "identity,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[86].data(),
+        &static_mdelem_table[87].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_ZSTD: 
      "grpc-accept-encoding": "deflate,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[87].data(),
+        &static_mdelem_table[88].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_ZSTD: 
      "grpc-accept-encoding": "identity,deflate,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[88].data(),
+        &static_mdelem_table[89].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP_COMMA_ZSTD: 
      "grpc-accept-encoding": "gzip,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[89].data(),
+        &static_mdelem_table[90].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_ZSTD: 
      "grpc-accept-encoding": "identity,gzip,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[90].data(),
+        &static_mdelem_table[91].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP_COMMA_ZSTD: 
      "grpc-accept-encoding": "deflate,gzip,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[91].data(),
+        &static_mdelem_table[92].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_ZSTD: 
      "grpc-accept-encoding": "identity,deflate,gzip,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[92].data(),
+        &static_mdelem_table[93].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_LZ4: 
+     "grpc-accept-encoding": "lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[94].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_LZ4: 
+     "grpc-accept-encoding": "identity,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[95].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_LZ4: 
+     "grpc-accept-encoding": "deflate,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[96].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_LZ4: 
+     "grpc-accept-encoding": "identity,deflate,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[97].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP_COMMA_LZ4: 
+     "grpc-accept-encoding": "gzip,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[98].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_LZ4: 
+     "grpc-accept-encoding": "identity,gzip,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[99].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP_COMMA_LZ4: 
+     "grpc-accept-encoding": "deflate,gzip,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[100].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_LZ4: 
+     "grpc-accept-encoding": "identity,deflate,gzip,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[101].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_ZSTD_COMMA_LZ4: 
+     "grpc-accept-encoding": "zstd,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[102].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_ZSTD_COMMA_LZ4: 
+     "grpc-accept-encoding": "identity,zstd,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[103].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_ZSTD_COMMA_LZ4: 
+     "grpc-accept-encoding": "deflate,zstd,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[104].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_ZSTD_COMMA_LZ4: 
+     "grpc-accept-encoding": "identity,deflate,zstd,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[105].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP_COMMA_ZSTD_COMMA_LZ4: 
+     "grpc-accept-encoding": "gzip,zstd,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[106].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_ZSTD_COMMA_LZ4: 
+     "grpc-accept-encoding": "identity,gzip,zstd,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[107].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP_COMMA_ZSTD_COMMA_LZ4: 
+     "grpc-accept-encoding": "deflate,gzip,zstd,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[108].data(),
+        GRPC_MDELEM_STORAGE_STATIC),
+    /* GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_ZSTD_COMMA_LZ4: 
+     "grpc-accept-encoding": "identity,deflate,gzip,zstd,lz4" */
+    GRPC_MAKE_MDELEM(
+        &static_mdelem_table[109].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY: 
      "accept-encoding": "identity" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[93].data(),
+        &static_mdelem_table[110].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_ACCEPT_ENCODING_GZIP: 
      "accept-encoding": "gzip" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[94].data(),
+        &static_mdelem_table[111].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP: 
      "accept-encoding": "identity,gzip" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[95].data(),
+        &static_mdelem_table[112].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY_COMMA_ZSTD: 
      "accept-encoding": "identity,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[96].data(),
+        &static_mdelem_table[113].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_ACCEPT_ENCODING_GZIP_COMMA_ZSTD: 
      "accept-encoding": "gzip,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[97].data(),
+        &static_mdelem_table[114].data(),
         GRPC_MDELEM_STORAGE_STATIC),
     /* GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_ZSTD: 
      "accept-encoding": "identity,gzip,zstd" */
     GRPC_MAKE_MDELEM(
-        &static_mdelem_table[98].data(),
+        &static_mdelem_table[115].data(),
         GRPC_MDELEM_STORAGE_STATIC)
 // clang-format on
 };
@@ -933,15 +1067,15 @@ void grpc_destroy_static_metadata_ctx(void) {
 
 
 uintptr_t grpc_static_mdelem_user_data[GRPC_STATIC_MDELEM_COUNT] = {
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,4,4,6,6,8,8,10,10,12,12,14,14,16,16,2,4,4,6,8,8
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,4,4,6,6,8,8,10,10,12,12,14,14,16,16,18,18,20,20,22,22,24,24,26,26,28,28,30,30,32,32,2,4,4,6,8,8
 };
 
 
-static const int8_t elems_r[] = {32,21,1,33,1,-50,0,7,0,-45,-14,-4,0,0,-26,-25,-33,-16,0,-55,-60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-53,0,-64,0,64,37,33,28,60,17,31,6,1,-4,-9,-10,-15,-20,-24,-29,-34,-39,0,68,63,59,54,50,45,40,35,30,25,20,16,11,7,2,-2,-7,-12,-17,0,89,84,79,0,0,0,0,0,0,38};
+static const int8_t elems_r[] = {14,40,-8,0,-7,-58,0,14,0,7,-32,0,0,0,-14,-14,-24,13,0,-40,-43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-58,0,-64,-67,-70,-72,-75,-78,-73,-74,-77,-80,0,46,43,40,37,34,32,29,26,23,20,17,14,11,8,5,3,0,-3,-5,20,19,19,16,13,10,7,4,1,-2,-5,-8,0,0,0,0,0,0,0,94};
 static uint32_t elems_phash(uint32_t i) {
-  i -= 45;
-  uint32_t x = i % 111;
-  uint32_t y = i / 111;
+  i -= 46;
+  uint32_t x = i % 129;
+  uint32_t y = i / 129;
   uint32_t h = x;
   if (y < GPR_ARRAY_SIZE(elems_r)) {
     uint32_t delta = (uint32_t)elems_r[y];
@@ -950,20 +1084,20 @@ static uint32_t elems_phash(uint32_t i) {
   return h;
 }
     
-static const uint16_t elem_keys[] = {1270,1855,1091,1092,1093,1740,1276,1277,1278,1279,1280,1281,1282,1283,1284,1285,1286,283,284,285,286,287,288,289,1972,160,161,515,516,844,845,1979,45,46,1982,380,686,1985,1986,1208,1209,1210,1667,2252,2369,6581,6815,1901,7049,1784,7166,7283,7517,7751,7868,7985,8102,1911,1912,1794,1795,8219,8336,8453,1153,8570,8687,8804,8921,6932,9038,9155,7634,9272,9389,1929,9506,9623,9740,9857,9974,10091,10208,571,10325,10442,221,10559,10676,7400,10793,10910,11027,11144,11261,11378,11495,12314,0,0,0,0,0,918};
-static const uint8_t elem_idxs[] = {78,74,67,66,68,70,80,82,83,84,86,87,88,89,90,91,92,7,8,9,10,11,12,13,93,1,2,5,6,63,64,95,3,4,96,0,69,97,98,79,81,85,31,58,38,14,17,73,19,26,20,21,23,25,27,28,29,94,16,75,76,30,32,33,65,34,35,36,37,18,39,40,24,41,42,15,43,44,45,46,47,48,49,71,50,51,72,52,53,22,54,55,56,57,59,60,61,77,255,255,255,255,255,62};
+static const uint16_t elem_keys[] = {1368,1369,1370,1371,316,317,318,319,320,321,322,580,581,2239,46,47,2242,2243,767,2556,2689,956,957,2157,7610,1891,7876,8009,8142,2024,8275,8408,8541,2167,2168,1235,1236,1237,1238,2034,2035,8674,177,178,8807,8940,9073,9206,9339,9472,9605,9738,2186,9871,10004,10137,10270,10403,10536,10669,10802,10935,11068,1431,11201,11334,11467,636,11600,1437,1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1448,1449,1450,1451,1452,1453,1454,1455,1456,1457,1458,1459,1460,1461,1462,2229,1031,11733,1298,1965,11866,2096,2236,238,11999,12132,12265,12398,12531,12664,12797,12930,13063,13196,14127,0,428};
+static const uint8_t elem_idxs[] = {80,82,86,94,7,8,9,10,11,12,13,5,6,113,3,4,114,115,70,58,38,63,64,74,14,31,17,18,19,26,20,21,22,111,16,67,66,68,69,76,77,23,1,2,24,25,27,28,29,30,32,33,15,34,35,36,37,39,40,41,42,43,44,79,45,46,47,72,48,81,83,84,85,87,88,89,90,91,92,93,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,62,49,65,71,50,75,112,73,51,52,53,54,55,56,57,59,60,61,78,255,0};
 
 grpc_mdelem grpc_static_mdelem_for_static_strings(intptr_t a, intptr_t b) {
   if (a == -1 || b == -1) return GRPC_MDNULL;
-  uint32_t k = static_cast<uint32_t>(a * 117 + b);
+  uint32_t k = static_cast<uint32_t>(a * 133 + b);
   uint32_t h = elems_phash(k);
   return h < GPR_ARRAY_SIZE(elem_keys) && elem_keys[h] == k && elem_idxs[h] != 255 ? GRPC_MAKE_MDELEM(&grpc_static_mdelem_table()[elem_idxs[h]].data(), GRPC_MDELEM_STORAGE_STATIC) : GRPC_MDNULL;
 }
 
-const uint8_t grpc_static_accept_encoding_metadata[16] = {
-0,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92
+const uint8_t grpc_static_accept_encoding_metadata[32] = {
+0,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109
 };
 
 const uint8_t grpc_static_accept_stream_encoding_metadata[8] = {
-0,93,94,95,16,96,97,98
+0,110,111,112,16,113,114,115
 };
@@ -34,7 +34,7 @@
 #include "src/core/lib/transport/metadata.h"
 
 static_assert(std::is_trivially_destructible<grpc_core::StaticMetadataSlice>::value, "grpc_core::StaticMetadataSlice must be trivially destructible.");
-#define GRPC_STATIC_MDSTR_COUNT 117
+#define GRPC_STATIC_MDSTR_COUNT 133
 
 void grpc_init_static_metadata_ctx(void);
 void grpc_destroy_static_metadata_ctx(void);
@@ -134,158 +134,190 @@ inline const grpc_core::StaticMetadataSlice* grpc_static_slice_table() {
 #define GRPC_MDSTR_GZIP (grpc_static_slice_table()[39])
 /* "zstd" */
 #define GRPC_MDSTR_ZSTD (grpc_static_slice_table()[40])
+/* "lz4" */
+#define GRPC_MDSTR_LZ4 (grpc_static_slice_table()[41])
 /* "stream/gzip" */
-#define GRPC_MDSTR_STREAM_SLASH_GZIP (grpc_static_slice_table()[41])
+#define GRPC_MDSTR_STREAM_SLASH_GZIP (grpc_static_slice_table()[42])
 /* "stream/zstd" */
-#define GRPC_MDSTR_STREAM_SLASH_ZSTD (grpc_static_slice_table()[42])
+#define GRPC_MDSTR_STREAM_SLASH_ZSTD (grpc_static_slice_table()[43])
 /* "GET" */
-#define GRPC_MDSTR_GET (grpc_static_slice_table()[43])
+#define GRPC_MDSTR_GET (grpc_static_slice_table()[44])
 /* "POST" */
-#define GRPC_MDSTR_POST (grpc_static_slice_table()[44])
+#define GRPC_MDSTR_POST (grpc_static_slice_table()[45])
 /* "/" */
-#define GRPC_MDSTR_SLASH (grpc_static_slice_table()[45])
+#define GRPC_MDSTR_SLASH (grpc_static_slice_table()[46])
 /* "/index.html" */
-#define GRPC_MDSTR_SLASH_INDEX_DOT_HTML (grpc_static_slice_table()[46])
+#define GRPC_MDSTR_SLASH_INDEX_DOT_HTML (grpc_static_slice_table()[47])
 /* "http" */
-#define GRPC_MDSTR_HTTP (grpc_static_slice_table()[47])
+#define GRPC_MDSTR_HTTP (grpc_static_slice_table()[48])
 /* "https" */
-#define GRPC_MDSTR_HTTPS (grpc_static_slice_table()[48])
+#define GRPC_MDSTR_HTTPS (grpc_static_slice_table()[49])
 /* "200" */
-#define GRPC_MDSTR_200 (grpc_static_slice_table()[49])
+#define GRPC_MDSTR_200 (grpc_static_slice_table()[50])
 /* "204" */
-#define GRPC_MDSTR_204 (grpc_static_slice_table()[50])
+#define GRPC_MDSTR_204 (grpc_static_slice_table()[51])
 /* "206" */
-#define GRPC_MDSTR_206 (grpc_static_slice_table()[51])
+#define GRPC_MDSTR_206 (grpc_static_slice_table()[52])
 /* "304" */
-#define GRPC_MDSTR_304 (grpc_static_slice_table()[52])
+#define GRPC_MDSTR_304 (grpc_static_slice_table()[53])
 /* "400" */
-#define GRPC_MDSTR_400 (grpc_static_slice_table()[53])
+#define GRPC_MDSTR_400 (grpc_static_slice_table()[54])
 /* "404" */
-#define GRPC_MDSTR_404 (grpc_static_slice_table()[54])
+#define GRPC_MDSTR_404 (grpc_static_slice_table()[55])
 /* "500" */
-#define GRPC_MDSTR_500 (grpc_static_slice_table()[55])
+#define GRPC_MDSTR_500 (grpc_static_slice_table()[56])
 /* "accept-charset" */
-#define GRPC_MDSTR_ACCEPT_CHARSET (grpc_static_slice_table()[56])
+#define GRPC_MDSTR_ACCEPT_CHARSET (grpc_static_slice_table()[57])
 /* "gzip,deflate" */
-#define GRPC_MDSTR_GZIP_COMMA_DEFLATE (grpc_static_slice_table()[57])
+#define GRPC_MDSTR_GZIP_COMMA_DEFLATE (grpc_static_slice_table()[58])
 /* "accept-language" */
-#define GRPC_MDSTR_ACCEPT_LANGUAGE (grpc_static_slice_table()[58])
+#define GRPC_MDSTR_ACCEPT_LANGUAGE (grpc_static_slice_table()[59])
 /* "accept-ranges" */
-#define GRPC_MDSTR_ACCEPT_RANGES (grpc_static_slice_table()[59])
+#define GRPC_MDSTR_ACCEPT_RANGES (grpc_static_slice_table()[60])
 /* "accept" */
-#define GRPC_MDSTR_ACCEPT (grpc_static_slice_table()[60])
+#define GRPC_MDSTR_ACCEPT (grpc_static_slice_table()[61])
 /* "access-control-allow-origin" */
-#define GRPC_MDSTR_ACCESS_CONTROL_ALLOW_ORIGIN (grpc_static_slice_table()[61])
+#define GRPC_MDSTR_ACCESS_CONTROL_ALLOW_ORIGIN (grpc_static_slice_table()[62])
 /* "age" */
-#define GRPC_MDSTR_AGE (grpc_static_slice_table()[62])
+#define GRPC_MDSTR_AGE (grpc_static_slice_table()[63])
 /* "allow" */
-#define GRPC_MDSTR_ALLOW (grpc_static_slice_table()[63])
+#define GRPC_MDSTR_ALLOW (grpc_static_slice_table()[64])
 /* "authorization" */
-#define GRPC_MDSTR_AUTHORIZATION (grpc_static_slice_table()[64])
+#define GRPC_MDSTR_AUTHORIZATION (grpc_static_slice_table()[65])
 /* "cache-control" */
-#define GRPC_MDSTR_CACHE_CONTROL (grpc_static_slice_table()[65])
+#define GRPC_MDSTR_CACHE_CONTROL (grpc_static_slice_table()[66])
 /* "content-disposition" */
-#define GRPC_MDSTR_CONTENT_DISPOSITION (grpc_static_slice_table()[66])
+#define GRPC_MDSTR_CONTENT_DISPOSITION (grpc_static_slice_table()[67])
 /* "content-language" */
-#define GRPC_MDSTR_CONTENT_LANGUAGE (grpc_static_slice_table()[67])
+#define GRPC_MDSTR_CONTENT_LANGUAGE (grpc_static_slice_table()[68])
 /* "content-length" */
-#define GRPC_MDSTR_CONTENT_LENGTH (grpc_static_slice_table()[68])
+#define GRPC_MDSTR_CONTENT_LENGTH (grpc_static_slice_table()[69])
 /* "content-location" */
-#define GRPC_MDSTR_CONTENT_LOCATION (grpc_static_slice_table()[69])
+#define GRPC_MDSTR_CONTENT_LOCATION (grpc_static_slice_table()[70])
 /* "content-range" */
-#define GRPC_MDSTR_CONTENT_RANGE (grpc_static_slice_table()[70])
+#define GRPC_MDSTR_CONTENT_RANGE (grpc_static_slice_table()[71])
 /* "cookie" */
-#define GRPC_MDSTR_COOKIE (grpc_static_slice_table()[71])
+#define GRPC_MDSTR_COOKIE (grpc_static_slice_table()[72])
 /* "date" */
-#define GRPC_MDSTR_DATE (grpc_static_slice_table()[72])
+#define GRPC_MDSTR_DATE (grpc_static_slice_table()[73])
 /* "etag" */
-#define GRPC_MDSTR_ETAG (grpc_static_slice_table()[73])
+#define GRPC_MDSTR_ETAG (grpc_static_slice_table()[74])
 /* "expect" */
-#define GRPC_MDSTR_EXPECT (grpc_static_slice_table()[74])
+#define GRPC_MDSTR_EXPECT (grpc_static_slice_table()[75])
 /* "expires" */
-#define GRPC_MDSTR_EXPIRES (grpc_static_slice_table()[75])
+#define GRPC_MDSTR_EXPIRES (grpc_static_slice_table()[76])
 /* "from" */
-#define GRPC_MDSTR_FROM (grpc_static_slice_table()[76])
+#define GRPC_MDSTR_FROM (grpc_static_slice_table()[77])
 /* "if-match" */
-#define GRPC_MDSTR_IF_MATCH (grpc_static_slice_table()[77])
+#define GRPC_MDSTR_IF_MATCH (grpc_static_slice_table()[78])
 /* "if-modified-since" */
-#define GRPC_MDSTR_IF_MODIFIED_SINCE (grpc_static_slice_table()[78])
+#define GRPC_MDSTR_IF_MODIFIED_SINCE (grpc_static_slice_table()[79])
 /* "if-none-match" */
-#define GRPC_MDSTR_IF_NONE_MATCH (grpc_static_slice_table()[79])
+#define GRPC_MDSTR_IF_NONE_MATCH (grpc_static_slice_table()[80])
 /* "if-range" */
-#define GRPC_MDSTR_IF_RANGE (grpc_static_slice_table()[80])
+#define GRPC_MDSTR_IF_RANGE (grpc_static_slice_table()[81])
 /* "if-unmodified-since" */
-#define GRPC_MDSTR_IF_UNMODIFIED_SINCE (grpc_static_slice_table()[81])
+#define GRPC_MDSTR_IF_UNMODIFIED_SINCE (grpc_static_slice_table()[82])
 /* "last-modified" */
-#define GRPC_MDSTR_LAST_MODIFIED (grpc_static_slice_table()[82])
+#define GRPC_MDSTR_LAST_MODIFIED (grpc_static_slice_table()[83])
 /* "link" */
-#define GRPC_MDSTR_LINK (grpc_static_slice_table()[83])
+#define GRPC_MDSTR_LINK (grpc_static_slice_table()[84])
 /* "location" */
-#define GRPC_MDSTR_LOCATION (grpc_static_slice_table()[84])
+#define GRPC_MDSTR_LOCATION (grpc_static_slice_table()[85])
 /* "max-forwards" */
-#define GRPC_MDSTR_MAX_FORWARDS (grpc_static_slice_table()[85])
+#define GRPC_MDSTR_MAX_FORWARDS (grpc_static_slice_table()[86])
 /* "proxy-authenticate" */
-#define GRPC_MDSTR_PROXY_AUTHENTICATE (grpc_static_slice_table()[86])
+#define GRPC_MDSTR_PROXY_AUTHENTICATE (grpc_static_slice_table()[87])
 /* "proxy-authorization" */
-#define GRPC_MDSTR_PROXY_AUTHORIZATION (grpc_static_slice_table()[87])
+#define GRPC_MDSTR_PROXY_AUTHORIZATION (grpc_static_slice_table()[88])
 /* "range" */
-#define GRPC_MDSTR_RANGE (grpc_static_slice_table()[88])
+#define GRPC_MDSTR_RANGE (grpc_static_slice_table()[89])
 /* "referer" */
-#define GRPC_MDSTR_REFERER (grpc_static_slice_table()[89])
+#define GRPC_MDSTR_REFERER (grpc_static_slice_table()[90])
 /* "refresh" */
-#define GRPC_MDSTR_REFRESH (grpc_static_slice_table()[90])
+#define GRPC_MDSTR_REFRESH (grpc_static_slice_table()[91])
 /* "retry-after" */
-#define GRPC_MDSTR_RETRY_AFTER (grpc_static_slice_table()[91])
+#define GRPC_MDSTR_RETRY_AFTER (grpc_static_slice_table()[92])
 /* "server" */
-#define GRPC_MDSTR_SERVER (grpc_static_slice_table()[92])
+#define GRPC_MDSTR_SERVER (grpc_static_slice_table()[93])
 /* "set-cookie" */
-#define GRPC_MDSTR_SET_COOKIE (grpc_static_slice_table()[93])
+#define GRPC_MDSTR_SET_COOKIE (grpc_static_slice_table()[94])
 /* "strict-transport-security" */
-#define GRPC_MDSTR_STRICT_TRANSPORT_SECURITY (grpc_static_slice_table()[94])
+#define GRPC_MDSTR_STRICT_TRANSPORT_SECURITY (grpc_static_slice_table()[95])
 /* "transfer-encoding" */
-#define GRPC_MDSTR_TRANSFER_ENCODING (grpc_static_slice_table()[95])
+#define GRPC_MDSTR_TRANSFER_ENCODING (grpc_static_slice_table()[96])
 /* "vary" */
-#define GRPC_MDSTR_VARY (grpc_static_slice_table()[96])
+#define GRPC_MDSTR_VARY (grpc_static_slice_table()[97])
 /* "via" */
-#define GRPC_MDSTR_VIA (grpc_static_slice_table()[97])
+#define GRPC_MDSTR_VIA (grpc_static_slice_table()[98])
 /* "www-authenticate" */
-#define GRPC_MDSTR_WWW_AUTHENTICATE (grpc_static_slice_table()[98])
+#define GRPC_MDSTR_WWW_AUTHENTICATE (grpc_static_slice_table()[99])
 /* "0" */
-#define GRPC_MDSTR_0 (grpc_static_slice_table()[99])
+#define GRPC_MDSTR_0 (grpc_static_slice_table()[100])
 /* "identity" */
-#define GRPC_MDSTR_IDENTITY (grpc_static_slice_table()[100])
+#define GRPC_MDSTR_IDENTITY (grpc_static_slice_table()[101])
 /* "trailers" */
-#define GRPC_MDSTR_TRAILERS (grpc_static_slice_table()[101])
+#define GRPC_MDSTR_TRAILERS (grpc_static_slice_table()[102])
 /* "application/grpc" */
-#define GRPC_MDSTR_APPLICATION_SLASH_GRPC (grpc_static_slice_table()[102])
+#define GRPC_MDSTR_APPLICATION_SLASH_GRPC (grpc_static_slice_table()[103])
 /* "grpc" */
-#define GRPC_MDSTR_GRPC (grpc_static_slice_table()[103])
+#define GRPC_MDSTR_GRPC (grpc_static_slice_table()[104])
 /* "PUT" */
-#define GRPC_MDSTR_PUT (grpc_static_slice_table()[104])
+#define GRPC_MDSTR_PUT (grpc_static_slice_table()[105])
 /* "lb-cost-bin" */
-#define GRPC_MDSTR_LB_COST_BIN (grpc_static_slice_table()[105])
+#define GRPC_MDSTR_LB_COST_BIN (grpc_static_slice_table()[106])
 /* "identity,deflate" */
-#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE (grpc_static_slice_table()[106])
+#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE (grpc_static_slice_table()[107])
 /* "identity,gzip" */
-#define GRPC_MDSTR_IDENTITY_COMMA_GZIP (grpc_static_slice_table()[107])
+#define GRPC_MDSTR_IDENTITY_COMMA_GZIP (grpc_static_slice_table()[108])
 /* "deflate,gzip" */
-#define GRPC_MDSTR_DEFLATE_COMMA_GZIP (grpc_static_slice_table()[108])
+#define GRPC_MDSTR_DEFLATE_COMMA_GZIP (grpc_static_slice_table()[109])
 /* "identity,deflate,gzip" */
-#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_GZIP (grpc_static_slice_table()[109])
+#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_GZIP (grpc_static_slice_table()[110])
 /* "identity,zstd" */
-#define GRPC_MDSTR_IDENTITY_COMMA_ZSTD (grpc_static_slice_table()[110])
+#define GRPC_MDSTR_IDENTITY_COMMA_ZSTD (grpc_static_slice_table()[111])
 /* "deflate,zstd" */
-#define GRPC_MDSTR_DEFLATE_COMMA_ZSTD (grpc_static_slice_table()[111])
+#define GRPC_MDSTR_DEFLATE_COMMA_ZSTD (grpc_static_slice_table()[112])
 /* "identity,deflate,zstd" */
-#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_ZSTD (grpc_static_slice_table()[112])
+#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_ZSTD (grpc_static_slice_table()[113])
 /* "gzip,zstd" */
-#define GRPC_MDSTR_GZIP_COMMA_ZSTD (grpc_static_slice_table()[113])
+#define GRPC_MDSTR_GZIP_COMMA_ZSTD (grpc_static_slice_table()[114])
 /* "identity,gzip,zstd" */
-#define GRPC_MDSTR_IDENTITY_COMMA_GZIP_COMMA_ZSTD (grpc_static_slice_table()[114])
+#define GRPC_MDSTR_IDENTITY_COMMA_GZIP_COMMA_ZSTD (grpc_static_slice_table()[115])
 /* "deflate,gzip,zstd" */
-#define GRPC_MDSTR_DEFLATE_COMMA_GZIP_COMMA_ZSTD (grpc_static_slice_table()[115])
+#define GRPC_MDSTR_DEFLATE_COMMA_GZIP_COMMA_ZSTD (grpc_static_slice_table()[116])
 /* "identity,deflate,gzip,zstd" */
-#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_ZSTD (grpc_static_slice_table()[116])
+#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_ZSTD (grpc_static_slice_table()[117])
+/* "identity,lz4" */
+#define GRPC_MDSTR_IDENTITY_COMMA_LZ4 (grpc_static_slice_table()[118])
+/* "deflate,lz4" */
+#define GRPC_MDSTR_DEFLATE_COMMA_LZ4 (grpc_static_slice_table()[119])
+/* "identity,deflate,lz4" */
+#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_LZ4 (grpc_static_slice_table()[120])
+/* "gzip,lz4" */
+#define GRPC_MDSTR_GZIP_COMMA_LZ4 (grpc_static_slice_table()[121])
+/* "identity,gzip,lz4" */
+#define GRPC_MDSTR_IDENTITY_COMMA_GZIP_COMMA_LZ4 (grpc_static_slice_table()[122])
+/* "deflate,gzip,lz4" */
+#define GRPC_MDSTR_DEFLATE_COMMA_GZIP_COMMA_LZ4 (grpc_static_slice_table()[123])
+/* "identity,deflate,gzip,lz4" */
+#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_LZ4 (grpc_static_slice_table()[124])
+/* "zstd,lz4" */
+#define GRPC_MDSTR_ZSTD_COMMA_LZ4 (grpc_static_slice_table()[125])
+/* "identity,zstd,lz4" */
+#define GRPC_MDSTR_IDENTITY_COMMA_ZSTD_COMMA_LZ4 (grpc_static_slice_table()[126])
+/* "deflate,zstd,lz4" */
+#define GRPC_MDSTR_DEFLATE_COMMA_ZSTD_COMMA_LZ4 (grpc_static_slice_table()[127])
+/* "identity,deflate,zstd,lz4" */
+#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_ZSTD_COMMA_LZ4 (grpc_static_slice_table()[128])
+/* "gzip,zstd,lz4" */
+#define GRPC_MDSTR_GZIP_COMMA_ZSTD_COMMA_LZ4 (grpc_static_slice_table()[129])
+/* "identity,gzip,zstd,lz4" */
+#define GRPC_MDSTR_IDENTITY_COMMA_GZIP_COMMA_ZSTD_COMMA_LZ4 (grpc_static_slice_table()[130])
+/* "deflate,gzip,zstd,lz4" */
+#define GRPC_MDSTR_DEFLATE_COMMA_GZIP_COMMA_ZSTD_COMMA_LZ4 (grpc_static_slice_table()[131])
+/* "identity,deflate,gzip,zstd,lz4" */
+#define GRPC_MDSTR_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_ZSTD_COMMA_LZ4 (grpc_static_slice_table()[132])
 
 
 namespace grpc_core {
@@ -305,7 +337,7 @@ inline grpc_core::StaticSliceRefcount* grpc_static_metadata_refcounts() {
 #define GRPC_STATIC_METADATA_INDEX(static_slice) \
 (reinterpret_cast<grpc_core::StaticSliceRefcount*>((static_slice).refcount)->index)
 
-#define GRPC_STATIC_MDELEM_COUNT 99
+#define GRPC_STATIC_MDELEM_COUNT 116
 
 namespace grpc_core {
 extern StaticMetadata* g_static_mdelem_table;
@@ -463,66 +495,100 @@ extern uintptr_t grpc_static_mdelem_user_data[GRPC_STATIC_MDELEM_COUNT];
 #define GRPC_MDELEM_GRPC_ENCODING_DEFLATE (grpc_static_mdelem_manifested()[67])
 /* "grpc-encoding": "zstd" */
 #define GRPC_MDELEM_GRPC_ENCODING_ZSTD (grpc_static_mdelem_manifested()[68])
+/* "grpc-encoding": "lz4" */
+#define GRPC_MDELEM_GRPC_ENCODING_LZ4 (grpc_static_mdelem_manifested()[69])
 /* "te": "trailers" */
-#define GRPC_MDELEM_TE_TRAILERS (grpc_static_mdelem_manifested()[69])
+#define GRPC_MDELEM_TE_TRAILERS (grpc_static_mdelem_manifested()[70])
 /* "content-type": "application/grpc" */
-#define GRPC_MDELEM_CONTENT_TYPE_APPLICATION_SLASH_GRPC (grpc_static_mdelem_manifested()[70])
+#define GRPC_MDELEM_CONTENT_TYPE_APPLICATION_SLASH_GRPC (grpc_static_mdelem_manifested()[71])
 /* ":scheme": "grpc" */
-#define GRPC_MDELEM_SCHEME_GRPC (grpc_static_mdelem_manifested()[71])
+#define GRPC_MDELEM_SCHEME_GRPC (grpc_static_mdelem_manifested()[72])
 /* ":method": "PUT" */
-#define GRPC_MDELEM_METHOD_PUT (grpc_static_mdelem_manifested()[72])
+#define GRPC_MDELEM_METHOD_PUT (grpc_static_mdelem_manifested()[73])
 /* "accept-encoding": "" */
-#define GRPC_MDELEM_ACCEPT_ENCODING_EMPTY (grpc_static_mdelem_manifested()[73])
+#define GRPC_MDELEM_ACCEPT_ENCODING_EMPTY (grpc_static_mdelem_manifested()[74])
 /* "content-encoding": "identity" */
-#define GRPC_MDELEM_CONTENT_ENCODING_IDENTITY (grpc_static_mdelem_manifested()[74])
+#define GRPC_MDELEM_CONTENT_ENCODING_IDENTITY (grpc_static_mdelem_manifested()[75])
 /* "content-encoding": "gzip" */
-#define GRPC_MDELEM_CONTENT_ENCODING_GZIP (grpc_static_mdelem_manifested()[75])
+#define GRPC_MDELEM_CONTENT_ENCODING_GZIP (grpc_static_mdelem_manifested()[76])
 /* "content-encoding": "zstd" */
-#define GRPC_MDELEM_CONTENT_ENCODING_ZSTD (grpc_static_mdelem_manifested()[76])
+#define GRPC_MDELEM_CONTENT_ENCODING_ZSTD (grpc_static_mdelem_manifested()[77])
 /* "lb-cost-bin": "" */
-#define GRPC_MDELEM_LB_COST_BIN_EMPTY (grpc_static_mdelem_manifested()[77])
+#define GRPC_MDELEM_LB_COST_BIN_EMPTY (grpc_static_mdelem_manifested()[78])
 /* "grpc-accept-encoding": "identity" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY (grpc_static_mdelem_manifested()[78])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY (grpc_static_mdelem_manifested()[79])
 /* "grpc-accept-encoding": "deflate" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE (grpc_static_mdelem_manifested()[79])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE (grpc_static_mdelem_manifested()[80])
 /* "grpc-accept-encoding": "identity,deflate" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE (grpc_static_mdelem_manifested()[80])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE (grpc_static_mdelem_manifested()[81])
 /* "grpc-accept-encoding": "gzip" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP (grpc_static_mdelem_manifested()[81])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP (grpc_static_mdelem_manifested()[82])
 /* "grpc-accept-encoding": "identity,gzip" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP (grpc_static_mdelem_manifested()[82])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP (grpc_static_mdelem_manifested()[83])
 /* "grpc-accept-encoding": "deflate,gzip" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP (grpc_static_mdelem_manifested()[83])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP (grpc_static_mdelem_manifested()[84])
 /* "grpc-accept-encoding": "identity,deflate,gzip" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP (grpc_static_mdelem_manifested()[84])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP (grpc_static_mdelem_manifested()[85])
 /* "grpc-accept-encoding": "zstd" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_ZSTD (grpc_static_mdelem_manifested()[85])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_ZSTD (grpc_static_mdelem_manifested()[86])
 /* "grpc-accept-encoding": "identity,zstd" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_ZSTD (grpc_static_mdelem_manifested()[86])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_ZSTD (grpc_static_mdelem_manifested()[87])
 /* "grpc-accept-encoding": "deflate,zstd" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_ZSTD (grpc_static_mdelem_manifested()[87])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_ZSTD (grpc_static_mdelem_manifested()[88])
 /* "grpc-accept-encoding": "identity,deflate,zstd" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_ZSTD (grpc_static_mdelem_manifested()[88])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_ZSTD (grpc_static_mdelem_manifested()[89])
 /* "grpc-accept-encoding": "gzip,zstd" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[89])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[90])
 /* "grpc-accept-encoding": "identity,gzip,zstd" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[90])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[91])
 /* "grpc-accept-encoding": "deflate,gzip,zstd" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[91])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[92])
 /* "grpc-accept-encoding": "identity,deflate,gzip,zstd" */
-#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[92])
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[93])
+/* "grpc-accept-encoding": "lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_LZ4 (grpc_static_mdelem_manifested()[94])
+/* "grpc-accept-encoding": "identity,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_LZ4 (grpc_static_mdelem_manifested()[95])
+/* "grpc-accept-encoding": "deflate,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_LZ4 (grpc_static_mdelem_manifested()[96])
+/* "grpc-accept-encoding": "identity,deflate,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_LZ4 (grpc_static_mdelem_manifested()[97])
+/* "grpc-accept-encoding": "gzip,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP_COMMA_LZ4 (grpc_static_mdelem_manifested()[98])
+/* "grpc-accept-encoding": "identity,gzip,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_LZ4 (grpc_static_mdelem_manifested()[99])
+/* "grpc-accept-encoding": "deflate,gzip,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP_COMMA_LZ4 (grpc_static_mdelem_manifested()[100])
+/* "grpc-accept-encoding": "identity,deflate,gzip,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_LZ4 (grpc_static_mdelem_manifested()[101])
+/* "grpc-accept-encoding": "zstd,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_ZSTD_COMMA_LZ4 (grpc_static_mdelem_manifested()[102])
+/* "grpc-accept-encoding": "identity,zstd,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_ZSTD_COMMA_LZ4 (grpc_static_mdelem_manifested()[103])
+/* "grpc-accept-encoding": "deflate,zstd,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_ZSTD_COMMA_LZ4 (grpc_static_mdelem_manifested()[104])
+/* "grpc-accept-encoding": "identity,deflate,zstd,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_ZSTD_COMMA_LZ4 (grpc_static_mdelem_manifested()[105])
+/* "grpc-accept-encoding": "gzip,zstd,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_GZIP_COMMA_ZSTD_COMMA_LZ4 (grpc_static_mdelem_manifested()[106])
+/* "grpc-accept-encoding": "identity,gzip,zstd,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_ZSTD_COMMA_LZ4 (grpc_static_mdelem_manifested()[107])
+/* "grpc-accept-encoding": "deflate,gzip,zstd,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_DEFLATE_COMMA_GZIP_COMMA_ZSTD_COMMA_LZ4 (grpc_static_mdelem_manifested()[108])
+/* "grpc-accept-encoding": "identity,deflate,gzip,zstd,lz4" */
+#define GRPC_MDELEM_GRPC_ACCEPT_ENCODING_IDENTITY_COMMA_DEFLATE_COMMA_GZIP_COMMA_ZSTD_COMMA_LZ4 (grpc_static_mdelem_manifested()[109])
 /* "accept-encoding": "identity" */
-#define GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY (grpc_static_mdelem_manifested()[93])
+#define GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY (grpc_static_mdelem_manifested()[110])
 /* "accept-encoding": "gzip" */
-#define GRPC_MDELEM_ACCEPT_ENCODING_GZIP (grpc_static_mdelem_manifested()[94])
+#define GRPC_MDELEM_ACCEPT_ENCODING_GZIP (grpc_static_mdelem_manifested()[111])
 /* "accept-encoding": "identity,gzip" */
-#define GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP (grpc_static_mdelem_manifested()[95])
+#define GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP (grpc_static_mdelem_manifested()[112])
 /* "accept-encoding": "identity,zstd" */
-#define GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY_COMMA_ZSTD (grpc_static_mdelem_manifested()[96])
+#define GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY_COMMA_ZSTD (grpc_static_mdelem_manifested()[113])
 /* "accept-encoding": "gzip,zstd" */
-#define GRPC_MDELEM_ACCEPT_ENCODING_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[97])
+#define GRPC_MDELEM_ACCEPT_ENCODING_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[114])
 /* "accept-encoding": "identity,gzip,zstd" */
-#define GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[98])
+#define GRPC_MDELEM_ACCEPT_ENCODING_IDENTITY_COMMA_GZIP_COMMA_ZSTD (grpc_static_mdelem_manifested()[115])
 
 grpc_mdelem grpc_static_mdelem_for_static_strings(intptr_t a, intptr_t b);
 typedef enum {
@@ -586,7 +652,7 @@ typedef union {
 #define GRPC_BATCH_INDEX_OF(slice) \
 (GRPC_IS_STATIC_METADATA_STRING((slice))&&reinterpret_cast<grpc_core::StaticSliceRefcount*>((slice).refcount)->index<=static_cast<uint32_t>(GRPC_BATCH_CALLOUTS_COUNT)?static_cast<grpc_metadata_batch_callouts_index>(reinterpret_cast<grpc_core::StaticSliceRefcount*>((slice).refcount)->index):GRPC_BATCH_CALLOUTS_COUNT)
 
-extern const uint8_t grpc_static_accept_encoding_metadata[16];
+extern const uint8_t grpc_static_accept_encoding_metadata[32];
 #define GRPC_MDELEM_ACCEPT_ENCODING_FOR_ALGORITHMS(algs) (GRPC_MAKE_MDELEM(&grpc_static_mdelem_table()[grpc_static_accept_encoding_metadata[(algs)]].data(), GRPC_MDELEM_STORAGE_STATIC))
 
 extern const uint8_t grpc_static_accept_stream_encoding_metadata[8];
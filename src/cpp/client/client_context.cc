@@ -61,7 +61,9 @@ ClientContext::ClientContext()
       census_context_(nullptr),
       propagate_from_call_(nullptr),
       compression_algorithm_(GRPC_COMPRESS_NONE),
-      initial_metadata_corked_(false) {
+      initial_metadata_corked_(false),
+      pipelined_writes_(false),
+      max_pipelined_write_bytes_(0) {
   g_client_callbacks->DefaultConstructor(this);
 }
 
@@ -144,6 +146,11 @@ void ClientContext::set_compression_algorithm(
   AddMetadata(GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY, algorithm_name);
 }
 
+void ClientContext::set_zstd_compression_level(int level) {
+  AddMetadata(GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY,
+              grpc::to_string(level));
+}
+
 void ClientContext::TryCancel() {
   grpc::internal::MutexLock lock(&mu_);
   if (call_) {
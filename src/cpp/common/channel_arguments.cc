@@ -19,6 +19,7 @@
 
 #include <sstream>
 
+#include <grpc/compression.h>
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/support/log.h>
 #include <grpcpp/grpcpp.h>
@@ -84,6 +85,20 @@ void ChannelArguments::SetCompressionAlgorithm(
   SetInt(GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM, algorithm);
 }
 
+void ChannelArguments::SetZstdDictionary(const grpc::string& method,
+                                         const grpc::string& dictionary) {
+  grpc_zstd_dictionary* c_dictionary =
+      grpc_zstd_dictionary_create(dictionary.data(), dictionary.size());
+  if (c_dictionary == nullptr) {
+    gpr_log(GPR_ERROR, "Invalid zstd dictionary for method %s",
+            method.c_str());
+    return;
+  }
+  SetPointerWithVtable(GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_PREFIX + method,
+                       c_dictionary, grpc_zstd_dictionary_arg_vtable());
+  grpc_zstd_dictionary_unref(c_dictionary);
+}
+
 void ChannelArguments::SetGrpclbFallbackTimeout(int fallback_timeout) {
   SetInt(GRPC_ARG_GRPCLB_FALLBACK_TIMEOUT_MS, fallback_timeout);
 }
@@ -123,6 +123,11 @@ void CoreCodegen::grpc_call_unref(grpc_call* call) { ::grpc_call_unref(call); }
 void* CoreCodegen::grpc_call_arena_alloc(grpc_call* call, size_t length) {
   return ::grpc_call_arena_alloc(call, length);
 }
+int CoreCodegen::grpc_call_compress_message(grpc_call* call,
+                                            grpc_byte_buffer* message,
+                                            grpc_byte_buffer** compressed) {
+  return ::grpc_call_compress_message(call, message, compressed);
+}
 const char* CoreCodegen::grpc_call_error_to_string(grpc_call_error error) {
   return ::grpc_call_error_to_string(error);
 }
@@ -147,11 +152,43 @@ int CoreCodegen::grpc_byte_buffer_reader_peek(grpc_byte_buffer_reader* reader,
   return ::grpc_byte_buffer_reader_peek(reader, slice);
 }
 
+int CoreCodegen::grpc_byte_buffer_reader_failed(
+    grpc_byte_buffer_reader* reader) {
+  return ::grpc_byte_buffer_reader_failed(reader);
+}
+
+int CoreCodegen::grpc_byte_buffer_reader_exceeded_limit(
+    grpc_byte_buffer_reader* reader) {
+  return ::grpc_byte_buffer_reader_exceeded_limit(reader);
+}
+
 grpc_byte_buffer* CoreCodegen::grpc_raw_byte_buffer_create(grpc_slice* slice,
                                                            size_t nslices) {
   return ::grpc_raw_byte_buffer_create(slice, nslices);
 }
 
+grpc_byte_buffer* CoreCodegen::grpc_raw_compressed_byte_buffer_create(
+    grpc_slice* slice, size_t nslices, grpc_compression_algorithm compression) {
+  return ::grpc_raw_compressed_byte_buffer_create(slice, nslices, compression);
+}
+
+grpc_byte_buffer_compressor* CoreCodegen::grpc_byte_buffer_compressor_create(
+    grpc_compression_algorithm compression, int zstd_level,
+    int zstd_window_log_max) {
+  return ::grpc_byte_buffer_compressor_create(compression, zstd_level,
+                                              zstd_window_log_max);
+}
+
+int CoreCodegen::grpc_byte_buffer_compressor_write(
+    grpc_byte_buffer_compressor* compressor, const void* data, size_t length) {
+  return ::grpc_byte_buffer_compressor_write(compressor, data, length);
+}
+
+grpc_byte_buffer* CoreCodegen::grpc_byte_buffer_compressor_finish(
+    grpc_byte_buffer_compressor* compressor) {
+  return ::grpc_byte_buffer_compressor_finish(compressor);
+}
+
 grpc_slice CoreCodegen::grpc_slice_new_with_user_data(void* p, size_t len,
                                                       void (*destroy)(void*),
                                                       void* user_data) {
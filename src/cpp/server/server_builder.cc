@@ -192,6 +192,12 @@ ServerBuilder& ServerBuilder::SetDefaultCompressionAlgorithm(
   return *this;
 }
 
+ServerBuilder& ServerBuilder::SetZstdDictionary(
+    const grpc::string& method, const grpc::string& dictionary) {
+  zstd_dictionaries_.emplace_back(method, dictionary);
+  return *this;
+}
+
 ServerBuilder& ServerBuilder::SetResourceQuota(
     const grpc_impl::ResourceQuota& resource_quota) {
   if (resource_quota_ != nullptr) {
@@ -253,6 +259,9 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
     args.SetInt(GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM,
                 maybe_default_compression_algorithm_.algorithm);
   }
+  for (const auto& dictionary : zstd_dictionaries_) {
+    args.SetZstdDictionary(dictionary.first, dictionary.second);
+  }
 
   if (resource_quota_ != nullptr) {
     args.SetPointerWithVtable(GRPC_ARG_RESOURCE_QUOTA, resource_quota_,
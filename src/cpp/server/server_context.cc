@@ -28,6 +28,7 @@
 #include <grpc/support/log.h>
 #include <grpcpp/impl/call.h>
 #include <grpcpp/impl/codegen/completion_queue_impl.h>
+#include <grpcpp/impl/codegen/sync_stream_impl.h>
 #include <grpcpp/support/server_callback.h>
 #include <grpcpp/support/time.h>
 
@@ -240,7 +241,10 @@ void ServerContextBase::Setup(gpr_timespec deadline) {
   cq_ = nullptr;
   sent_initial_metadata_ = false;
   compression_level_set_ = false;
+  compression_algorithm_ = GRPC_COMPRESS_NONE;
   has_pending_ops_ = false;
+  pipelined_writes_ = false;
+  max_pipelined_write_bytes_ = 0;
   rpc_info_ = nullptr;
 }
 
@@ -253,6 +257,7 @@ void ServerContextBase::BindDeadlineAndMetadata(gpr_timespec deadline,
 ServerContextBase::~ServerContextBase() { Clear(); }
 
 void ServerContextBase::Clear() {
+  write_pipeline_.reset();
   auth_context_.reset();
   initial_metadata_.clear();
   trailing_metadata_.clear();
@@ -355,6 +360,11 @@ void ServerContextBase::set_compression_algorithm(
   AddInitialMetadata(GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY, algorithm_name);
 }
 
+void ServerContextBase::set_zstd_compression_level(int level) {
+  AddInitialMetadata(GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY,
+                     grpc::to_string(level));
+}
+
 grpc::string ServerContextBase::peer() const {
   grpc::string peer;
   if (call_) {
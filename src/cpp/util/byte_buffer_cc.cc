@@ -39,7 +39,60 @@ Status ByteBuffer::Dump(std::vector<Slice>* slices) const {
   while (grpc_byte_buffer_reader_next(&reader, &s)) {
     slices->push_back(Slice(s, Slice::STEAL_REF));
   }
+  const bool failed = grpc_byte_buffer_reader_failed(&reader);
+  const bool exceeded_limit = grpc_byte_buffer_reader_exceeded_limit(&reader);
   grpc_byte_buffer_reader_destroy(&reader);
+  if (exceeded_limit) {
+    slices->clear();
+    return Status(StatusCode::RESOURCE_EXHAUSTED,
+                  "Decompressed byte buffer exceeds the limit");
+  }
+  if (failed) {
+    slices->clear();
+    return Status(StatusCode::INTERNAL, "Couldn't decompress byte buffer");
+  }
+  return Status::OK;
+}
+
+Status ByteBuffer::Compress(grpc_compression_algorithm compression,
+                            ByteBuffer* compressed) const {
+  if (!buffer_) {
+    return Status(StatusCode::FAILED_PRECONDITION, "Buffer not initialized");
+  }
+  grpc_byte_buffer_compressor* compressor =
+      grpc_byte_buffer_compressor_create(
+          compression, GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL, 0);
+  if (compressor == nullptr) {
+    return Status(StatusCode::INVALID_ARGUMENT,
+                  "Not a message compression algorithm");
+  }
+  grpc_byte_buffer_reader reader;
+  if (!grpc_byte_buffer_reader_init(&reader, buffer_)) {
+    grpc_byte_buffer_destroy(grpc_byte_buffer_compressor_finish(compressor));
+    return Status(StatusCode::INTERNAL,
+                  "Couldn't initialize byte buffer reader");
+  }
+  bool ok = true;
+  grpc_slice s;
+  while (grpc_byte_buffer_reader_next(&reader, &s)) {
+    ok = ok && grpc_byte_buffer_compressor_write(
+                   compressor, GRPC_SLICE_START_PTR(s), GRPC_SLICE_LENGTH(s));
+    grpc_slice_unref(s);
+  }
+  const bool exceeded_limit = grpc_byte_buffer_reader_exceeded_limit(&reader);
+  ok = ok && !grpc_byte_buffer_reader_failed(&reader);
+  grpc_byte_buffer_reader_destroy(&reader);
+  grpc_byte_buffer* bb = grpc_byte_buffer_compressor_finish(compressor);
+  if (exceeded_limit) {
+    if (bb != nullptr) grpc_byte_buffer_destroy(bb);
+    return Status(StatusCode::RESOURCE_EXHAUSTED,
+                  "Decompressed byte buffer exceeds the limit");
+  }
+  if (!ok || bb == nullptr) {
+    if (bb != nullptr) grpc_byte_buffer_destroy(bb);
+    return Status(StatusCode::INTERNAL, "Couldn't compress byte buffer");
+  }
+  compressed->set_buffer(bb);
   return Status::OK;
 }
 
@@ -52,6 +52,11 @@ namespace Grpc.Core
         /// feature and is not part of public API.
         /// </summary>
         internal const string CompressionRequestAlgorithmMetadataKey = "grpc-internal-encoding-request";
+
+        /// <summary>
+        /// Metadata key that sets the zstd compression level for given call.
+        /// </summary>
+        internal const string CompressionRequestZstdLevelMetadataKey = "grpc-internal-zstd-level-request";
         static readonly Encoding EncodingASCII = System.Text.Encoding.ASCII;
 
         readonly List<Entry> entries;
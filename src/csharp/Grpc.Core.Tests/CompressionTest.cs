@@ -130,6 +130,27 @@ namespace Grpc.Core.Tests
             Assert.AreEqual(request, response);
         }
 
+        [Test]
+        public void CanReadZstdCompressedMessages()
+        {
+            var compressionMetadata = new Metadata
+            {
+                { new Metadata.Entry(Metadata.CompressionRequestAlgorithmMetadataKey, "zstd") },
+                { new Metadata.Entry(Metadata.CompressionRequestZstdLevelMetadataKey, "3") }
+            };
+
+            helper.UnaryHandler = new UnaryServerMethod<string, string>(async (req, context) =>
+            {
+                await context.WriteResponseHeadersAsync(compressionMetadata);
+                return req;
+            });
+
+            var request = new string('a', 200000);
+            var response = Calls.BlockingUnaryCall(helper.CreateUnaryCall(new CallOptions(compressionMetadata)), request);
+
+            Assert.AreEqual(request, response);
+        }
+
         [Test]
         public void CanReadCompressedMessages_EmptyPayload()
         {
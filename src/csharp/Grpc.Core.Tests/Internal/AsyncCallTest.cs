@@ -427,6 +427,20 @@ namespace Grpc.Core.Internal.Tests
             AssertStreamingResponseError(asyncCall, fakeCall, readTask, StatusCode.Internal);
         }
 
+        [Test]
+        public void ServerStreaming_UndecompressibleResponse_CancelsCall()
+        {
+            asyncCall.StartServerStreamingCall("request1");
+            var responseStream = new ClientResponseStream<string, string>(asyncCall);
+            var readTask = responseStream.MoveNext();
+
+            fakeCall.ReceivedMessageCallback.OnReceivedMessage(true, CreateUndecompressibleResponse());
+            Assert.IsTrue(fakeCall.IsCancelled);
+            fakeCall.ReceivedStatusOnClientCallback.OnReceivedStatusOnClient(true, CreateClientSideStatus(StatusCode.Internal));
+
+            AssertStreamingResponseError(asyncCall, fakeCall, readTask, StatusCode.Internal);
+        }
+
         [Test]
         public void ServerStreaming_MoreResponses_Success()
         {
@@ -647,6 +661,11 @@ namespace Grpc.Core.Internal.Tests
             return fakeBufferReaderManager.CreateSingleSegmentBufferReader(Marshallers.StringMarshaller.Serializer("response1"));
         }
 
+        IBufferReader CreateUndecompressibleResponse()
+        {
+            return fakeBufferReaderManager.CreateUndecompressibleBufferReader();
+        }
+
         IBufferReader CreateNullResponse()
         {
             return fakeBufferReaderManager.CreateNullPayloadBufferReader();
@@ -18,6 +18,7 @@
 
 using System;
 using System.Collections.Generic;
+using System.IO;
 using System.Runtime.InteropServices;
 using System.Threading.Tasks;
 
@@ -56,6 +57,12 @@ namespace Grpc.Core.Internal.Tests
             return new FakeBufferReader(null);
         }
 
+        public IBufferReader CreateUndecompressibleBufferReader()
+        {
+            GrpcPreconditions.CheckState(!disposed);
+            return new UndecompressibleBufferReader();
+        }
+
         public void Dispose()
         {
             if (!disposed)
@@ -68,6 +75,23 @@ namespace Grpc.Core.Internal.Tests
             }
         }
 
+        private class UndecompressibleBufferReader : IBufferReader
+        {
+            public int? TotalLength
+            {
+                get
+                {
+                    throw new IOException("Failed to decompress received message.");
+                }
+            }
+
+            public bool TryGetNextSlice(out Slice slice)
+            {
+                slice = default(Slice);
+                return false;
+            }
+        }
+
         private class FakeBufferReader : IBufferReader
         {
             readonly List<GCHandle> bufferSegments;
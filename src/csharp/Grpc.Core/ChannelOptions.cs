@@ -212,6 +212,12 @@ namespace Grpc.Core
         /// <summary>If non-zero, allow the use of SO_REUSEPORT for server if it's available (default 1)</summary>
         public const string SoReuseport = "grpc.so_reuseport";
 
+        /// <summary>Default compression algorithm for calls, as the integer value of a <see cref="CompressionAlgorithm"/></summary>
+        public const string DefaultCompressionAlgorithm = "grpc.default_compression_algorithm";
+
+        /// <summary>Compression level of messages compressed with zstd (default 5). Negative levels are faster and compress less.</summary>
+        public const string ZstdCompressionLevel = "grpc.zstd_compression_level";
+
         /// <summary>
         /// Creates native object for a collection of channel options.
         /// </summary>
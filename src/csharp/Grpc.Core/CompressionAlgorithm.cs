@@ -0,0 +1,64 @@
+#region Copyright notice and license
+
+// Copyright 2020 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#endregion
+
+using System;
+
+namespace Grpc.Core
+{
+    /// <summary>
+    /// Compression algorithm based on grpc_compression_algorithm from grpc/compression.h.
+    /// Use the integer value of a member with <see cref="ChannelOptions.DefaultCompressionAlgorithm"/>.
+    /// </summary>
+    public enum CompressionAlgorithm
+    {
+        /// <summary>
+        /// No compression.
+        /// </summary>
+        None = 0,
+
+        /// <summary>
+        /// Deflate message compression.
+        /// </summary>
+        Deflate = 1,
+
+        /// <summary>
+        /// Gzip message compression.
+        /// </summary>
+        Gzip = 2,
+
+        /// <summary>
+        /// Zstd message compression. The level is set with <see cref="ChannelOptions.ZstdCompressionLevel"/>.
+        /// </summary>
+        Zstd = 3,
+
+        /// <summary>
+        /// Gzip compression of the whole stream.
+        /// </summary>
+        StreamGzip = 4,
+
+        /// <summary>
+        /// Zstd compression of the whole stream.
+        /// </summary>
+        StreamZstd = 5,
+
+        /// <summary>
+        /// LZ4 message compression.
+        /// </summary>
+        Lz4 = 6,
+    }
+}
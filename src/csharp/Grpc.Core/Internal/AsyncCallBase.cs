@@ -333,14 +333,15 @@ namespace Grpc.Core.Internal
             // read (e.g. deliver approriate statusCode on the clientside).
 
             TRead msg = default(TRead);
-            var deserializeException = (success && receivedMessageReader.TotalLength.HasValue) ? TryDeserialize(receivedMessageReader, out msg) : null;
+            bool hasMessage = HasReceivedMessage(receivedMessageReader);
+            var deserializeException = (success && hasMessage) ? TryDeserialize(receivedMessageReader, out msg) : null;
 
             TaskCompletionSource<TRead> origTcs = null;
             bool releasedResources;
             lock (myLock)
             {
                 origTcs = streamingReadTcs;
-                if (!receivedMessageReader.TotalLength.HasValue)
+                if (!hasMessage)
                 {
                     // This was the last read.
                     readingDone = true;
@@ -375,6 +376,23 @@ namespace Grpc.Core.Internal
             origTcs.SetResult(msg);
         }
 
+        /// <summary>
+        /// Returns false once there are no more messages to read. A message that could not be
+        /// decompressed still counts as received, so that deserializing it fails the call
+        /// rather than ending the stream as if it was complete.
+        /// </summary>
+        static bool HasReceivedMessage(IBufferReader receivedMessageReader)
+        {
+            try
+            {
+                return receivedMessageReader.TotalLength.HasValue;
+            }
+            catch (IOException)
+            {
+                return true;
+            }
+        }
+
         protected ISendCompletionCallback SendCompletionCallback => this;
 
         void ISendCompletionCallback.OnSendCompletion(bool success)
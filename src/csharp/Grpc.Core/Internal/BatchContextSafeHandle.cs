@@ -17,6 +17,7 @@
 #endregion
 
 using System;
+using System.IO;
 using System.Runtime.InteropServices;
 using System.Text;
 using Grpc.Core;
@@ -32,6 +33,10 @@ namespace Grpc.Core.Internal
 
     internal interface IBufferReader
     {
+        /// <summary>
+        /// Length of the received message, or null if there is none. Throws <c>IOException</c>
+        /// if a message was received but could not be decompressed.
+        /// </summary>
         int? TotalLength { get; }
 
         bool TryGetNextSlice(out Slice slice);
@@ -157,6 +162,10 @@ namespace Grpc.Core.Internal
             get
             {
                 var len = Native.grpcsharp_batch_context_recv_message_length(this);
+                if (len == new IntPtr(-2))
+                {
+                    throw new IOException("Failed to decompress received message.");
+                }
                 return len != new IntPtr(-1) ? (int?) len : null;
             }
         }
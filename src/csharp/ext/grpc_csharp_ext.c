@@ -65,6 +65,8 @@ typedef struct grpcsharp_batch_context {
   grpc_metadata_array recv_initial_metadata;
   grpc_byte_buffer* recv_message;
   grpc_byte_buffer_reader* recv_message_reader;
+  /* set once recv_message turned out not to be decompressible */
+  int recv_message_failed;
   struct {
     grpc_metadata_array trailing_metadata;
     grpc_status_code status;
@@ -261,18 +263,53 @@ grpcsharp_batch_context_recv_initial_metadata(
   return &(ctx->recv_initial_metadata);
 }
 
-GPR_EXPORT intptr_t GPR_CALLTYPE grpcsharp_batch_context_recv_message_length(
-    const grpcsharp_batch_context* ctx) {
+/*
+ * Replaces a compressed recv_message with its decompressed contents, so that
+ * its length is known up front and the slices peeked from it stay valid for
+ * as long as the batch context. Readers of compressed byte buffers only
+ * decompress a slice at a time.
+ * Returns 0 if the message could not be decompressed (the data is corrupt or
+ * over the limits set for the channel), in which case recv_message is freed
+ * and recv_message_failed is set.
+ */
+static int grpcsharp_batch_context_decompress_recv_message(
+    grpcsharp_batch_context* ctx) {
   grpc_byte_buffer_reader reader;
+  grpc_byte_buffer* decompressed = NULL;
+  if (ctx->recv_message->data.raw.compression == GRPC_COMPRESS_NONE) {
+    return 1;
+  }
+
+  if (grpc_byte_buffer_reader_init(&reader, ctx->recv_message)) {
+    decompressed = grpc_raw_byte_buffer_from_reader(&reader);
+    grpc_byte_buffer_reader_destroy(&reader);
+  }
+  grpc_byte_buffer_destroy(ctx->recv_message);
+  ctx->recv_message = decompressed;
+  if (!decompressed) {
+    ctx->recv_message_failed = 1;
+    return 0;
+  }
+  return 1;
+}
+
+/*
+ * Returns the length of the received message, -1 if there is no message
+ * (the end of the stream) or -2 if the message could not be decompressed.
+ */
+GPR_EXPORT intptr_t GPR_CALLTYPE grpcsharp_batch_context_recv_message_length(
+    grpcsharp_batch_context* ctx) {
+  if (ctx->recv_message_failed) {
+    return -2;
+  }
   if (!ctx->recv_message) {
     return -1;
   }
 
-  GPR_ASSERT(grpc_byte_buffer_reader_init(&reader, ctx->recv_message));
-  intptr_t result = (intptr_t)grpc_byte_buffer_length(reader.buffer_out);
-  grpc_byte_buffer_reader_destroy(&reader);
-
-  return result;
+  if (!grpcsharp_batch_context_decompress_recv_message(ctx)) {
+    return -2;
+  }
+  return (intptr_t)grpc_byte_buffer_length(ctx->recv_message);
 }
 
 /*
@@ -298,6 +335,9 @@ grpcsharp_batch_context_recv_message_next_slice_peek(
   }
 
   if (!ctx->recv_message_reader) {
+    if (!grpcsharp_batch_context_decompress_recv_message(ctx)) {
+      return 0;
+    }
     ctx->recv_message_reader = &ctx->reserved_recv_message_reader;
     GPR_ASSERT(grpc_byte_buffer_reader_init(ctx->recv_message_reader,
                                             ctx->recv_message));
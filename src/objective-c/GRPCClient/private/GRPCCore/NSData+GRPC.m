@@ -39,6 +39,15 @@ static void MallocAndCopyByteBufferToCharArray(grpc_byte_buffer *buffer, size_t
   // The slice contains uncompressed data even if compressed data was received
   // because the reader takes care of automatically decompressing it
   grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
+  if (grpc_byte_buffer_reader_failed(&reader)) {
+    // Compressed data is decompressed as it is read, so data that is corrupt
+    // past its start is only detected here.
+    grpc_slice_unref(slice);
+    grpc_byte_buffer_reader_destroy(&reader);
+    *array = NULL;
+    *length = 0;
+    return;
+  }
   size_t uncompressed_length = GRPC_SLICE_LENGTH(slice);
   char *result = malloc(uncompressed_length);
   if (result) {
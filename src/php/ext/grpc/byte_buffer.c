@@ -23,6 +23,7 @@
 #include "byte_buffer.h"
 
 #include <grpc/byte_buffer_reader.h>
+#include <grpc/slice_buffer.h>
 
 grpc_byte_buffer *string_to_byte_buffer(char *string, size_t length) {
   grpc_slice slice = grpc_slice_from_copied_buffer(string, length);
@@ -44,6 +45,14 @@ void byte_buffer_to_string(grpc_byte_buffer *buffer, char **out_string,
   }
 
   grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
+  int failed = grpc_byte_buffer_reader_failed(&reader);
+  grpc_byte_buffer_reader_destroy(&reader);
+  if (failed) {
+    grpc_slice_unref(slice);
+    *out_string = NULL;
+    *out_length = 0;
+    return;
+  }
   size_t length = GRPC_SLICE_LENGTH(slice);
   char *string = ecalloc(length + 1, sizeof(char));
   memcpy(string, GRPC_SLICE_START_PTR(slice), length);
@@ -62,20 +71,33 @@ zend_string* byte_buffer_to_zend_string(grpc_byte_buffer *buffer) {
     return NULL;
   }
 
-  const size_t length = grpc_byte_buffer_length(reader.buffer_out);
-  zend_string* zstr = zend_string_alloc(length, 0);
-
-  char* buf = ZSTR_VAL(zstr);
+  /* compressed buffers are decompressed as they are read, so their length
+     is only known at the end */
+  grpc_slice_buffer slices;
+  grpc_slice_buffer_init(&slices);
   grpc_slice next;
   while (grpc_byte_buffer_reader_next(&reader, &next) != 0) {
-    const size_t next_len = GRPC_SLICE_LENGTH(next);
-    memcpy(buf, GRPC_SLICE_START_PTR(next), next_len);
+    grpc_slice_buffer_add(&slices, next);
+  }
+  int failed = grpc_byte_buffer_reader_failed(&reader);
+  grpc_byte_buffer_reader_destroy(&reader);
+  if (failed) {
+    grpc_slice_buffer_destroy(&slices);
+    return NULL;
+  }
+
+  zend_string* zstr = zend_string_alloc(slices.length, 0);
+
+  char* buf = ZSTR_VAL(zstr);
+  for (size_t i = 0; i < slices.count; i++) {
+    const size_t next_len = GRPC_SLICE_LENGTH(slices.slices[i]);
+    memcpy(buf, GRPC_SLICE_START_PTR(slices.slices[i]), next_len);
     buf += next_len;
-    grpc_slice_unref(next);
   }
+  grpc_slice_buffer_destroy(&slices);
 
   *buf = '\0';
-  
+
   return zstr;
 }
 
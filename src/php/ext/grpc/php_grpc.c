@@ -326,6 +326,23 @@ PHP_MINIT_FUNCTION(grpc) {
   REGISTER_LONG_CONSTANT("Grpc\\WRITE_NO_COMPRESS", GRPC_WRITE_NO_COMPRESS,
                          CONST_CS | CONST_PERSISTENT);
 
+  /* Register compression algorithm constants, for use as the value of the
+   * grpc.default_compression_algorithm channel argument */
+  REGISTER_LONG_CONSTANT("Grpc\\COMPRESS_NONE", GRPC_COMPRESS_NONE,
+                         CONST_CS | CONST_PERSISTENT);
+  REGISTER_LONG_CONSTANT("Grpc\\COMPRESS_DEFLATE", GRPC_COMPRESS_DEFLATE,
+                         CONST_CS | CONST_PERSISTENT);
+  REGISTER_LONG_CONSTANT("Grpc\\COMPRESS_GZIP", GRPC_COMPRESS_GZIP,
+                         CONST_CS | CONST_PERSISTENT);
+  REGISTER_LONG_CONSTANT("Grpc\\COMPRESS_ZSTD", GRPC_COMPRESS_ZSTD,
+                         CONST_CS | CONST_PERSISTENT);
+  REGISTER_LONG_CONSTANT("Grpc\\COMPRESS_STREAM_GZIP",
+                         GRPC_COMPRESS_STREAM_GZIP,
+                         CONST_CS | CONST_PERSISTENT);
+  REGISTER_LONG_CONSTANT("Grpc\\COMPRESS_STREAM_ZSTD",
+                         GRPC_COMPRESS_STREAM_ZSTD,
+                         CONST_CS | CONST_PERSISTENT);
+
   /* Register status constants */
   REGISTER_LONG_CONSTANT("Grpc\\STATUS_OK", GRPC_STATUS_OK,
                          CONST_CS | CONST_PERSISTENT);
@@ -188,6 +188,57 @@ class EndToEndTest extends PHPUnit_Framework_TestCase
         unset($server_call);
     }
 
+    public function testZstdCompressedRequest()
+    {
+        $channel = new Grpc\Channel('localhost:'.$this->port, [
+            'force_new' => true,
+            'grpc.default_compression_algorithm' => Grpc\COMPRESS_ZSTD,
+            'grpc.zstd_compression_level' => 3,
+        ]);
+        $deadline = Grpc\Timeval::infFuture();
+        $req_text = str_repeat('zstd_compressed_request', 1000);
+        $status_text = 'xyz';
+
+        $call = new Grpc\Call($channel,
+                              'dummy_method',
+                              $deadline);
+
+        $event = $call->startBatch([
+            Grpc\OP_SEND_INITIAL_METADATA => [],
+            Grpc\OP_SEND_CLOSE_FROM_CLIENT => true,
+            Grpc\OP_SEND_MESSAGE => ['message' => $req_text],
+        ]);
+
+        $this->assertTrue($event->send_message);
+
+        $event = $this->server->requestCall();
+        $server_call = $event->call;
+
+        $event = $server_call->startBatch([
+            Grpc\OP_SEND_INITIAL_METADATA => [],
+            Grpc\OP_SEND_STATUS_FROM_SERVER => [
+                'metadata' => [],
+                'code' => Grpc\STATUS_OK,
+                'details' => $status_text,
+            ],
+            Grpc\OP_RECV_MESSAGE => true,
+            Grpc\OP_RECV_CLOSE_ON_SERVER => true,
+        ]);
+
+        $this->assertSame($req_text, $event->message);
+
+        $event = $call->startBatch([
+            Grpc\OP_RECV_INITIAL_METADATA => true,
+            Grpc\OP_RECV_STATUS_ON_CLIENT => true,
+        ]);
+
+        $this->assertSame(Grpc\STATUS_OK, $event->status->code);
+
+        unset($call);
+        unset($server_call);
+        $channel->close();
+    }
+
     /**
      * @expectedException InvalidArgumentException
      */
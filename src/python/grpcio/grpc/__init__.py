@@ -1980,10 +1980,16 @@ class Compression(enum.IntEnum):
         NoCompression: Do not use compression algorithm.
         Deflate: Use "Deflate" compression algorithm.
         Gzip: Use "Gzip" compression algorithm.
+        Zstd: Use "Zstd" compression algorithm. See
+          grpc.experimental.zstd_compression_level to choose its level.
+        StreamZstd: Compress the whole stream with "Zstd" rather than each
+          message. Stream compression is EXPERIMENTAL.
     """
     NoCompression = _compression.NoCompression
     Deflate = _compression.Deflate
     Gzip = _compression.Gzip
+    Zstd = _compression.Zstd
+    StreamZstd = _compression.StreamZstd
 
 
 ###################################  __all__  #################################
@@ -133,7 +133,13 @@ def _handle_event(event, state, response_deserializer):
             state.initial_metadata = batch_operation.initial_metadata()
         elif operation_type == cygrpc.OperationType.receive_message:
             serialized_response = batch_operation.message()
-            if serialized_response is not None:
+            if batch_operation.decompression_exceeded_limit():
+                details = 'Decompressed response exceeds the limit!'
+                _abort(state, grpc.StatusCode.RESOURCE_EXHAUSTED, details)
+            elif batch_operation.decompression_failed():
+                details = 'Exception decompressing response!'
+                _abort(state, grpc.StatusCode.INTERNAL, details)
+            elif serialized_response is not None:
                 response = _common.deserialize(serialized_response,
                                                response_deserializer)
                 if response is None:
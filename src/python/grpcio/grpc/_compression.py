@@ -17,11 +17,15 @@ from grpc._cython import cygrpc
 NoCompression = cygrpc.CompressionAlgorithm.none
 Deflate = cygrpc.CompressionAlgorithm.deflate
 Gzip = cygrpc.CompressionAlgorithm.gzip
+Zstd = cygrpc.CompressionAlgorithm.zstd
+StreamZstd = cygrpc.CompressionAlgorithm.stream_zstd
 
 _METADATA_STRING_MAPPING = {
     NoCompression: 'identity',
     Deflate: 'deflate',
     Gzip: 'gzip',
+    Zstd: 'zstd',
+    StreamZstd: 'stream/zstd',
 }
 
 
@@ -34,6 +38,10 @@ def compression_algorithm_to_metadata(compression):
             _compression_algorithm_to_metadata_value(compression))
 
 
+def zstd_level_to_metadata(level):
+    return (cygrpc.GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY, str(int(level)))
+
+
 def create_channel_option(compression):
     return ((cygrpc.GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM,
              int(compression)),) if compression else ()
@@ -52,4 +60,6 @@ __all__ = (
     "NoCompression",
     "Deflate",
     "Gzip",
+    "Zstd",
+    "StreamZstd",
 )
@@ -18,6 +18,8 @@ _EMPTY_MASK = 0
 _IMMUTABLE_EMPTY_METADATA = tuple()
 
 _UNKNOWN_CANCELLATION_DETAILS = 'RPC cancelled for unknown reason.'
+_DECOMPRESSION_FAILED_DETAILS = 'Failed to decompress response message.'
+_DECOMPRESSION_LIMIT_DETAILS = 'Decompressed response message exceeds the limit.'
 _OK_CALL_REPRESENTATION = ('<{} of RPC that terminated with:\n'
                            '\tstatus = {}\n'
                            '\tdetails = "{}"\n'
@@ -316,10 +318,17 @@ cdef class _AioCall(GrpcCallWrapper):
 
         cdef grpc_status_code code
         code = receive_status_on_client_op.code()
+        details = receive_status_on_client_op.details()
+        if code == StatusCode.ok and receive_message_op.decompression_exceeded_limit():
+            code = StatusCode.resource_exhausted
+            details = _DECOMPRESSION_LIMIT_DETAILS
+        elif code == StatusCode.ok and receive_message_op.decompression_failed():
+            code = StatusCode.internal
+            details = _DECOMPRESSION_FAILED_DETAILS
 
         self._set_status(AioRpcStatus(
             code,
-            receive_status_on_client_op.details(),
+            details,
             receive_status_on_client_op.trailing_metadata(),
             receive_status_on_client_op.error_string(),
         ))
@@ -458,10 +467,17 @@ cdef class _AioCall(GrpcCallWrapper):
 
         cdef grpc_status_code code
         code = receive_status_on_client_op.code()
+        details = receive_status_on_client_op.details()
+        if code == StatusCode.ok and receive_message_op.decompression_exceeded_limit():
+            code = StatusCode.resource_exhausted
+            details = _DECOMPRESSION_LIMIT_DETAILS
+        elif code == StatusCode.ok and receive_message_op.decompression_failed():
+            code = StatusCode.internal
+            details = _DECOMPRESSION_FAILED_DETAILS
 
         self._set_status(AioRpcStatus(
             code,
-            receive_status_on_client_op.details(),
+            details,
             receive_status_on_client_op.trailing_metadata(),
             receive_status_on_client_op.error_string(),
         ))
@@ -130,6 +130,9 @@ async def _receive_message(GrpcCallWrapper grpc_call_wrapper,
         #
         # Since they all indicates finish, they are better be merged.
         _LOGGER.debug('Failed to receive any message from Core')
+    if receive_op.decompression_failed():
+        # Unlike the cases above, this isn't the end of the messages.
+        raise InternalError('Failed to decompress received message.')
     return receive_op.message()
 
 
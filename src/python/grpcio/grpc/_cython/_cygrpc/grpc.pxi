@@ -114,6 +114,9 @@ cdef extern from "grpc/grpc.h":
   int grpc_byte_buffer_reader_next(grpc_byte_buffer_reader *reader,
                                    grpc_slice *slice) nogil
   void grpc_byte_buffer_reader_destroy(grpc_byte_buffer_reader *reader) nogil
+  int grpc_byte_buffer_reader_failed(grpc_byte_buffer_reader *reader) nogil
+  int grpc_byte_buffer_reader_exceeded_limit(
+      grpc_byte_buffer_reader *reader) nogil
 
   ctypedef enum grpc_status_code:
     GRPC_STATUS_OK
@@ -613,7 +616,9 @@ cdef extern from "grpc/compression.h":
     GRPC_COMPRESS_NONE
     GRPC_COMPRESS_DEFLATE
     GRPC_COMPRESS_GZIP
+    GRPC_COMPRESS_ZSTD
     GRPC_COMPRESS_STREAM_GZIP
+    GRPC_COMPRESS_STREAM_ZSTD
     GRPC_COMPRESS_ALGORITHMS_COUNT
 
   ctypedef enum grpc_compression_level:
@@ -647,6 +652,10 @@ cdef extern from "grpc/impl/codegen/compression_types.h":
 
   const char *_GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY \
     "GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY"
+  const char *_GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY \
+    "GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY"
+  const char *_GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL \
+    "GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL"
 
 
 cdef extern from "grpc/grpc_security_constants.h":
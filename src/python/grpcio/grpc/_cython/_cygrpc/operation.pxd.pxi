@@ -80,6 +80,8 @@ cdef class ReceiveMessageOperation(Operation):
   cdef readonly int _flags
   cdef grpc_byte_buffer *_c_message_byte_buffer
   cdef bytes _message
+  cdef bint _decompression_failed
+  cdef bint _decompression_exceeded_limit
 
   cdef void c(self) except *
   cdef void un_c(self) except *
@@ -159,6 +159,8 @@ cdef class ReceiveMessageOperation(Operation):
     cdef grpc_slice message_slice
     cdef size_t message_slice_length
     cdef void *message_slice_pointer
+    self._decompression_failed = False
+    self._decompression_exceeded_limit = False
     if self._c_message_byte_buffer != NULL:
       message_reader_status = grpc_byte_buffer_reader_init(
           &message_reader, self._c_message_byte_buffer)
@@ -169,10 +171,17 @@ cdef class ReceiveMessageOperation(Operation):
           message_slice_length = grpc_slice_length(message_slice)
           message += (<char *>message_slice_pointer)[:message_slice_length]
           grpc_slice_unref(message_slice)
+        if grpc_byte_buffer_reader_failed(&message_reader):
+          self._message = None
+          self._decompression_failed = True
+          self._decompression_exceeded_limit = (
+              grpc_byte_buffer_reader_exceeded_limit(&message_reader))
+        else:
+          self._message = bytes(message)
         grpc_byte_buffer_reader_destroy(&message_reader)
-        self._message = bytes(message)
       else:
         self._message = None
+        self._decompression_failed = True
       grpc_byte_buffer_destroy(self._c_message_byte_buffer)
     else:
       self._message = None
@@ -180,6 +189,19 @@ cdef class ReceiveMessageOperation(Operation):
   def message(self):
     return self._message
 
+  def decompression_failed(self):
+    """Whether a message was received but could not be decompressed.
+
+    message() is None in that case too, but unlike at the end of the stream the
+    call must be failed rather than finished.
+    """
+    return self._decompression_failed
+
+  def decompression_exceeded_limit(self):
+    """Whether decompression failed because the message is longer than the
+    channel's grpc.max_receive_decompressed_message_length allows."""
+    return self._decompression_exceeded_limit
+
 
 cdef class ReceiveStatusOnClientOperation(Operation):
 
@@ -114,10 +114,17 @@ GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM= (
 GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY = (
   _GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY)
 
+GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY = (
+  _GRPC_COMPRESSION_REQUEST_ZSTD_LEVEL_MD_KEY)
+
+GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL = _GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL
+
 class CompressionAlgorithm:
   none = GRPC_COMPRESS_NONE
   deflate = GRPC_COMPRESS_DEFLATE
   gzip = GRPC_COMPRESS_GZIP
+  zstd = GRPC_COMPRESS_ZSTD
+  stream_zstd = GRPC_COMPRESS_STREAM_ZSTD
 
 
 class CompressionLevel:
@@ -57,6 +57,14 @@ def _serialized_request(request_event):
     return request_event.batch_operations[0].message()
 
 
+def _request_decompression_failed(request_event):
+    return request_event.batch_operations[0].decompression_failed()
+
+
+def _request_decompression_exceeded_limit(request_event):
+    return request_event.batch_operations[0].decompression_exceeded_limit()
+
+
 def _application_code(code):
     cygrpc_code = _common.STATUS_CODE_TO_CYGRPC_STATUS_CODE.get(code)
     return cygrpc.StatusCode.unknown if cygrpc_code is None else cygrpc_code
@@ -194,7 +202,17 @@ def _receive_message(state, call, request_deserializer):
 
     def receive_message(receive_message_event):
         serialized_request = _serialized_request(receive_message_event)
-        if serialized_request is None:
+        if _request_decompression_failed(receive_message_event):
+            with state.condition:
+                if _request_decompression_exceeded_limit(receive_message_event):
+                    _abort(state, call, cygrpc.StatusCode.resource_exhausted,
+                           b'Decompressed request exceeds the limit!')
+                else:
+                    _abort(state, call, cygrpc.StatusCode.internal,
+                           b'Exception decompressing request!')
+                state.condition.notify_all()
+                return _possibly_finish_call(state, _RECEIVE_MESSAGE_TOKEN)
+        elif serialized_request is None:
             with state.condition:
                 if state.client is _OPEN:
                     state.client = _CLOSED
@@ -21,6 +21,7 @@ import sys
 import warnings
 
 import grpc
+from grpc import _compression
 
 _EXPERIMENTAL_APIS_USED = set()
 
@@ -59,6 +60,27 @@ class ExperimentalApiWarning(Warning):
     """A warning that an API is experimental."""
 
 
+def zstd_compression_level(level):
+    """Creates metadata requesting a zstd compression level for an RPC.
+
+    Messages compressed with grpc.Compression.Zstd use the level of the
+    'grpc.zstd_compression_level' channel option, or gRPC's default zstd level
+    (GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL, 5) if it is not set. Add the
+    returned metadata to the metadata of an RPC, or send it with
+    ServicerContext.send_initial_metadata, to compress that RPC's messages at
+    another level instead.
+
+    Args:
+      level: The zstd compression level as an int. Higher levels compress
+        better but more slowly; negative levels trade compression ratio for
+        speed.
+
+    Returns:
+      A metadata tuple holding the single key-value pair to add.
+    """
+    return (_compression.zstd_level_to_metadata(level),)
+
+
 def _warn_experimental(api_name, stack_offset):
     if api_name not in _EXPERIMENTAL_APIS_USED:
         _EXPERIMENTAL_APIS_USED.add(api_name)
@@ -83,6 +105,7 @@ __all__ = (
     'ExperimentalApiWarning',
     'UsageError',
     'insecure_channel_credentials',
+    'zstd_compression_level',
 )
 
 if sys.version_info[0] >= 3:
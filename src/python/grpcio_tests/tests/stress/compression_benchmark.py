@@ -0,0 +1,159 @@
+# Copyright 2020 The gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Compares zstd with gzip message compression on unary RPCs.
+
+For each payload size and compression setting, sends the payload to an
+in-process server through a TCP proxy and reports the time per RPC, the
+throughput and the bytes the requests took on the wire relative to sending
+them uncompressed. Payloads are synthetic JSON-like records unless
+--payload_file is given, in which case its contents are repeated or truncated
+to each size.
+"""
+
+import argparse
+import contextlib
+import random
+import sys
+import time
+from concurrent import futures
+
+import grpc
+import grpc.experimental
+
+from tests.unit import _tcp_proxy
+
+_HOST = 'localhost'
+_METHOD = '/test/Compress'
+_DEFAULT_SIZES = '1024,16384,262144,4194304'
+_DEFAULT_ZSTD_LEVELS = '-5,1,3,9'
+_WORDS = ('alpha', 'bravo', 'charlie', 'delta', 'echo', 'foxtrot', 'golf',
+          'hotel', 'india', 'juliett', 'kilo', 'lima', 'mike', 'november')
+
+
+def _handle(request, servicer_context):
+    return b''
+
+
+class _GenericHandler(grpc.GenericRpcHandler):
+
+    def service(self, handler_call_details):
+        if handler_call_details.method == _METHOD:
+            return grpc.unary_unary_rpc_method_handler(_handle)
+        return None
+
+
+def _synthetic_payload(size):
+    rng = random.Random(size)
+    records = []
+    length = 0
+    while length < size:
+        record = ('{"id": %d, "name": "%s", "tags": ["%s", "%s"], '
+                  '"score": %.4f}\n' %
+                  (rng.randint(0, 1 << 32), rng.choice(_WORDS),
+                   rng.choice(_WORDS), rng.choice(_WORDS), rng.random()))
+        records.append(record)
+        length += len(record)
+    return ''.join(records).encode('ascii')[:size]
+
+
+def _payload(size, payload_file):
+    if payload_file is None:
+        return _synthetic_payload(size)
+    with open(payload_file, 'rb') as f:
+        data = f.read()
+    return (data * (size // len(data) + 1))[:size]
+
+
+@contextlib.contextmanager
+def _proxied_channel():
+    options = (('grpc.max_receive_message_length', -1),)
+    server = grpc.server(futures.ThreadPoolExecutor(max_workers=4),
+                         options=options)
+    server.add_generic_rpc_handlers((_GenericHandler(),))
+    server_port = server.add_insecure_port('{}:0'.format(_HOST))
+    server.start()
+    try:
+        with _tcp_proxy.TcpProxy(_HOST, _HOST, server_port) as proxy:
+            with grpc.insecure_channel('{}:{}'.format(
+                    _HOST, proxy.get_port())) as channel:
+                yield channel, proxy
+    finally:
+        server.stop(None)
+
+
+def _run(payload, compression, metadata, iterations):
+    """Returns the seconds per RPC and the request bytes sent per RPC."""
+    with _proxied_channel() as (channel, proxy):
+        multi_callable = channel.unary_unary(_METHOD)
+        # Connect, and warm up the compression contexts.
+        multi_callable(payload,
+                       metadata=metadata,
+                       compression=compression,
+                       wait_for_ready=True)
+        sent_before, _ = proxy.get_byte_count()
+        start = time.time()
+        for _ in range(iterations):
+            multi_callable(payload, metadata=metadata, compression=compression)
+        elapsed = time.time() - start
+        sent_after, _ = proxy.get_byte_count()
+    return elapsed / iterations, (sent_after - sent_before) / float(iterations)
+
+
+def _settings(zstd_levels):
+    yield 'none', grpc.Compression.NoCompression, None
+    yield 'gzip', grpc.Compression.Gzip, None
+    yield 'zstd', grpc.Compression.Zstd, None
+    for level in zstd_levels:
+        yield ('zstd:{}'.format(level), grpc.Compression.Zstd,
+               grpc.experimental.zstd_compression_level(level))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--sizes',
+                        default=_DEFAULT_SIZES,
+                        help='Comma-separated payload sizes in bytes.')
+    parser.add_argument('--zstd_levels',
+                        default=_DEFAULT_ZSTD_LEVELS,
+                        help='Comma-separated zstd levels to compare.')
+    parser.add_argument('--payload_file',
+                        default=None,
+                        help='File whose contents make up the payloads.')
+    parser.add_argument('--iterations',
+                        type=int,
+                        default=20,
+                        help='RPCs per payload size and setting.')
+    args = parser.parse_args()
+    sizes = [int(size) for size in args.sizes.split(',')]
+    zstd_levels = [int(level) for level in args.zstd_levels.split(',')]
+
+    sys.stdout.write('{:>10} {:>10} {:>12} {:>10} {:>12}\n'.format(
+        'size', 'setting', 'ms/rpc', 'MB/s', 'wire ratio'))
+    for size in sizes:
+        payload = _payload(size, args.payload_file)
+        uncompressed_bytes = None
+        for name, compression, metadata in _settings(zstd_levels):
+            seconds, wire_bytes = _run(payload, compression, metadata,
+                                       args.iterations)
+            if uncompressed_bytes is None:
+                uncompressed_bytes = wire_bytes
+            sys.stdout.write(
+                '{:>10} {:>10} {:>12.3f} {:>10.1f} {:>12.3f}\n'.format(
+                    size, name, seconds * 1e3, size / seconds / 1e6,
+                    wire_bytes / uncompressed_bytes))
+            sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
@@ -23,6 +23,7 @@ import logging
 import os
 
 import grpc
+import grpc.experimental
 from grpc import _grpcio_metadata
 
 from tests.unit import test_common
@@ -53,6 +54,8 @@ _COMPRESSION_NAMES = {
     grpc.Compression.NoCompression: 'NoCompression',
     grpc.Compression.Deflate: 'DeflateCompression',
     grpc.Compression.Gzip: 'GzipCompression',
+    grpc.Compression.Zstd: 'ZstdCompression',
+    grpc.Compression.StreamZstd: 'StreamZstdCompression',
 }
 
 _TEST_OPTIONS = {
@@ -336,6 +339,36 @@ class CompressionTest(unittest.TestCase):
             server_kwargs, _GenericHandler(disable_first_compression), _REQUEST)
         self.assertCompressed(received_ratio)
 
+    def testZstdCompression(self):
+        multicallable_kwargs = {
+            'compression': grpc.Compression.Zstd,
+        }
+        server_kwargs = {
+            'compression': grpc.Compression.Zstd,
+        }
+        sent_ratio, received_ratio = _get_compression_ratios(
+            _stream_stream_client, {}, {}, {}, _GenericHandler(None), {},
+            multicallable_kwargs, server_kwargs, _GenericHandler(None),
+            _REQUEST)
+        self.assertCompressed(sent_ratio)
+        self.assertCompressed(received_ratio)
+
+    def testZstdCompressionLevel(self):
+        level_metadata = grpc.experimental.zstd_compression_level(-5)
+        uncompressed_kwargs = {
+            'metadata': level_metadata,
+        }
+        multicallable_kwargs = {
+            'compression': grpc.Compression.Zstd,
+            'metadata': level_metadata,
+        }
+        sent_ratio, _ = _get_compression_ratios(_unary_unary_client, {},
+                                                uncompressed_kwargs, {},
+                                                _GenericHandler(None), {},
+                                                multicallable_kwargs, {},
+                                                _GenericHandler(None), _REQUEST)
+        self.assertCompressed(sent_ratio)
+
 
 def _get_compression_str(name, value):
     return '{}{}'.format(name, _COMPRESSION_NAMES[value])
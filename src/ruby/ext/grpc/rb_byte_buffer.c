@@ -50,6 +50,11 @@ VALUE grpc_rb_byte_buffer_to_s(grpc_byte_buffer* buffer) {
                GRPC_SLICE_LENGTH(next));
     grpc_slice_unref(next);
   }
+  if (grpc_byte_buffer_reader_failed(&reader)) {
+    grpc_byte_buffer_reader_destroy(&reader);
+    rb_raise(rb_eRuntimeError, "Error decompressing byte buffer.");
+    return Qnil;
+  }
   grpc_byte_buffer_reader_destroy(&reader);
   return rb_string;
 }
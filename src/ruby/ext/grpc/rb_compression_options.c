@@ -50,6 +50,10 @@ static VALUE id_compress_level_high = Qnil;
 typedef struct grpc_rb_compression_options {
   /* The actual compression options that's being wrapped */
   grpc_compression_options* wrapped;
+  /* The zstd compression level, if zstd_level_is_set. It is passed to GRPC
+   * core as a channel argument of its own. */
+  int zstd_level_is_set;
+  int zstd_level;
 } grpc_rb_compression_options;
 
 static void grpc_rb_compression_options_free_internal(void* p) {
@@ -97,6 +101,8 @@ static VALUE grpc_rb_compression_options_alloc(VALUE cls) {
   wrapper->wrapped = NULL;
   wrapper->wrapped = gpr_malloc(sizeof(grpc_compression_options));
   grpc_compression_options_init(wrapper->wrapped);
+  wrapper->zstd_level_is_set = 0;
+  wrapper->zstd_level = 0;
 
   return TypedData_Wrap_Struct(cls, &grpc_rb_compression_options_data_type,
                                wrapper);
@@ -262,6 +268,12 @@ VALUE grpc_rb_compression_options_to_hash(VALUE self) {
     rb_hash_aset(channel_arg_hash, key, value);
   }
 
+  if (wrapper->zstd_level_is_set) {
+    key = rb_str_new2(GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL);
+    value = INT2NUM(wrapper->zstd_level);
+    rb_hash_aset(channel_arg_hash, key, value);
+  }
+
   key = rb_str_new2(GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET);
   value = INT2NUM((int)compression_options->enabled_algorithms_bitset);
   rb_hash_aset(channel_arg_hash, key, value);
@@ -323,6 +335,21 @@ VALUE grpc_rb_compression_options_get_default_algorithm(VALUE self) {
   return Qnil;
 }
 
+/* Gets the zstd compression level if one has been set.
+ * Returns nil if no level has been set. */
+VALUE grpc_rb_compression_options_get_zstd_level(VALUE self) {
+  grpc_rb_compression_options* wrapper = NULL;
+
+  TypedData_Get_Struct(self, grpc_rb_compression_options,
+                       &grpc_rb_compression_options_data_type, wrapper);
+
+  if (wrapper->zstd_level_is_set) {
+    return INT2NUM(wrapper->zstd_level);
+  }
+
+  return Qnil;
+}
+
 /* Gets the internal value of the default compression level that is to be passed
  * to the GRPC core as a channel argument value.
  * A nil return value means that it hasn't been set. */
@@ -372,6 +399,10 @@ VALUE grpc_rb_compression_options_get_disabled_algorithms(VALUE self) {
  *     default_level: :none,
  *     disabled_algorithms: [:gzip]
  *   )
+ *
+ * The zstd_level option sets the level of messages compressed with zstd, for
+ * example CompressionOptions.new(default_algorithm: :zstd, zstd_level: 3).
+ * Negative levels trade compression ratio for speed.
  *   channel_arg hash = Hash.new[...]
  *   channel_arg_hash_with_compression_options = channel_arg_hash.merge(options)
  */
@@ -379,6 +410,7 @@ VALUE grpc_rb_compression_options_init(int argc, VALUE* argv, VALUE self) {
   grpc_rb_compression_options* wrapper = NULL;
   VALUE default_algorithm = Qnil;
   VALUE default_level = Qnil;
+  VALUE zstd_level = Qnil;
   VALUE disabled_algorithms = Qnil;
   VALUE algorithm_name = Qnil;
   VALUE hash_arg = Qnil;
@@ -412,6 +444,13 @@ VALUE grpc_rb_compression_options_init(int argc, VALUE* argv, VALUE self) {
                                                   default_level);
   }
 
+  /* Set the zstd level if one was chosen. */
+  zstd_level = rb_hash_aref(hash_arg, ID2SYM(rb_intern("zstd_level")));
+  if (zstd_level != Qnil) {
+    wrapper->zstd_level = NUM2INT(zstd_level);
+    wrapper->zstd_level_is_set = 1;
+  }
+
   /* Set the disabled algorithms if any were chosen. */
   disabled_algorithms =
       rb_hash_aref(hash_arg, ID2SYM(rb_intern("disabled_algorithms")));
@@ -449,6 +488,8 @@ void Init_grpc_compression_options() {
                    grpc_rb_compression_options_get_default_level, 0);
   rb_define_method(grpc_rb_cCompressionOptions, "disabled_algorithms",
                    grpc_rb_compression_options_get_disabled_algorithms, 0);
+  rb_define_method(grpc_rb_cCompressionOptions, "zstd_level",
+                   grpc_rb_compression_options_get_zstd_level, 0);
 
   /* Determines whether or not an algorithm is enabled, given a readable
    * algorithm name.*/
@@ -31,6 +31,10 @@ grpc_compression_options_init_type grpc_compression_options_init_import;
 grpc_compression_options_enable_algorithm_type grpc_compression_options_enable_algorithm_import;
 grpc_compression_options_disable_algorithm_type grpc_compression_options_disable_algorithm_import;
 grpc_compression_options_is_algorithm_enabled_type grpc_compression_options_is_algorithm_enabled_import;
+grpc_zstd_dictionary_create_type grpc_zstd_dictionary_create_import;
+grpc_zstd_dictionary_ref_type grpc_zstd_dictionary_ref_import;
+grpc_zstd_dictionary_unref_type grpc_zstd_dictionary_unref_import;
+grpc_zstd_dictionary_arg_vtable_type grpc_zstd_dictionary_arg_vtable_import;
 grpc_metadata_array_init_type grpc_metadata_array_init_import;
 grpc_metadata_array_destroy_type grpc_metadata_array_destroy_import;
 grpc_call_details_init_type grpc_call_details_init_import;
@@ -64,6 +68,7 @@ grpc_channel_create_registered_call_type grpc_channel_create_registered_call_imp
 grpc_call_arena_alloc_type grpc_call_arena_alloc_import;
 grpc_call_start_batch_type grpc_call_start_batch_import;
 grpc_call_get_peer_type grpc_call_get_peer_import;
+grpc_call_compress_message_type grpc_call_compress_message_import;
 grpc_census_call_set_context_type grpc_census_call_set_context_import;
 grpc_census_call_get_context_type grpc_census_call_get_context_import;
 grpc_channel_get_target_type grpc_channel_get_target_import;
@@ -171,6 +176,9 @@ grpc_tls_credential_reload_config_create_type grpc_tls_credential_reload_config_
 grpc_tls_server_authorization_check_config_create_type grpc_tls_server_authorization_check_config_create_import;
 grpc_raw_byte_buffer_create_type grpc_raw_byte_buffer_create_import;
 grpc_raw_compressed_byte_buffer_create_type grpc_raw_compressed_byte_buffer_create_import;
+grpc_byte_buffer_compressor_create_type grpc_byte_buffer_compressor_create_import;
+grpc_byte_buffer_compressor_write_type grpc_byte_buffer_compressor_write_import;
+grpc_byte_buffer_compressor_finish_type grpc_byte_buffer_compressor_finish_import;
 grpc_byte_buffer_copy_type grpc_byte_buffer_copy_import;
 grpc_byte_buffer_length_type grpc_byte_buffer_length_import;
 grpc_byte_buffer_destroy_type grpc_byte_buffer_destroy_import;
@@ -178,6 +186,8 @@ grpc_byte_buffer_reader_init_type grpc_byte_buffer_reader_init_import;
 grpc_byte_buffer_reader_destroy_type grpc_byte_buffer_reader_destroy_import;
 grpc_byte_buffer_reader_next_type grpc_byte_buffer_reader_next_import;
 grpc_byte_buffer_reader_peek_type grpc_byte_buffer_reader_peek_import;
+grpc_byte_buffer_reader_failed_type grpc_byte_buffer_reader_failed_import;
+grpc_byte_buffer_reader_exceeded_limit_type grpc_byte_buffer_reader_exceeded_limit_import;
 grpc_byte_buffer_reader_readall_type grpc_byte_buffer_reader_readall_import;
 grpc_raw_byte_buffer_from_reader_type grpc_raw_byte_buffer_from_reader_import;
 gpr_log_severity_string_type gpr_log_severity_string_import;
@@ -303,6 +313,10 @@ void grpc_rb_load_imports(HMODULE library) {
   grpc_compression_options_enable_algorithm_import = (grpc_compression_options_enable_algorithm_type) GetProcAddress(library, "grpc_compression_options_enable_algorithm");
   grpc_compression_options_disable_algorithm_import = (grpc_compression_options_disable_algorithm_type) GetProcAddress(library, "grpc_compression_options_disable_algorithm");
   grpc_compression_options_is_algorithm_enabled_import = (grpc_compression_options_is_algorithm_enabled_type) GetProcAddress(library, "grpc_compression_options_is_algorithm_enabled");
+  grpc_zstd_dictionary_create_import = (grpc_zstd_dictionary_create_type) GetProcAddress(library, "grpc_zstd_dictionary_create");
+  grpc_zstd_dictionary_ref_import = (grpc_zstd_dictionary_ref_type) GetProcAddress(library, "grpc_zstd_dictionary_ref");
+  grpc_zstd_dictionary_unref_import = (grpc_zstd_dictionary_unref_type) GetProcAddress(library, "grpc_zstd_dictionary_unref");
+  grpc_zstd_dictionary_arg_vtable_import = (grpc_zstd_dictionary_arg_vtable_type) GetProcAddress(library, "grpc_zstd_dictionary_arg_vtable");
   grpc_metadata_array_init_import = (grpc_metadata_array_init_type) GetProcAddress(library, "grpc_metadata_array_init");
   grpc_metadata_array_destroy_import = (grpc_metadata_array_destroy_type) GetProcAddress(library, "grpc_metadata_array_destroy");
   grpc_call_details_init_import = (grpc_call_details_init_type) GetProcAddress(library, "grpc_call_details_init");
@@ -336,6 +350,7 @@ void grpc_rb_load_imports(HMODULE library) {
   grpc_call_arena_alloc_import = (grpc_call_arena_alloc_type) GetProcAddress(library, "grpc_call_arena_alloc");
   grpc_call_start_batch_import = (grpc_call_start_batch_type) GetProcAddress(library, "grpc_call_start_batch");
   grpc_call_get_peer_import = (grpc_call_get_peer_type) GetProcAddress(library, "grpc_call_get_peer");
+  grpc_call_compress_message_import = (grpc_call_compress_message_type) GetProcAddress(library, "grpc_call_compress_message");
   grpc_census_call_set_context_import = (grpc_census_call_set_context_type) GetProcAddress(library, "grpc_census_call_set_context");
   grpc_census_call_get_context_import = (grpc_census_call_get_context_type) GetProcAddress(library, "grpc_census_call_get_context");
   grpc_channel_get_target_import = (grpc_channel_get_target_type) GetProcAddress(library, "grpc_channel_get_target");
@@ -443,6 +458,9 @@ void grpc_rb_load_imports(HMODULE library) {
   grpc_tls_server_authorization_check_config_create_import = (grpc_tls_server_authorization_check_config_create_type) GetProcAddress(library, "grpc_tls_server_authorization_check_config_create");
   grpc_raw_byte_buffer_create_import = (grpc_raw_byte_buffer_create_type) GetProcAddress(library, "grpc_raw_byte_buffer_create");
   grpc_raw_compressed_byte_buffer_create_import = (grpc_raw_compressed_byte_buffer_create_type) GetProcAddress(library, "grpc_raw_compressed_byte_buffer_create");
+  grpc_byte_buffer_compressor_create_import = (grpc_byte_buffer_compressor_create_type) GetProcAddress(library, "grpc_byte_buffer_compressor_create");
+  grpc_byte_buffer_compressor_write_import = (grpc_byte_buffer_compressor_write_type) GetProcAddress(library, "grpc_byte_buffer_compressor_write");
+  grpc_byte_buffer_compressor_finish_import = (grpc_byte_buffer_compressor_finish_type) GetProcAddress(library, "grpc_byte_buffer_compressor_finish");
   grpc_byte_buffer_copy_import = (grpc_byte_buffer_copy_type) GetProcAddress(library, "grpc_byte_buffer_copy");
   grpc_byte_buffer_length_import = (grpc_byte_buffer_length_type) GetProcAddress(library, "grpc_byte_buffer_length");
   grpc_byte_buffer_destroy_import = (grpc_byte_buffer_destroy_type) GetProcAddress(library, "grpc_byte_buffer_destroy");
@@ -450,6 +468,8 @@ void grpc_rb_load_imports(HMODULE library) {
   grpc_byte_buffer_reader_destroy_import = (grpc_byte_buffer_reader_destroy_type) GetProcAddress(library, "grpc_byte_buffer_reader_destroy");
   grpc_byte_buffer_reader_next_import = (grpc_byte_buffer_reader_next_type) GetProcAddress(library, "grpc_byte_buffer_reader_next");
   grpc_byte_buffer_reader_peek_import = (grpc_byte_buffer_reader_peek_type) GetProcAddress(library, "grpc_byte_buffer_reader_peek");
+  grpc_byte_buffer_reader_failed_import = (grpc_byte_buffer_reader_failed_type) GetProcAddress(library, "grpc_byte_buffer_reader_failed");
+  grpc_byte_buffer_reader_exceeded_limit_import = (grpc_byte_buffer_reader_exceeded_limit_type) GetProcAddress(library, "grpc_byte_buffer_reader_exceeded_limit");
   grpc_byte_buffer_reader_readall_import = (grpc_byte_buffer_reader_readall_type) GetProcAddress(library, "grpc_byte_buffer_reader_readall");
   grpc_raw_byte_buffer_from_reader_import = (grpc_raw_byte_buffer_from_reader_type) GetProcAddress(library, "grpc_raw_byte_buffer_from_reader");
   gpr_log_severity_string_import = (gpr_log_severity_string_type) GetProcAddress(library, "gpr_log_severity_string");
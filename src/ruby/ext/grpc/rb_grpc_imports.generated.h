@@ -68,6 +68,18 @@ extern grpc_compression_options_disable_algorithm_type grpc_compression_options_
 typedef int(*grpc_compression_options_is_algorithm_enabled_type)(const grpc_compression_options* opts, grpc_compression_algorithm algorithm);
 extern grpc_compression_options_is_algorithm_enabled_type grpc_compression_options_is_algorithm_enabled_import;
 #define grpc_compression_options_is_algorithm_enabled grpc_compression_options_is_algorithm_enabled_import
+typedef grpc_zstd_dictionary*(*grpc_zstd_dictionary_create_type)(const void* data, size_t size);
+extern grpc_zstd_dictionary_create_type grpc_zstd_dictionary_create_import;
+#define grpc_zstd_dictionary_create grpc_zstd_dictionary_create_import
+typedef void(*grpc_zstd_dictionary_ref_type)(grpc_zstd_dictionary* dictionary);
+extern grpc_zstd_dictionary_ref_type grpc_zstd_dictionary_ref_import;
+#define grpc_zstd_dictionary_ref grpc_zstd_dictionary_ref_import
+typedef void(*grpc_zstd_dictionary_unref_type)(grpc_zstd_dictionary* dictionary);
+extern grpc_zstd_dictionary_unref_type grpc_zstd_dictionary_unref_import;
+#define grpc_zstd_dictionary_unref grpc_zstd_dictionary_unref_import
+typedef const grpc_arg_pointer_vtable*(*grpc_zstd_dictionary_arg_vtable_type)(void);
+extern grpc_zstd_dictionary_arg_vtable_type grpc_zstd_dictionary_arg_vtable_import;
+#define grpc_zstd_dictionary_arg_vtable grpc_zstd_dictionary_arg_vtable_import
 typedef void(*grpc_metadata_array_init_type)(grpc_metadata_array* array);
 extern grpc_metadata_array_init_type grpc_metadata_array_init_import;
 #define grpc_metadata_array_init grpc_metadata_array_init_import
@@ -167,6 +179,9 @@ extern grpc_call_start_batch_type grpc_call_start_batch_import;
 typedef char*(*grpc_call_get_peer_type)(grpc_call* call);
 extern grpc_call_get_peer_type grpc_call_get_peer_import;
 #define grpc_call_get_peer grpc_call_get_peer_import
+typedef int(*grpc_call_compress_message_type)(grpc_call* call, grpc_byte_buffer* message, grpc_byte_buffer** compressed);
+extern grpc_call_compress_message_type grpc_call_compress_message_import;
+#define grpc_call_compress_message grpc_call_compress_message_import
 typedef void(*grpc_census_call_set_context_type)(grpc_call* call, struct census_context* context);
 extern grpc_census_call_set_context_type grpc_census_call_set_context_import;
 #define grpc_census_call_set_context grpc_census_call_set_context_import
@@ -488,6 +503,15 @@ extern grpc_raw_byte_buffer_create_type grpc_raw_byte_buffer_create_import;
 typedef grpc_byte_buffer*(*grpc_raw_compressed_byte_buffer_create_type)(grpc_slice* slices, size_t nslices, grpc_compression_algorithm compression);
 extern grpc_raw_compressed_byte_buffer_create_type grpc_raw_compressed_byte_buffer_create_import;
 #define grpc_raw_compressed_byte_buffer_create grpc_raw_compressed_byte_buffer_create_import
+typedef grpc_byte_buffer_compressor*(*grpc_byte_buffer_compressor_create_type)(grpc_compression_algorithm compression, int zstd_level, int zstd_window_log_max);
+extern grpc_byte_buffer_compressor_create_type grpc_byte_buffer_compressor_create_import;
+#define grpc_byte_buffer_compressor_create grpc_byte_buffer_compressor_create_import
+typedef int(*grpc_byte_buffer_compressor_write_type)(grpc_byte_buffer_compressor* compressor, const void* data, size_t length);
+extern grpc_byte_buffer_compressor_write_type grpc_byte_buffer_compressor_write_import;
+#define grpc_byte_buffer_compressor_write grpc_byte_buffer_compressor_write_import
+typedef grpc_byte_buffer*(*grpc_byte_buffer_compressor_finish_type)(grpc_byte_buffer_compressor* compressor);
+extern grpc_byte_buffer_compressor_finish_type grpc_byte_buffer_compressor_finish_import;
+#define grpc_byte_buffer_compressor_finish grpc_byte_buffer_compressor_finish_import
 typedef grpc_byte_buffer*(*grpc_byte_buffer_copy_type)(grpc_byte_buffer* bb);
 extern grpc_byte_buffer_copy_type grpc_byte_buffer_copy_import;
 #define grpc_byte_buffer_copy grpc_byte_buffer_copy_import
@@ -509,6 +533,12 @@ extern grpc_byte_buffer_reader_next_type grpc_byte_buffer_reader_next_import;
 typedef int(*grpc_byte_buffer_reader_peek_type)(grpc_byte_buffer_reader* reader, grpc_slice** slice);
 extern grpc_byte_buffer_reader_peek_type grpc_byte_buffer_reader_peek_import;
 #define grpc_byte_buffer_reader_peek grpc_byte_buffer_reader_peek_import
+typedef int(*grpc_byte_buffer_reader_failed_type)(grpc_byte_buffer_reader* reader);
+extern grpc_byte_buffer_reader_failed_type grpc_byte_buffer_reader_failed_import;
+#define grpc_byte_buffer_reader_failed grpc_byte_buffer_reader_failed_import
+typedef int(*grpc_byte_buffer_reader_exceeded_limit_type)(grpc_byte_buffer_reader* reader);
+extern grpc_byte_buffer_reader_exceeded_limit_type grpc_byte_buffer_reader_exceeded_limit_import;
+#define grpc_byte_buffer_reader_exceeded_limit grpc_byte_buffer_reader_exceeded_limit_import
 typedef grpc_slice(*grpc_byte_buffer_reader_readall_type)(grpc_byte_buffer_reader* reader);
 extern grpc_byte_buffer_reader_readall_type grpc_byte_buffer_reader_readall_import;
 #define grpc_byte_buffer_reader_readall grpc_byte_buffer_reader_readall_import
@@ -19,7 +19,7 @@ describe GRPC::Core::CompressionOptions do
   # according to what the core lib provides.
 
   # Names of supported compression algorithms
-  ALGORITHMS = [:identity, :deflate, :gzip]
+  ALGORITHMS = [:identity, :deflate, :gzip, :zstd, :'stream/zstd']
 
   # Names of valid supported compression levels
   COMPRESS_LEVELS = [:none, :low, :medium, :high]
@@ -98,6 +98,28 @@ describe GRPC::Core::CompressionOptions do
       expect(options.default_level).to be(:high)
       expect(options.to_hash).to be_instance_of(Hash)
     end
+
+    it 'works with zstd and a zstd level' do
+      options = GRPC::Core::CompressionOptions.new(
+        default_algorithm: :zstd,
+        zstd_level: 3
+      )
+
+      expect(options.default_algorithm).to be(:zstd)
+      expect(options.zstd_level).to eq(3)
+      expect(options.to_hash['grpc.zstd_compression_level']).to eq(3)
+    end
+
+    it 'works with stream zstd and a negative zstd level' do
+      options = GRPC::Core::CompressionOptions.new(
+        default_algorithm: :'stream/zstd',
+        zstd_level: -5
+      )
+
+      expect(options.default_algorithm).to be(:'stream/zstd')
+      expect(options.zstd_level).to eq(-5)
+      expect(options.to_hash['grpc.zstd_compression_level']).to eq(-5)
+    end
   end
 
   describe '#new with bad parameters' do
@@ -126,6 +148,14 @@ describe GRPC::Core::CompressionOptions do
     end
   end
 
+  describe '#zstd_level' do
+    it 'returns nil if unset' do
+      options = GRPC::Core::CompressionOptions.new
+      expect(options.zstd_level).to be(nil)
+      expect(options.to_hash.key?('grpc.zstd_compression_level')).to be false
+    end
+  end
+
   describe '#disabled_algorithms' do
     it 'returns an empty list if no algorithms were disabled' do
       options = GRPC::Core::CompressionOptions.new
@@ -301,6 +301,38 @@ TEST_P(ChannelzChannelTest, BasicChannelAPIFunctionality) {
   ValidateChannel(channelz_channel, {3, 3, 3});
 }
 
+TEST_P(ChannelzChannelTest, CompressionData) {
+  grpc_core::ExecCtx exec_ctx;
+  ChannelFixture channel(GetParam());
+  ChannelNode* channelz_channel =
+      grpc_channel_get_channelz_node(channel.channel());
+  CompressionCountingHelper* counter = channelz_channel->compression_counter();
+  counter->RecordMessageCompressed(GRPC_MESSAGE_COMPRESS_ZSTD, 1000, 200, 30);
+  counter->RecordMessageCompressed(GRPC_MESSAGE_COMPRESS_ZSTD, 100, 100, 5);
+  counter->RecordCompressedMessageReceived(GRPC_MESSAGE_COMPRESS_GZIP, 64);
+  ValidateChannel(channelz_channel, {0, 0, 0});
+  grpc_error* error = GRPC_ERROR_NONE;
+  Json json = Json::Parse(channelz_channel->RenderJsonString(), &error);
+  ASSERT_EQ(error, GRPC_ERROR_NONE) << grpc_error_string(error);
+  const Json::Object& data = json.object_value().at("data").object_value();
+  auto it = data.find("compression");
+  ASSERT_NE(it, data.end());
+  ValidateJsonArraySize(it->second, 2);
+  const Json::Array& compression = it->second.array_value();
+  const Json::Object& gzip = compression[0].object_value();
+  EXPECT_EQ(gzip.at("algorithm").string_value(), "gzip");
+  ValidateChildInteger(gzip, "messagesCompressed", 0);
+  ValidateChildInteger(gzip, "compressedMessagesReceived", 1);
+  ValidateChildInteger(gzip, "compressedBytesReceived", 64);
+  const Json::Object& zstd = compression[1].object_value();
+  EXPECT_EQ(zstd.at("algorithm").string_value(), "zstd");
+  ValidateChildInteger(zstd, "messagesCompressed", 2);
+  ValidateChildInteger(zstd, "compressionInputBytes", 1100);
+  ValidateChildInteger(zstd, "compressionOutputBytes", 300);
+  ValidateChildInteger(zstd, "messagesNotSmaller", 1);
+  EXPECT_EQ(zstd.at("compressionTime").string_value(), "0.000035s");
+}
+
 TEST_P(ChannelzChannelTest, LastCallStartedMillis) {
   grpc_core::ExecCtx exec_ctx;
   CallCountingHelper counter;
@@ -25,6 +25,7 @@
 #include <grpc/grpc.h>
 #include "src/core/ext/filters/client_channel/resolver_result_parsing.h"
 #include "src/core/ext/filters/client_channel/service_config.h"
+#include "src/core/ext/filters/http/message_compress/message_compress_filter.h"
 #include "src/core/ext/filters/message_size/message_size_filter.h"
 #include "src/core/lib/gpr/string.h"
 #include "test/core/util/port.h"
@@ -1013,6 +1014,81 @@ TEST_F(MessageSizeParserTest, InvalidMaxResponseMessageBytes) {
   VerifyRegexMatch(error, regex);
 }
 
+class MessageCompressParserTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ServiceConfig::Shutdown();
+    ServiceConfig::Init();
+    EXPECT_EQ(ServiceConfig::RegisterParser(
+                  absl::make_unique<MessageCompressParser>()),
+              0);
+  }
+};
+
+TEST_F(MessageCompressParserTest, ValidCompressionPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"compressionPolicy\": {\n"
+      "      \"algorithm\": \"zstd\",\n"
+      "      \"level\": -3,\n"
+      "      \"minMessageBytes\": 1024,\n"
+      "      \"direction\": \"RESPONSE\"\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  grpc_error* error = GRPC_ERROR_NONE;
+  auto svc_cfg = ServiceConfig::Create(test_json, &error);
+  ASSERT_EQ(error, GRPC_ERROR_NONE) << grpc_error_string(error);
+  const auto* vector_ptr = svc_cfg->GetMethodParsedConfigVector(
+      grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  const auto* parsed_config =
+      static_cast<MessageCompressParsedConfig*>(((*vector_ptr)[0]).get());
+  ASSERT_NE(parsed_config, nullptr);
+  const auto* policy = &parsed_config->policy();
+  ASSERT_TRUE(policy->algorithm.has_value());
+  EXPECT_EQ(*policy->algorithm, GRPC_COMPRESS_ZSTD);
+  ASSERT_TRUE(policy->level.has_value());
+  EXPECT_EQ(*policy->level, -3);
+  ASSERT_TRUE(policy->min_message_size.has_value());
+  EXPECT_EQ(*policy->min_message_size, 1024);
+  EXPECT_FALSE(policy->requests);
+  EXPECT_TRUE(policy->responses);
+}
+
+TEST_F(MessageCompressParserTest, InvalidCompressionPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"compressionPolicy\": {\n"
+      "      \"algorithm\": \"brotli\",\n"
+      "      \"minMessageBytes\": -1,\n"
+      "      \"direction\": \"BOTH\"\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  grpc_error* error = GRPC_ERROR_NONE;
+  auto svc_cfg = ServiceConfig::Create(test_json, &error);
+  std::regex regex(
+      "Service config parsing error.*referenced_errors.*"
+      "Method Params.*referenced_errors.*"
+      "methodConfig.*referenced_errors.*"
+      "Message compress parser.*referenced_errors.*"
+      "compressionPolicy.*referenced_errors.*"
+      "field:algorithm error:unknown compression algorithm.*"
+      "field:minMessageBytes error:should be non-negative.*"
+      "field:direction error:should be REQUEST, RESPONSE or "
+      "REQUEST_AND_RESPONSE");
+  VerifyRegexMatch(error, regex);
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
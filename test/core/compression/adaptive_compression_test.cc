@@ -0,0 +1,102 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/compression/adaptive_compression.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "test/core/util/test_config.h"
+
+using grpc_core::AdaptiveCompressionController;
+
+/* Sends n messages of 100KB through the controller. The compressor runs at
+ * compress_mbps and shrinks messages to ratio of their size, and the link
+ * carries link_mbps. Returns the level picked for the last message. */
+static int simulate(AdaptiveCompressionController* controller, int n,
+                    double compress_mbps, double ratio, double link_mbps) {
+  const size_t size = 100000;
+  int level = 0;
+  for (int i = 0; i < n; i++) {
+    level = controller->NextLevel();
+    size_t wire_bytes = size;
+    if (level != AdaptiveCompressionController::kUncompressed) {
+      wire_bytes = static_cast<size_t>(size * ratio);
+      controller->RecordCompression(level, size, wire_bytes,
+                                    size / (compress_mbps * 1e6));
+    }
+    controller->RecordTransmission(wire_bytes, wire_bytes / (link_mbps * 1e6));
+  }
+  return level;
+}
+
+static void test_bandwidth_limited(void) {
+  gpr_log(GPR_DEBUG, "test_bandwidth_limited");
+  AdaptiveCompressionController controller(5);
+  GPR_ASSERT(controller.NextLevel() == 5);
+  /* A fast compressor on a slow link climbs to the strongest level. */
+  GPR_ASSERT(simulate(&controller, 100, 200, 0.3, 1) == 15);
+}
+
+static void test_cpu_bound(void) {
+  gpr_log(GPR_DEBUG, "test_cpu_bound");
+  AdaptiveCompressionController controller(5);
+  /* A compressor slower than the raw link stops compressing. */
+  GPR_ASSERT(simulate(&controller, 100, 10, 0.5, 1000) ==
+             AdaptiveCompressionController::kUncompressed);
+}
+
+static void test_balanced(void) {
+  gpr_log(GPR_DEBUG, "test_balanced");
+  AdaptiveCompressionController controller(3);
+  /* The compressor outpaces the compressed link, but not by enough to afford
+   * a stronger level. */
+  GPR_ASSERT(simulate(&controller, 100, 30, 0.5, 10) == 3);
+}
+
+static void test_probe_after_uncompressed(void) {
+  gpr_log(GPR_DEBUG, "test_probe_after_uncompressed");
+  AdaptiveCompressionController controller(5);
+  GPR_ASSERT(simulate(&controller, 100, 10, 0.5, 1000) ==
+             AdaptiveCompressionController::kUncompressed);
+  /* The link slows down: once the fastest level is tried again, the
+   * controller climbs back up. */
+  GPR_ASSERT(simulate(&controller, 1000, 200, 0.3, 1) == 15);
+}
+
+static void test_initial_level(void) {
+  gpr_log(GPR_DEBUG, "test_initial_level");
+  GPR_ASSERT(AdaptiveCompressionController(-7).NextLevel() == -5);
+  GPR_ASSERT(AdaptiveCompressionController(4).NextLevel() == 3);
+  GPR_ASSERT(AdaptiveCompressionController(22).NextLevel() == 15);
+}
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  grpc_init();
+
+  test_bandwidth_limited();
+  test_cpu_bound();
+  test_balanced();
+  test_probe_after_uncompressed();
+  test_initial_level();
+
+  grpc_shutdown();
+
+  return 0;
+}
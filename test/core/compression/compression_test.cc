@@ -25,16 +25,18 @@
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/compression/compression_args.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/util/test_config.h"
 
 static void test_compression_algorithm_parse(void) {
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate", "stream/gzip"};
+  const char* valid_names[] = {"identity", "gzip",        "deflate",
+                               "lz4",      "stream/gzip"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
-      GRPC_COMPRESS_STREAM_GZIP};
+      GRPC_COMPRESS_LZ4, GRPC_COMPRESS_STREAM_GZIP};
   const char* invalid_names[] = {"gzip2", "foo", "", "2gzip"};
 
   gpr_log(GPR_DEBUG, "test_compression_algorithm_parse");
@@ -63,10 +65,11 @@ static void test_compression_algorithm_name(void) {
   int success;
   const char* name;
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate", "stream/gzip"};
+  const char* valid_names[] = {"identity", "gzip",        "deflate",
+                               "lz4",      "stream/gzip"};
   const grpc_compression_algorithm valid_algorithms[] = {
       GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
-      GRPC_COMPRESS_STREAM_GZIP};
+      GRPC_COMPRESS_LZ4, GRPC_COMPRESS_STREAM_GZIP};
 
   gpr_log(GPR_DEBUG, "test_compression_algorithm_name");
 
@@ -177,6 +180,58 @@ static void test_compression_algorithm_for_level(void) {
                                                     accepted_encodings));
   }
 
+  {
+    /* accept gzip, deflate and zstd: zstd is preferred at every level */
+    uint32_t accepted_encodings = 0;
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_NONE); /* always */
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_GZIP);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_DEFLATE);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_ZSTD);
+
+    GPR_ASSERT(GRPC_COMPRESS_NONE ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_NONE,
+                                                    accepted_encodings));
+
+    GPR_ASSERT(GRPC_COMPRESS_ZSTD ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_LOW,
+                                                    accepted_encodings));
+
+    GPR_ASSERT(GRPC_COMPRESS_ZSTD ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_MED,
+                                                    accepted_encodings));
+
+    GPR_ASSERT(GRPC_COMPRESS_ZSTD ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
+                                                    accepted_encodings));
+  }
+
+  {
+    /* accept gzip, deflate and lz4: lz4 is the fastest, so the lowest */
+    uint32_t accepted_encodings = 0;
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_NONE); /* always */
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_GZIP);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_DEFLATE);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_LZ4);
+
+    GPR_ASSERT(GRPC_COMPRESS_LZ4 ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_LOW,
+                                                    accepted_encodings));
+
+    GPR_ASSERT(GRPC_COMPRESS_GZIP ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_MED,
+                                                    accepted_encodings));
+
+    GPR_ASSERT(GRPC_COMPRESS_DEFLATE ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
+                                                    accepted_encodings));
+
+    /* zstd wins over lz4 whenever both are accepted */
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_ZSTD);
+    GPR_ASSERT(GRPC_COMPRESS_ZSTD ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_LOW,
+                                                    accepted_encodings));
+  }
+
   {
     /* accept stream gzip */
     uint32_t accepted_encodings = 0;
@@ -226,6 +281,31 @@ static void test_compression_algorithm_for_level(void) {
   }
 }
 
+static void test_compression_bitset_conversion(void) {
+  gpr_log(GPR_DEBUG, "test_compression_bitset_conversion");
+
+  /* The stream algorithms keep the values they had before lz4 was added. */
+  GPR_ASSERT(GRPC_COMPRESS_STREAM_GZIP == 4);
+  GPR_ASSERT(GRPC_COMPRESS_STREAM_ZSTD == 5);
+  GPR_ASSERT(GRPC_COMPRESS_LZ4 == 6);
+
+  uint32_t bitset = 0;
+  GPR_BITSET(&bitset, GRPC_COMPRESS_NONE);
+  GPR_BITSET(&bitset, GRPC_COMPRESS_GZIP);
+  GPR_BITSET(&bitset, GRPC_COMPRESS_STREAM_ZSTD);
+  GPR_BITSET(&bitset, GRPC_COMPRESS_LZ4);
+
+  uint32_t message_bitset = grpc_compression_bitset_to_message_bitset(bitset);
+  uint32_t stream_bitset = grpc_compression_bitset_to_stream_bitset(bitset);
+  GPR_ASSERT(message_bitset == ((1u << GRPC_MESSAGE_COMPRESS_NONE) |
+                                (1u << GRPC_MESSAGE_COMPRESS_GZIP) |
+                                (1u << GRPC_MESSAGE_COMPRESS_LZ4)));
+  GPR_ASSERT(stream_bitset == ((1u << GRPC_STREAM_COMPRESS_NONE) |
+                               (1u << GRPC_STREAM_COMPRESS_ZSTD)));
+  GPR_ASSERT(grpc_compression_bitset_from_message_stream_compression_bitset(
+                 message_bitset, stream_bitset) == bitset);
+}
+
 static void test_compression_enable_disable_algorithm(void) {
   grpc_compression_options options;
   grpc_compression_algorithm algorithm;
@@ -340,6 +420,7 @@ int main(int /*argc*/, char** /*argv*/) {
   test_compression_algorithm_parse();
   test_compression_algorithm_name();
   test_compression_algorithm_for_level();
+  test_compression_bitset_conversion();
   test_compression_enable_disable_algorithm();
   test_channel_args_set_compression_algorithm();
   test_channel_args_compression_algorithm_states();
@@ -21,8 +21,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <grpc/compression.h>
 #include <grpc/grpc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
+
+#include <zdict.h>
+#include <zstd.h>
 
 #include "src/core/lib/gpr/murmur_hash.h"
 #include "src/core/lib/gpr/useful.h"
@@ -166,6 +171,500 @@ static void test_tiny_data_compress(void) {
   grpc_slice_buffer_destroy(&output);
 }
 
+static void test_zstd_compression_levels(void) {
+  /* Out of range levels are clamped by zstd, so every level must round trip */
+  const int levels[] = {-5, 1, 5, 9, 19, 1000};
+  grpc_slice value = create_test_value(ONE_KB_A);
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(levels); i++) {
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&input, grpc_slice_ref(value));
+
+    grpc_core::ExecCtx exec_ctx;
+    grpc_msg_compress_options options;
+    grpc_msg_compress_options_init(&options);
+    options.level = levels[i];
+    GPR_ASSERT(1 == grpc_msg_compress_with_options(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                   &options, &input,
+                                                   &compressed));
+    GPR_ASSERT(1 == grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                        &compressed, &output));
+    grpc_slice final = grpc_slice_merge(output.slices, output.count);
+    GPR_ASSERT(grpc_slice_eq(value, final));
+    grpc_slice_unref(final);
+
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+  grpc_slice_unref(value);
+}
+
+static void test_zstd_single_slice(void) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice value = create_test_value(ONE_MB_A);
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_split_slices_to_buffer(GRPC_SLICE_SPLIT_ONE_BYTE, &value, 1, &input);
+
+  /* both directions produce one slice, however fragmented the input is */
+  grpc_core::ExecCtx exec_ctx;
+  GPR_ASSERT(1 ==
+             grpc_msg_compress(GRPC_MESSAGE_COMPRESS_ZSTD, &input, &compressed));
+  GPR_ASSERT(1 == compressed.count);
+  grpc_slice_buffer_reset_and_unref(&input);
+  grpc_split_slice_buffer(GRPC_SLICE_SPLIT_ONE_BYTE, &compressed, &input);
+  GPR_ASSERT(1 ==
+             grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_ZSTD, &input, &output));
+  GPR_ASSERT(1 == output.count);
+  GPR_ASSERT(grpc_slice_eq(value, output.slices[0]));
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+  grpc_slice_unref(value);
+}
+
+static void test_incremental_compression(void) {
+  const grpc_message_compression_algorithm algorithms[] = {
+      GRPC_MESSAGE_COMPRESS_DEFLATE, GRPC_MESSAGE_COMPRESS_GZIP,
+      GRPC_MESSAGE_COMPRESS_ZSTD, GRPC_MESSAGE_COMPRESS_LZ4};
+  /* a tiny message grows when compressed, and must be complete anyway */
+  const test_value values[] = {ONE_A, ONE_MB_A};
+  const size_t kPieceSize = 3000;
+  grpc_core::ExecCtx exec_ctx;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(algorithms); i++) {
+    for (size_t j = 0; j < GPR_ARRAY_SIZE(values); j++) {
+      grpc_slice value = create_test_value(values[j]);
+      grpc_slice_buffer compressed;
+      grpc_slice_buffer output;
+      grpc_slice_buffer_init(&compressed);
+      grpc_slice_buffer_init(&output);
+      grpc_msg_compress_options options;
+      grpc_msg_compress_options_init(&options);
+      grpc_msg_compressor* compressor =
+          grpc_msg_compressor_create(algorithms[i], &options);
+      GPR_ASSERT(compressor != nullptr);
+      for (size_t offset = 0; offset < GRPC_SLICE_LENGTH(value);
+           offset += kPieceSize) {
+        GPR_ASSERT(1 == grpc_msg_compressor_write(
+                            compressor, GRPC_SLICE_START_PTR(value) + offset,
+                            GPR_MIN(kPieceSize,
+                                    GRPC_SLICE_LENGTH(value) - offset),
+                            &compressed));
+      }
+      GPR_ASSERT(1 == grpc_msg_compressor_finish(compressor, &compressed));
+      /* the message has ended */
+      GPR_ASSERT(0 == grpc_msg_compressor_write(
+                          compressor, GRPC_SLICE_START_PTR(value), 1,
+                          &compressed));
+      grpc_msg_compressor_destroy(compressor);
+      if (values[j] == ONE_MB_A) {
+        GPR_ASSERT(compressed.length < GRPC_SLICE_LENGTH(value));
+      }
+      GPR_ASSERT(1 == grpc_msg_decompress(algorithms[i], &compressed, &output));
+      grpc_slice merged = grpc_slice_merge(output.slices, output.count);
+      GPR_ASSERT(grpc_slice_eq(value, merged));
+      grpc_slice_unref(merged);
+      grpc_slice_buffer_destroy(&compressed);
+      grpc_slice_buffer_destroy(&output);
+      grpc_slice_unref(value);
+    }
+  }
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  GPR_ASSERT(nullptr ==
+             grpc_msg_compressor_create(GRPC_MESSAGE_COMPRESS_NONE, &options));
+}
+
+static void test_zstd_workers(void) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+
+  /* large enough for zstd to split the frame into several jobs */
+  const size_t length = 16 * 1024 * 1024;
+  grpc_slice value = grpc_slice_malloc(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(value);
+  srand(1);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = static_cast<uint8_t>('a' + rand() % 4);
+  }
+  grpc_slice_buffer_add(&input, grpc_slice_ref(value));
+
+  grpc_core::ExecCtx exec_ctx;
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  options.level = 3;
+  options.workers = 4;
+  GPR_ASSERT(1 == grpc_msg_compress_with_options(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                 &options, &input,
+                                                 &compressed));
+  /* a single standard frame, with its content size */
+  GPR_ASSERT(1 == compressed.count);
+  const grpc_slice& frame = compressed.slices[0];
+  GPR_ASSERT(ZSTD_findFrameCompressedSize(GRPC_SLICE_START_PTR(frame),
+                                          GRPC_SLICE_LENGTH(frame)) ==
+             GRPC_SLICE_LENGTH(frame));
+  GPR_ASSERT(ZSTD_getFrameContentSize(GRPC_SLICE_START_PTR(frame),
+                                      GRPC_SLICE_LENGTH(frame)) == length);
+  GPR_ASSERT(1 == grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_ZSTD, &compressed,
+                                      &output));
+  grpc_slice final = grpc_slice_merge(output.slices, output.count);
+  GPR_ASSERT(grpc_slice_eq(value, final));
+  grpc_slice_unref(final);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+  grpc_slice_unref(value);
+}
+
+/* Decompresses 'input' a slice at a time, as the byte buffer reader does.
+   Returns 1 on success and -1 on failure. */
+static int decompress_incrementally(grpc_message_compression_algorithm algorithm,
+                                    const grpc_msg_decompress_options* options,
+                                    grpc_slice_buffer* input,
+                                    grpc_slice_buffer* output) {
+  grpc_msg_decompressor* decompressor =
+      grpc_msg_decompressor_create(algorithm, options, input);
+  if (decompressor == nullptr) return -1;
+  grpc_slice slice;
+  int r;
+  while ((r = grpc_msg_decompressor_next(decompressor, &slice)) == 1) {
+    grpc_slice_buffer_add(output, slice);
+  }
+  grpc_msg_decompressor_destroy(decompressor);
+  return r == 0 ? 1 : -1;
+}
+
+static void test_zstd_window_log_max(void) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer capped;
+  grpc_slice_buffer uncapped;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&capped);
+  grpc_slice_buffer_init(&uncapped);
+  grpc_slice_buffer_init(&output);
+
+  const size_t length = 1024 * 1024;
+  grpc_slice value = grpc_slice_malloc(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(value);
+  srand(1);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = static_cast<uint8_t>('a' + rand() % 4);
+  }
+  grpc_slice_buffer_add(&input, grpc_slice_ref(value));
+
+  grpc_core::ExecCtx exec_ctx;
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  options.level = 3;
+  /* uncapped, the whole message fits in the window */
+  GPR_ASSERT(1 == grpc_msg_compress_with_options(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                 &options, &input,
+                                                 &uncapped));
+  options.window_log_max = 17;
+  GPR_ASSERT(1 == grpc_msg_compress_with_options(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                 &options, &input, &capped));
+
+  grpc_msg_decompress_options limits;
+  grpc_msg_decompress_options_init(&limits);
+  limits.window_log_max = 17;
+  GPR_ASSERT(1 == decompress_incrementally(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                           &limits, &capped, &output));
+  grpc_slice final = grpc_slice_merge(output.slices, output.count);
+  GPR_ASSERT(grpc_slice_eq(value, final));
+  grpc_slice_unref(final);
+  grpc_slice_buffer_reset_and_unref(&output);
+  GPR_ASSERT(-1 == decompress_incrementally(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                            &limits, &uncapped, &output));
+  grpc_slice_buffer_reset_and_unref(&output);
+
+  /* streamed frames honor the cap too */
+  grpc_slice_buffer streamed;
+  grpc_slice_buffer_init(&streamed);
+  grpc_msg_compressor* compressor =
+      grpc_msg_compressor_create(GRPC_MESSAGE_COMPRESS_ZSTD, &options);
+  GPR_ASSERT(grpc_msg_compressor_write(compressor, GRPC_SLICE_START_PTR(value),
+                                       length, &streamed));
+  GPR_ASSERT(grpc_msg_compressor_finish(compressor, &streamed));
+  grpc_msg_compressor_destroy(compressor);
+  GPR_ASSERT(1 == decompress_incrementally(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                           &limits, &streamed, &output));
+  GPR_ASSERT(output.length == length);
+  grpc_slice_buffer_reset_and_unref(&output);
+  grpc_slice_buffer_destroy(&streamed);
+
+  /* frames ahead of the large one do not hide its window: a skippable frame,
+     then a small frame with a small window */
+  static const uint8_t skippable[] = {0x50, 0x2a, 0x4d, 0x18, 4, 0, 0, 0,
+                                      1,    2,    3,    4};
+  grpc_slice_buffer prefixes[2];
+  grpc_slice_buffer_init(&prefixes[0]);
+  grpc_slice_buffer_add(&prefixes[0], grpc_slice_from_static_buffer(
+                                          skippable, sizeof(skippable)));
+  grpc_slice_buffer small;
+  grpc_slice_buffer_init(&small);
+  grpc_slice_buffer_add(&small, repeated('a', 1000));
+  grpc_slice_buffer_init(&prefixes[1]);
+  GPR_ASSERT(1 == grpc_msg_compress_with_options(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                 &options, &small,
+                                                 &prefixes[1]));
+  grpc_slice_buffer_destroy(&small);
+  for (grpc_slice_buffer& prefixed : prefixes) {
+    for (size_t i = 0; i < uncapped.count; i++) {
+      grpc_slice_buffer_add(&prefixed, grpc_slice_ref(uncapped.slices[i]));
+    }
+    GPR_ASSERT(0 == grpc_msg_decompress_with_options(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                     &limits, &prefixed,
+                                                     &output));
+    GPR_ASSERT(0 == output.count);
+    GPR_ASSERT(-1 == decompress_incrementally(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                              &limits, &prefixed, &output));
+    grpc_slice_buffer_reset_and_unref(&output);
+    /* without the cap, the same input decompresses */
+    GPR_ASSERT(1 == grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_ZSTD, &prefixed,
+                                        &output));
+    GPR_ASSERT(output.length >= length);
+    grpc_slice_buffer_reset_and_unref(&output);
+    grpc_slice_buffer_destroy(&prefixed);
+  }
+
+  /* the memory charged grows with messages up to the window */
+  grpc_msg_compress_options unbounded;
+  grpc_msg_compress_options_init(&unbounded);
+  unbounded.level = 3;
+  GPR_ASSERT(grpc_msg_compress_memory_estimate(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                               &options, 1024) <
+             grpc_msg_compress_memory_estimate(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                               &options, length));
+  GPR_ASSERT(grpc_msg_compress_memory_estimate(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                               &options, length) <
+             grpc_msg_compress_memory_estimate(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                               &unbounded, length));
+  GPR_ASSERT(grpc_msg_compress_memory_estimate(GRPC_MESSAGE_COMPRESS_NONE,
+                                               &unbounded, length) == 0);
+
+  /* decompressing is charged the declared size, and the window up to its cap */
+  grpc_msg_decompress_options unlimited;
+  grpc_msg_decompress_options_init(&unlimited);
+  GPR_ASSERT(grpc_msg_decompress_memory_estimate(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                 &limits, &capped) ==
+             length + (size_t{1} << 17));
+  GPR_ASSERT(grpc_msg_decompress_memory_estimate(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                 &unlimited, &capped) ==
+             2 * length);
+  unlimited.max_output_length = 1024;
+  GPR_ASSERT(grpc_msg_decompress_memory_estimate(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                 &unlimited, &capped) == 2048);
+  GPR_ASSERT(grpc_msg_decompress_memory_estimate(GRPC_MESSAGE_COMPRESS_NONE,
+                                                 &limits, &capped) == 0);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&capped);
+  grpc_slice_buffer_destroy(&uncapped);
+  grpc_slice_buffer_destroy(&output);
+  grpc_slice_unref(value);
+}
+
+static void test_decompression_limit(void) {
+  /* a megabyte of zeros compresses to almost nothing */
+  const size_t length = 1024 * 1024;
+  grpc_slice value = grpc_slice_malloc(length);
+  memset(GRPC_SLICE_START_PTR(value), 0, length);
+  grpc_core::ExecCtx exec_ctx;
+
+  for (int algorithm = GRPC_MESSAGE_COMPRESS_NONE;
+       algorithm < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; algorithm++) {
+    const auto message_algorithm =
+        static_cast<grpc_message_compression_algorithm>(algorithm);
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_slice_buffer_add(&input, grpc_slice_ref(value));
+
+    /* frames declaring their content size, and streamed ones that do not */
+    const int max_streamed = algorithm == GRPC_MESSAGE_COMPRESS_NONE ? 0 : 1;
+    for (int streamed = 0; streamed <= max_streamed; streamed++) {
+      if (streamed) {
+        grpc_msg_compress_options compress_options;
+        grpc_msg_compress_options_init(&compress_options);
+        compress_options.level = 3;
+        grpc_msg_compressor* compressor =
+            grpc_msg_compressor_create(message_algorithm, &compress_options);
+        GPR_ASSERT(grpc_msg_compressor_write(
+            compressor, GRPC_SLICE_START_PTR(value), length, &compressed));
+        GPR_ASSERT(grpc_msg_compressor_finish(compressor, &compressed));
+        grpc_msg_compressor_destroy(compressor);
+      } else {
+        grpc_msg_compress(message_algorithm, &input, &compressed);
+      }
+      grpc_msg_decompress_options options;
+      grpc_msg_decompress_options_init(&options);
+      options.max_output_length = length / 16;
+      GPR_ASSERT(-1 == grpc_msg_decompress_with_options(
+                           message_algorithm, &options, &compressed, &output));
+      GPR_ASSERT(0 == output.count);
+      options.max_output_length = length - 1;
+      GPR_ASSERT(-1 == grpc_msg_decompress_with_options(
+                           message_algorithm, &options, &compressed, &output));
+      GPR_ASSERT(0 == output.count);
+      options.max_output_length = length;
+      GPR_ASSERT(1 == grpc_msg_decompress_with_options(
+                          message_algorithm, &options, &compressed, &output));
+      GPR_ASSERT(length == output.length);
+      grpc_slice_buffer_reset_and_unref(&output);
+      /* decompressing a slice at a time stops at the limit as well */
+      options.max_output_length = length - 1;
+      GPR_ASSERT(-1 == decompress_incrementally(message_algorithm, &options,
+                                                &compressed, &output));
+      grpc_slice_buffer_reset_and_unref(&output);
+      options.max_output_length = length;
+      GPR_ASSERT(1 == decompress_incrementally(message_algorithm, &options,
+                                               &compressed, &output));
+      GPR_ASSERT(length == output.length);
+      grpc_slice_buffer_reset_and_unref(&compressed);
+      grpc_slice_buffer_reset_and_unref(&output);
+    }
+
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+  grpc_slice_unref(value);
+}
+
+static void test_compressibility_probe(void) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer_init(&input);
+  grpc_core::ExecCtx exec_ctx;
+
+  /* too small to be probed */
+  grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+  GPR_ASSERT(grpc_msg_is_compressible(&input, 99));
+  grpc_slice_buffer_reset_and_unref(&input);
+
+  grpc_slice value = create_test_value(ONE_MB_A);
+  grpc_split_slices_to_buffer(GRPC_SLICE_SPLIT_ONE_BYTE, &value, 1, &input);
+  grpc_slice_unref(value);
+  GPR_ASSERT(grpc_msg_is_compressible(&input, 90));
+  grpc_slice_buffer_reset_and_unref(&input);
+
+  /* half random bytes, half 'a's: the samples cover both halves */
+  const size_t length = 256 * 1024;
+  grpc_slice mixed = grpc_slice_malloc(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(mixed);
+  srand(1);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = i < length / 2 ? static_cast<uint8_t>(rand()) : 'a';
+  }
+  grpc_slice_buffer_add(&input, grpc_slice_ref(mixed));
+  GPR_ASSERT(grpc_msg_is_compressible(&input, 25));
+  GPR_ASSERT(!grpc_msg_is_compressible(&input, 75));
+  grpc_slice_buffer_reset_and_unref(&input);
+
+  /* random bytes only save something when the probe is disabled */
+  grpc_slice_buffer_add(&input, grpc_slice_sub(mixed, 0, length / 2));
+  GPR_ASSERT(!grpc_msg_is_compressible(&input, 2));
+  GPR_ASSERT(grpc_msg_is_compressible(&input, 0));
+  grpc_slice_unref(mixed);
+
+  grpc_slice_buffer_destroy(&input);
+}
+
+static void test_zstd_dictionary(void) {
+  /* train a dictionary on small, similar messages */
+  const size_t kNumSamples = 1000;
+  char* samples = nullptr;
+  size_t samples_length = 0;
+  size_t sample_sizes[kNumSamples];
+  for (size_t i = 0; i < kNumSamples; i++) {
+    char* sample;
+    sample_sizes[i] = static_cast<size_t>(gpr_asprintf(
+        &sample, "{\"user_id\": %d, \"status\": \"%s\", \"region\": \"%s\"}",
+        static_cast<int>(i * 7919 % 100000), i % 3 ? "ACTIVE" : "SUSPENDED",
+        i % 2 ? "us-east" : "eu-west"));
+    samples = static_cast<char*>(
+        gpr_realloc(samples, samples_length + sample_sizes[i]));
+    memcpy(samples + samples_length, sample, sample_sizes[i]);
+    samples_length += sample_sizes[i];
+    gpr_free(sample);
+  }
+  char dictionary_data[4096];
+  size_t dictionary_size =
+      ZDICT_trainFromBuffer(dictionary_data, sizeof(dictionary_data), samples,
+                            sample_sizes, kNumSamples);
+  GPR_ASSERT(!ZDICT_isError(dictionary_size));
+  gpr_free(samples);
+
+  /* raw content without a dictionary header is rejected */
+  GPR_ASSERT(grpc_zstd_dictionary_create("not a dictionary", 16) == nullptr);
+  grpc_zstd_dictionary* dictionary =
+      grpc_zstd_dictionary_create(dictionary_data, dictionary_size);
+  GPR_ASSERT(dictionary != nullptr);
+  /* loading the same dictionary again returns the cached one */
+  grpc_zstd_dictionary* again =
+      grpc_zstd_dictionary_create(dictionary_data, dictionary_size);
+  GPR_ASSERT(again == dictionary);
+  grpc_zstd_dictionary_unref(again);
+
+  grpc_slice value = grpc_slice_from_static_string(
+      "{\"user_id\": 4242, \"status\": \"ACTIVE\", \"region\": \"eu-west\"}");
+  grpc_slice_buffer input;
+  grpc_slice_buffer plain;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&plain);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, value);
+
+  grpc_core::ExecCtx exec_ctx;
+  /* too small to compress on its own, but not with the dictionary */
+  GPR_ASSERT(0 ==
+             grpc_msg_compress(GRPC_MESSAGE_COMPRESS_ZSTD, &input, &plain));
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  options.dictionary = dictionary;
+  GPR_ASSERT(1 == grpc_msg_compress_with_options(GRPC_MESSAGE_COMPRESS_ZSTD,
+                                                 &options, &input,
+                                                 &compressed));
+  GPR_ASSERT(1 == grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_ZSTD, &compressed,
+                                      &output));
+  grpc_slice final = grpc_slice_merge(output.slices, output.count);
+  GPR_ASSERT(grpc_slice_eq(value, final));
+  grpc_slice_unref(final);
+
+  /* once the dictionary is gone, its frames cannot be decompressed */
+  grpc_zstd_dictionary_unref(dictionary);
+  grpc_slice_buffer_reset_and_unref(&output);
+  GPR_ASSERT(0 == grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_ZSTD, &compressed,
+                                      &output));
+  GPR_ASSERT(0 == output.count);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&plain);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
 static void test_bad_decompression_data_crc(void) {
   grpc_slice_buffer input;
   grpc_slice_buffer corrupted;
@@ -216,6 +715,30 @@ static void test_bad_decompression_data_trailing_garbage(void) {
   grpc_slice_buffer_destroy(&output);
 }
 
+static void test_bad_decompression_data_truncated_lz4(void) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  GPR_ASSERT(1 ==
+             grpc_msg_compress(GRPC_MESSAGE_COMPRESS_LZ4, &input, &compressed));
+  /* drop the end mark: every block decodes, but the frame never ends */
+  grpc_slice_buffer_trim_end(&compressed, 4, nullptr);
+  GPR_ASSERT(0 == grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_LZ4, &compressed,
+                                      &output));
+  GPR_ASSERT(0 == output.length);
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
 static void test_bad_decompression_data_stream(void) {
   grpc_slice_buffer input;
   grpc_slice_buffer output;
@@ -314,9 +837,18 @@ int main(int argc, char** argv) {
   }
 
   test_tiny_data_compress();
+  test_zstd_compression_levels();
+  test_zstd_single_slice();
+  test_incremental_compression();
+  test_zstd_workers();
+  test_zstd_window_log_max();
+  test_decompression_limit();
+  test_compressibility_probe();
+  test_zstd_dictionary();
   test_bad_decompression_data_crc();
   test_bad_decompression_data_stream();
   test_bad_decompression_data_trailing_garbage();
+  test_bad_decompression_data_truncated_lz4();
   test_bad_compression_algorithm();
   test_bad_decompression_algorithm();
   grpc_shutdown();
@@ -55,18 +55,18 @@ static bool slice_buffer_equals_string(grpc_slice_buffer* buf,
   return true;
 }
 
-static void test_stream_compression_simple_compress_decompress() {
+static void test_stream_compression_simple_compress_decompress(
+    grpc_stream_compression_method compress_method,
+    grpc_stream_compression_method decompress_method) {
   const char test_str[] = "aaaaaaabbbbbbbccccccctesttesttest";
   grpc_slice_buffer source, relay, sink;
   grpc_slice_buffer_init(&source);
   grpc_slice_buffer_init(&relay);
   grpc_slice_buffer_init(&sink);
   grpc_stream_compression_context* compress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_COMPRESS);
+      grpc_stream_compression_context_create(compress_method);
   grpc_stream_compression_context* decompress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS);
+      grpc_stream_compression_context_create(decompress_method);
   grpc_slice slice = grpc_slice_from_static_string(test_str);
   grpc_slice_buffer_add(&source, slice);
   GPR_ASSERT(grpc_stream_compress(compress_ctx, &source, &relay, nullptr,
@@ -88,18 +88,18 @@ static void test_stream_compression_simple_compress_decompress() {
 }
 
 static void
-test_stream_compression_simple_compress_decompress_with_output_size_constraint() {
+test_stream_compression_simple_compress_decompress_with_output_size_constraint(
+    grpc_stream_compression_method compress_method,
+    grpc_stream_compression_method decompress_method) {
   const char test_str[] = "aaaaaaabbbbbbbccccccctesttesttest";
   grpc_slice_buffer source, relay, sink;
   grpc_slice_buffer_init(&source);
   grpc_slice_buffer_init(&relay);
   grpc_slice_buffer_init(&sink);
   grpc_stream_compression_context* compress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_COMPRESS);
+      grpc_stream_compression_context_create(compress_method);
   grpc_stream_compression_context* decompress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS);
+      grpc_stream_compression_context_create(decompress_method);
   grpc_slice slice = grpc_slice_from_static_string(test_str);
   grpc_slice_buffer_add(&source, slice);
   GPR_ASSERT(grpc_stream_compress(compress_ctx, &source, &relay, nullptr,
@@ -136,7 +136,9 @@ test_stream_compression_simple_compress_decompress_with_output_size_constraint()
 
 #define LARGE_DATA_SIZE (1024 * 1024)
 static void
-test_stream_compression_simple_compress_decompress_with_large_data() {
+test_stream_compression_simple_compress_decompress_with_large_data(
+    grpc_stream_compression_method compress_method,
+    grpc_stream_compression_method decompress_method) {
   char* test_str =
       static_cast<char*>(gpr_malloc(LARGE_DATA_SIZE * sizeof(char)));
   generate_random_payload(test_str, LARGE_DATA_SIZE);
@@ -145,11 +147,9 @@ test_stream_compression_simple_compress_decompress_with_large_data() {
   grpc_slice_buffer_init(&relay);
   grpc_slice_buffer_init(&sink);
   grpc_stream_compression_context* compress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_COMPRESS);
+      grpc_stream_compression_context_create(compress_method);
   grpc_stream_compression_context* decompress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS);
+      grpc_stream_compression_context_create(decompress_method);
   grpc_slice slice = grpc_slice_from_static_string(test_str);
   grpc_slice_buffer_add(&source, slice);
   GPR_ASSERT(grpc_stream_compress(compress_ctx, &source, &relay, nullptr,
@@ -171,7 +171,9 @@ test_stream_compression_simple_compress_decompress_with_large_data() {
   gpr_free(test_str);
 }
 
-static void test_stream_compression_drop_context() {
+static void test_stream_compression_drop_context(
+    grpc_stream_compression_method compress_method,
+    grpc_stream_compression_method decompress_method) {
   const char test_str[] = "aaaaaaabbbbbbbccccccc";
   const char test_str2[] = "dddddddeeeeeeefffffffggggg";
   grpc_slice_buffer source, relay, sink;
@@ -179,8 +181,7 @@ static void test_stream_compression_drop_context() {
   grpc_slice_buffer_init(&relay);
   grpc_slice_buffer_init(&sink);
   grpc_stream_compression_context* compress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_COMPRESS);
+      grpc_stream_compression_context_create(compress_method);
   grpc_slice slice = grpc_slice_from_static_string(test_str);
   grpc_slice_buffer_add(&source, slice);
   GPR_ASSERT(grpc_stream_compress(compress_ctx, &source, &relay, nullptr,
@@ -188,8 +189,7 @@ static void test_stream_compression_drop_context() {
                                   GRPC_STREAM_COMPRESSION_FLUSH_FINISH));
   grpc_stream_compression_context_destroy(compress_ctx);
 
-  compress_ctx = grpc_stream_compression_context_create(
-      GRPC_STREAM_COMPRESSION_GZIP_COMPRESS);
+  compress_ctx = grpc_stream_compression_context_create(compress_method);
   slice = grpc_slice_from_static_string(test_str2);
   grpc_slice_buffer_add(&source, slice);
   GPR_ASSERT(grpc_stream_compress(compress_ctx, &source, &relay, nullptr,
@@ -212,8 +212,7 @@ static void test_stream_compression_drop_context() {
   grpc_slice_buffer_add(&relay, slice3);
 
   grpc_stream_compression_context* decompress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS);
+      grpc_stream_compression_context_create(decompress_method);
   bool end_of_context;
   size_t output_size;
   GPR_ASSERT(grpc_stream_decompress(decompress_ctx, &relay, &sink, &output_size,
@@ -226,8 +225,7 @@ static void test_stream_compression_drop_context() {
   grpc_slice_buffer_destroy(&sink);
 
   grpc_slice_buffer_init(&sink);
-  decompress_ctx = grpc_stream_compression_context_create(
-      GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS);
+  decompress_ctx = grpc_stream_compression_context_create(decompress_method);
   GPR_ASSERT(grpc_stream_decompress(decompress_ctx, &relay, &sink, &output_size,
                                     ~(size_t)0, &end_of_context));
   GPR_ASSERT(end_of_context == true);
@@ -240,7 +238,9 @@ static void test_stream_compression_drop_context() {
   grpc_slice_buffer_destroy(&sink);
 }
 
-static void test_stream_compression_sync_flush() {
+static void test_stream_compression_sync_flush(
+    grpc_stream_compression_method compress_method,
+    grpc_stream_compression_method decompress_method) {
   const char test_str[] = "aaaaaaabbbbbbbccccccc";
   const char test_str2[] = "dddddddeeeeeeefffffffggggg";
   grpc_slice_buffer source, relay, sink;
@@ -248,8 +248,7 @@ static void test_stream_compression_sync_flush() {
   grpc_slice_buffer_init(&relay);
   grpc_slice_buffer_init(&sink);
   grpc_stream_compression_context* compress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_COMPRESS);
+      grpc_stream_compression_context_create(compress_method);
   grpc_slice slice = grpc_slice_from_static_string(test_str);
   grpc_slice_buffer_add(&source, slice);
   GPR_ASSERT(grpc_stream_compress(compress_ctx, &source, &relay, nullptr,
@@ -257,8 +256,7 @@ static void test_stream_compression_sync_flush() {
                                   GRPC_STREAM_COMPRESSION_FLUSH_SYNC));
 
   grpc_stream_compression_context* decompress_ctx =
-      grpc_stream_compression_context_create(
-          GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS);
+      grpc_stream_compression_context_create(decompress_method);
   bool end_of_context;
   size_t output_size;
   GPR_ASSERT(grpc_stream_decompress(decompress_ctx, &relay, &sink, &output_size,
@@ -288,14 +286,75 @@ static void test_stream_compression_sync_flush() {
   grpc_slice_buffer_destroy(&sink);
 }
 
+/* zstd compresses every message of a stream against the previous ones, so a
+ * message repeating an earlier one costs almost nothing. */
+static void test_stream_compression_zstd_cross_message() {
+  const size_t message_size = 1024;
+  char* test_str = static_cast<char*>(gpr_malloc(message_size));
+  generate_random_payload(test_str, message_size);
+  grpc_slice_buffer source, relay, sink;
+  grpc_slice_buffer_init(&source);
+  grpc_slice_buffer_init(&relay);
+  grpc_slice_buffer_init(&sink);
+  grpc_stream_compression_context* compress_ctx =
+      grpc_stream_compression_context_create(
+          GRPC_STREAM_COMPRESSION_ZSTD_COMPRESS);
+  grpc_stream_compression_context* decompress_ctx =
+      grpc_stream_compression_context_create(
+          GRPC_STREAM_COMPRESSION_ZSTD_DECOMPRESS);
+  size_t first_size;
+  size_t second_size;
+  grpc_slice_buffer_add(&source, grpc_slice_from_static_string(test_str));
+  GPR_ASSERT(grpc_stream_compress(compress_ctx, &source, &relay, &first_size,
+                                  ~(size_t)0,
+                                  GRPC_STREAM_COMPRESSION_FLUSH_SYNC));
+  grpc_slice_buffer_add(&source, grpc_slice_from_static_string(test_str));
+  GPR_ASSERT(grpc_stream_compress(compress_ctx, &source, &relay, &second_size,
+                                  ~(size_t)0,
+                                  GRPC_STREAM_COMPRESSION_FLUSH_SYNC));
+  GPR_ASSERT(second_size * 10 < first_size);
+
+  bool end_of_context;
+  size_t output_size;
+  GPR_ASSERT(grpc_stream_decompress(decompress_ctx, &relay, &sink, &output_size,
+                                    ~(size_t)0, &end_of_context));
+  GPR_ASSERT(end_of_context == false);
+  GPR_ASSERT(output_size == 2 * (message_size - 1));
+  char* expected = static_cast<char*>(gpr_malloc(2 * message_size));
+  strcpy(expected, test_str);
+  strcat(expected, test_str);
+  GPR_ASSERT(slice_buffer_equals_string(&sink, expected));
+  gpr_free(expected);
+  grpc_stream_compression_context_destroy(compress_ctx);
+  grpc_stream_compression_context_destroy(decompress_ctx);
+
+  grpc_slice_buffer_destroy(&source);
+  grpc_slice_buffer_destroy(&relay);
+  grpc_slice_buffer_destroy(&sink);
+  gpr_free(test_str);
+}
+
+static void test_stream_compression_method(
+    grpc_stream_compression_method compress_method,
+    grpc_stream_compression_method decompress_method) {
+  test_stream_compression_simple_compress_decompress(compress_method,
+                                                     decompress_method);
+  test_stream_compression_simple_compress_decompress_with_output_size_constraint(
+      compress_method, decompress_method);
+  test_stream_compression_simple_compress_decompress_with_large_data(
+      compress_method, decompress_method);
+  test_stream_compression_sync_flush(compress_method, decompress_method);
+  test_stream_compression_drop_context(compress_method, decompress_method);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
-  test_stream_compression_simple_compress_decompress();
-  test_stream_compression_simple_compress_decompress_with_output_size_constraint();
-  test_stream_compression_simple_compress_decompress_with_large_data();
-  test_stream_compression_sync_flush();
-  test_stream_compression_drop_context();
+  test_stream_compression_method(GRPC_STREAM_COMPRESSION_GZIP_COMPRESS,
+                                 GRPC_STREAM_COMPRESSION_GZIP_DECOMPRESS);
+  test_stream_compression_method(GRPC_STREAM_COMPRESSION_ZSTD_COMPRESS,
+                                 GRPC_STREAM_COMPRESSION_ZSTD_DECOMPRESS);
+  test_stream_compression_zstd_cross_message();
   grpc_shutdown();
   return 0;
 }
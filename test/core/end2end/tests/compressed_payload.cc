@@ -21,6 +21,12 @@
 #include <stdio.h>
 #include <string.h>
 
+#ifndef GPR_WINDOWS
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 #include <grpc/byte_buffer.h>
 #include <grpc/byte_buffer_reader.h>
 #include <grpc/compression.h>
@@ -33,6 +39,7 @@
 #include "src/core/lib/compression/compression_args.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/call_test_only.h"
+#include "src/core/lib/transport/byte_stream.h"
 #include "src/core/lib/transport/static_metadata.h"
 #include "test/core/end2end/cq_verifier.h"
 
@@ -264,6 +271,198 @@ static void request_for_disabled_algorithm(
   config.tear_down_data(&f);
 }
 
+/* Returns the request payload, compressed by the application with \a
+ * precompression unless it is GRPC_COMPRESS_NONE. */
+static grpc_byte_buffer* create_request_payload(
+    grpc_slice* slice, grpc_compression_algorithm precompression) {
+  if (precompression == GRPC_COMPRESS_NONE) {
+    return grpc_raw_byte_buffer_create(slice, 1);
+  }
+  grpc_byte_buffer_compressor* compressor =
+      grpc_byte_buffer_compressor_create(
+          precompression, GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL, 0);
+  GPR_ASSERT(compressor != nullptr);
+  GPR_ASSERT(grpc_byte_buffer_compressor_write(compressor,
+                                               GRPC_SLICE_START_PTR(*slice),
+                                               GRPC_SLICE_LENGTH(*slice)));
+  grpc_byte_buffer* payload = grpc_byte_buffer_compressor_finish(compressor);
+  GPR_ASSERT(payload != nullptr);
+  return payload;
+}
+
+/* Sends \a request_payload with \a client_send_flags on a call to \a method,
+ * and has the server receive it, respond with \a response_payload (unless it
+ * is null) and end the call with an OK status. Each side sends
+ * \a client_init_metadata and \a server_init_metadata, when not null, as its
+ * initial metadata, and the server sets \a server_compression_level if
+ * \a set_server_level. Stores the messages received in
+ * \a request_payload_recv and \a response_payload_recv, and the calls in
+ * \a client_call and \a server_call for the caller to inspect and unref, or
+ * unrefs them if those are null. */
+static void exchange_messages(
+    grpc_end2end_test_fixture* f, const char* method,
+    grpc_metadata* client_init_metadata, grpc_metadata* server_init_metadata,
+    bool set_server_level, grpc_compression_level server_compression_level,
+    uint32_t client_send_flags, grpc_byte_buffer* request_payload,
+    grpc_byte_buffer* response_payload,
+    grpc_byte_buffer** request_payload_recv,
+    grpc_byte_buffer** response_payload_recv, grpc_call** client_call,
+    grpc_call** server_call) {
+  grpc_call* c;
+  grpc_call* s;
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_call_error error;
+  grpc_slice details;
+  int was_cancelled = 2;
+  cq_verifier* cqv = cq_verifier_create(f->cq);
+
+  *request_payload_recv = nullptr;
+  *response_payload_recv = nullptr;
+
+  gpr_timespec deadline = five_seconds_from_now();
+  c = grpc_channel_create_call(f->client, nullptr, GRPC_PROPAGATE_DEFAULTS,
+                               f->cq, grpc_slice_from_static_string(method),
+                               nullptr, deadline, nullptr);
+  GPR_ASSERT(c);
+
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv);
+  grpc_call_details_init(&call_details);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  if (client_init_metadata != nullptr) {
+    op->data.send_initial_metadata.count = 1;
+    op->data.send_initial_metadata.metadata = client_init_metadata;
+  } else {
+    op->data.send_initial_metadata.count = 0;
+  }
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = request_payload;
+  op->flags = client_send_flags;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = &initial_metadata_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = response_payload_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(c, ops, static_cast<size_t>(op - ops), tag(1),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  error =
+      grpc_server_request_call(f->server, &s, &call_details,
+                               &request_metadata_recv, f->cq, f->cq, tag(101));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(101), true);
+  cq_verify(cqv);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  if (server_init_metadata != nullptr) {
+    op->data.send_initial_metadata.count = 1;
+    op->data.send_initial_metadata.metadata = server_init_metadata;
+  } else {
+    op->data.send_initial_metadata.count = 0;
+  }
+  if (set_server_level) {
+    op->data.send_initial_metadata.maybe_compression_level.is_set = true;
+    op->data.send_initial_metadata.maybe_compression_level.level =
+        server_compression_level;
+  }
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = request_payload_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  if (response_payload != nullptr) {
+    op->op = GRPC_OP_SEND_MESSAGE;
+    op->data.send_message.send_message = response_payload;
+    op->flags = 0;
+    op->reserved = nullptr;
+    op++;
+  }
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_OK;
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+  op->data.send_status_from_server.status_details = &status_details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops), tag(102),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  CQ_EXPECT_COMPLETION(cqv, tag(102), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(1), true);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_OK);
+  GPR_ASSERT(0 == grpc_slice_str_cmp(details, "xyz"));
+  GPR_ASSERT(0 == grpc_slice_str_cmp(call_details.method, method));
+  GPR_ASSERT(was_cancelled == 0);
+  GPR_ASSERT(*request_payload_recv != nullptr);
+  GPR_ASSERT((*response_payload_recv != nullptr) ==
+             (response_payload != nullptr));
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+
+  if (client_call != nullptr) {
+    *client_call = c;
+  } else {
+    grpc_call_unref(c);
+  }
+  if (server_call != nullptr) {
+    *server_call = s;
+  } else {
+    grpc_call_unref(s);
+  }
+
+  cq_verifier_destroy(cqv);
+}
+
 static void request_with_payload_template(
     grpc_end2end_test_config config, const char* test_name,
     uint32_t client_send_flags_bitmask,
@@ -273,7 +472,8 @@ static void request_with_payload_template(
     grpc_compression_algorithm expected_algorithm_from_server,
     grpc_metadata* client_init_metadata, bool set_server_level,
     grpc_compression_level server_compression_level,
-    bool send_message_before_initial_metadata) {
+    bool send_message_before_initial_metadata,
+    grpc_compression_algorithm request_precompression) {
   grpc_call* c;
   grpc_call* s;
   grpc_slice request_payload_slice;
@@ -328,7 +528,8 @@ static void request_with_payload_template(
   grpc_call_details_init(&call_details);
 
   if (send_message_before_initial_metadata) {
-    request_payload = grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+    request_payload =
+        create_request_payload(&request_payload_slice, request_precompression);
     memset(ops, 0, sizeof(ops));
     op = ops;
     op->op = GRPC_OP_SEND_MESSAGE;
@@ -411,7 +612,8 @@ static void request_with_payload_template(
     response_payload = grpc_raw_byte_buffer_create(&response_payload_slice, 1);
 
     if (i > 0 || !send_message_before_initial_metadata) {
-      request_payload = grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+      request_payload = create_request_payload(&request_payload_slice,
+                                               request_precompression);
       memset(ops, 0, sizeof(ops));
       op = ops;
       op->op = GRPC_OP_SEND_MESSAGE;
@@ -553,7 +755,7 @@ static void test_invoke_request_with_exceptionally_uncompressed_payload(
       config, "test_invoke_request_with_exceptionally_uncompressed_payload",
       GRPC_WRITE_NO_COMPRESS, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, nullptr, false,
-      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false);
+      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false, GRPC_COMPRESS_NONE);
 }
 
 static void test_invoke_request_with_uncompressed_payload(
@@ -562,7 +764,7 @@ static void test_invoke_request_with_uncompressed_payload(
       config, "test_invoke_request_with_uncompressed_payload", 0,
       GRPC_COMPRESS_NONE, GRPC_COMPRESS_NONE, GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_NONE, nullptr, false,
-      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false);
+      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false, GRPC_COMPRESS_NONE);
 }
 
 static void test_invoke_request_with_compressed_payload(
@@ -571,7 +773,7 @@ static void test_invoke_request_with_compressed_payload(
       config, "test_invoke_request_with_compressed_payload", 0,
       GRPC_COMPRESS_GZIP, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_GZIP, nullptr, false,
-      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false);
+      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false, GRPC_COMPRESS_NONE);
 }
 
 static void test_invoke_request_with_send_message_before_initial_metadata(
@@ -580,7 +782,7 @@ static void test_invoke_request_with_send_message_before_initial_metadata(
       config, "test_invoke_request_with_compressed_payload", 0,
       GRPC_COMPRESS_GZIP, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_GZIP, nullptr, false,
-      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, true);
+      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, true, GRPC_COMPRESS_NONE);
 }
 
 static void test_invoke_request_with_server_level(
@@ -588,7 +790,7 @@ static void test_invoke_request_with_server_level(
   request_with_payload_template(
       config, "test_invoke_request_with_server_level", 0, GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_NONE, GRPC_COMPRESS_NONE, GRPC_COMPRESS_NONE /* ignored */,
-      nullptr, true, GRPC_COMPRESS_LEVEL_HIGH, false);
+      nullptr, true, GRPC_COMPRESS_LEVEL_HIGH, false, GRPC_COMPRESS_NONE);
 }
 
 static void test_invoke_request_with_compressed_payload_md_override(
@@ -612,22 +814,1153 @@ static void test_invoke_request_with_compressed_payload_md_override(
       config, "test_invoke_request_with_compressed_payload_md_override_1", 0,
       GRPC_COMPRESS_NONE, GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_NONE, &gzip_compression_override, false,
-      /*ignored*/ GRPC_COMPRESS_LEVEL_NONE, false);
+      /*ignored*/ GRPC_COMPRESS_LEVEL_NONE, false, GRPC_COMPRESS_NONE);
 
   /* Channel default DEFLATE, call override to GZIP */
   request_with_payload_template(
       config, "test_invoke_request_with_compressed_payload_md_override_2", 0,
       GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP,
       GRPC_COMPRESS_NONE, &gzip_compression_override, false,
-      /*ignored*/ GRPC_COMPRESS_LEVEL_NONE, false);
+      /*ignored*/ GRPC_COMPRESS_LEVEL_NONE, false, GRPC_COMPRESS_NONE);
 
   /* Channel default DEFLATE, call override to NONE (aka IDENTITY) */
   request_with_payload_template(
       config, "test_invoke_request_with_compressed_payload_md_override_3", 0,
       GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_NONE, GRPC_COMPRESS_NONE,
       GRPC_COMPRESS_NONE, &identity_compression_override, false,
-      /*ignored*/ GRPC_COMPRESS_LEVEL_NONE, false);
+      /*ignored*/ GRPC_COMPRESS_LEVEL_NONE, false, GRPC_COMPRESS_NONE);
+}
+
+static void test_invoke_request_with_precompressed_payload(
+    grpc_end2end_test_config config) {
+  /* sent as compressed by the application */
+  request_with_payload_template(
+      config, "test_invoke_request_with_precompressed_payload", 0,
+      GRPC_COMPRESS_GZIP, GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP,
+      GRPC_COMPRESS_NONE, nullptr, false,
+      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false, GRPC_COMPRESS_GZIP);
+  /* decompressed and compressed again with the call's algorithm */
+  request_with_payload_template(
+      config, "test_invoke_request_with_mismatched_precompressed_payload", 0,
+      GRPC_COMPRESS_GZIP, GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP,
+      GRPC_COMPRESS_NONE, nullptr, false,
+      /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false, GRPC_COMPRESS_DEFLATE);
+}
+
+/* A server in pass-through mode sends a response compressed by the application
+ * with the algorithm it was compressed with, and a client in pass-through mode
+ * receives it still compressed. */
+static void test_invoke_request_with_passthrough(
+    grpc_end2end_test_config config) {
+  grpc_call* c;
+  grpc_call* s;
+  grpc_slice response_payload_slice;
+  grpc_byte_buffer* response_payload;
+  grpc_byte_buffer* response_payload_recv = nullptr;
+  grpc_channel_args* client_args;
+  grpc_channel_args* server_args;
+  grpc_end2end_test_fixture f;
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_call_error error;
+  grpc_slice details;
+  int was_cancelled = 2;
+  cq_verifier* cqv;
+  char str[1024];
+
+  memset(str, 'x', 1023);
+  str[1023] = '\0';
+  response_payload_slice = grpc_slice_from_copied_string(str);
+  response_payload =
+      create_request_payload(&response_payload_slice, GRPC_COMPRESS_GZIP);
+
+  grpc_arg passthrough_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_COMPRESSION_CHANNEL_PASSTHROUGH), 1);
+  client_args = grpc_channel_args_copy_and_add(nullptr, &passthrough_arg, 1);
+  server_args = grpc_channel_args_copy_and_add(nullptr, &passthrough_arg, 1);
+
+  f = begin_test(config, "test_invoke_request_with_passthrough", client_args,
+                 server_args);
+  cqv = cq_verifier_create(f.cq);
+
+  gpr_timespec deadline = five_seconds_from_now();
+  c = grpc_channel_create_call(f.client, nullptr, GRPC_PROPAGATE_DEFAULTS, f.cq,
+                               grpc_slice_from_static_string("/foo"), nullptr,
+                               deadline, nullptr);
+  GPR_ASSERT(c);
+
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv);
+  grpc_call_details_init(&call_details);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = &initial_metadata_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = &response_payload_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(c, ops, static_cast<size_t>(op - ops), tag(1),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  error =
+      grpc_server_request_call(f.server, &s, &call_details,
+                               &request_metadata_recv, f.cq, f.cq, tag(101));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(101), true);
+  cq_verify(cqv);
+
+  /* The response is sent along with the initial metadata, so the call adopts
+   * its algorithm. */
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = response_payload;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_OK;
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+  op->data.send_status_from_server.status_details = &status_details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops), tag(102),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  CQ_EXPECT_COMPLETION(cqv, tag(102), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(1), true);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_OK);
+  GPR_ASSERT(was_cancelled == 0);
+  GPR_ASSERT(response_payload_recv != nullptr);
+  GPR_ASSERT(response_payload_recv->data.raw.compression ==
+             GRPC_COMPRESS_GZIP);
+  GPR_ASSERT(byte_buffer_eq_string(response_payload_recv, str));
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+
+  cq_verifier_destroy(cqv);
+
+  grpc_slice_unref(response_payload_slice);
+  grpc_byte_buffer_destroy(response_payload);
+  grpc_byte_buffer_destroy(response_payload_recv);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_channel_args_destroy(client_args);
+    grpc_channel_args_destroy(server_args);
+  }
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+/* Receives a message that decompresses to more than the client's limit. The
+ * application's reader enforces the limit, unless the message is large
+ * enough to be decompressed on the executor, which fails the call instead. */
+static void request_with_decompressed_length_limit(
+    grpc_end2end_test_config config, const char* test_name, bool offload) {
+  grpc_call* c;
+  grpc_call* s;
+  grpc_slice response_payload_slice;
+  grpc_byte_buffer* response_payload;
+  grpc_byte_buffer* response_payload_recv = nullptr;
+  grpc_channel_args* client_args;
+  grpc_channel_args* server_args;
+  grpc_end2end_test_fixture f;
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_call_error error;
+  grpc_slice details;
+  int was_cancelled = 2;
+  cq_verifier* cqv;
+  char str[1024];
+
+  /* compresses to much less than the client's limit */
+  memset(str, 'x', 1023);
+  str[1023] = '\0';
+  response_payload_slice = grpc_slice_from_copied_string(str);
+  response_payload = grpc_raw_byte_buffer_create(&response_payload_slice, 1);
+
+  grpc_arg client_arg_array[] = {
+      grpc_channel_arg_integer_create(
+          const_cast<char*>(GRPC_ARG_MAX_RECEIVE_DECOMPRESSED_MESSAGE_LENGTH),
+          100),
+      grpc_channel_arg_integer_create(
+          const_cast<char*>(GRPC_COMPRESSION_CHANNEL_OFFLOAD_MIN_MESSAGE_SIZE),
+          1)};
+  client_args = grpc_channel_args_copy_and_add(nullptr, client_arg_array,
+                                               offload ? 2 : 1);
+  server_args = grpc_channel_args_set_channel_default_compression_algorithm(
+      nullptr, GRPC_COMPRESS_GZIP);
+
+  f = begin_test(config, test_name, client_args, server_args);
+  cqv = cq_verifier_create(f.cq);
+
+  gpr_timespec deadline = five_seconds_from_now();
+  c = grpc_channel_create_call(f.client, nullptr, GRPC_PROPAGATE_DEFAULTS, f.cq,
+                               grpc_slice_from_static_string("/foo"), nullptr,
+                               deadline, nullptr);
+  GPR_ASSERT(c);
+
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv);
+  grpc_call_details_init(&call_details);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = &initial_metadata_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = &response_payload_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(c, ops, static_cast<size_t>(op - ops), tag(1),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  error =
+      grpc_server_request_call(f.server, &s, &call_details,
+                               &request_metadata_recv, f.cq, f.cq, tag(101));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(101), true);
+  cq_verify(cqv);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = response_payload;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_OK;
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+  op->data.send_status_from_server.status_details = &status_details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops), tag(102),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  CQ_EXPECT_COMPLETION(cqv, tag(102), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(1), true);
+  cq_verify(cqv);
+
+  if (offload) {
+    /* the message was dropped, and the call failed */
+    GPR_ASSERT(status == GRPC_STATUS_RESOURCE_EXHAUSTED);
+    GPR_ASSERT(grpc_slice_str_cmp(details,
+                                  "Received message larger than max once "
+                                  "decompressed (100)") == 0);
+    GPR_ASSERT(response_payload_recv == nullptr);
+  } else {
+    /* the message arrived compressed, and reading it stops at the limit */
+    GPR_ASSERT(status == GRPC_STATUS_OK);
+    GPR_ASSERT(response_payload_recv != nullptr);
+    GPR_ASSERT(response_payload_recv->data.raw.compression ==
+               GRPC_COMPRESS_GZIP);
+    GPR_ASSERT(response_payload_recv->data.raw.max_decompressed_length == 100);
+    grpc_byte_buffer_reader reader;
+    grpc_slice* slice;
+    GPR_ASSERT(grpc_byte_buffer_reader_init(&reader, response_payload_recv));
+    GPR_ASSERT(!grpc_byte_buffer_reader_peek(&reader, &slice));
+    GPR_ASSERT(grpc_byte_buffer_reader_failed(&reader));
+    GPR_ASSERT(grpc_byte_buffer_reader_exceeded_limit(&reader));
+    grpc_byte_buffer_reader_destroy(&reader);
+    grpc_byte_buffer_destroy(response_payload_recv);
+  }
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+
+  cq_verifier_destroy(cqv);
+
+  grpc_slice_unref(response_payload_slice);
+  grpc_byte_buffer_destroy(response_payload);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_channel_args_destroy(client_args);
+    grpc_channel_args_destroy(server_args);
+  }
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+static void test_invoke_request_with_decompressed_length_limit(
+    grpc_end2end_test_config config) {
+  request_with_decompressed_length_limit(
+      config, "test_invoke_request_with_decompressed_length_limit", false);
+}
+
+static void test_invoke_request_with_offloaded_decompressed_length_limit(
+    grpc_end2end_test_config config) {
+  request_with_decompressed_length_limit(
+      config, "test_invoke_request_with_offloaded_decompressed_length_limit",
+      true);
+}
+
+/* Returns channel args compressing messages with gzip by default, on the
+ * executor for messages of at least a byte. */
+static grpc_channel_args* offloading_channel_args(void) {
+  grpc_channel_args* default_args =
+      grpc_channel_args_set_channel_default_compression_algorithm(
+          nullptr, GRPC_COMPRESS_GZIP);
+  grpc_arg offload_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_COMPRESSION_CHANNEL_OFFLOAD_MIN_MESSAGE_SIZE), 1);
+  grpc_channel_args* args =
+      grpc_channel_args_copy_and_add(default_args, &offload_arg, 1);
+  grpc_channel_args_destroy(default_args);
+  return args;
+}
+
+/* Exchanges a request and a response that both sides compress, and
+ * decompress, on the executor. A corrupt response, sent as compressed by the
+ * server's application, is left compressed for the client's reader to reject,
+ * as when it is not offloaded. */
+static void request_with_offloaded_compression(grpc_end2end_test_config config,
+                                               const char* test_name,
+                                               bool corrupt_response) {
+  grpc_call* c;
+  grpc_call* s;
+  grpc_byte_buffer* request_payload;
+  grpc_byte_buffer* request_payload_recv;
+  grpc_byte_buffer* response_payload;
+  grpc_byte_buffer* response_payload_recv;
+  grpc_channel_args* client_args;
+  grpc_channel_args* server_args;
+  grpc_end2end_test_fixture f;
+  char request_str[1024];
+  char response_str[1024];
+
+  memset(request_str, 'x', 1023);
+  request_str[1023] = '\0';
+  memset(response_str, 'y', 1023);
+  response_str[1023] = '\0';
+  grpc_slice request_payload_slice = grpc_slice_from_copied_string(request_str);
+  grpc_slice response_payload_slice =
+      grpc_slice_from_copied_string(response_str);
+  request_payload = grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+  if (corrupt_response) {
+    /* not a gzip stream */
+    response_payload = grpc_raw_compressed_byte_buffer_create(
+        &response_payload_slice, 1, GRPC_COMPRESS_GZIP);
+  } else {
+    response_payload = grpc_raw_byte_buffer_create(&response_payload_slice, 1);
+  }
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    client_args = offloading_channel_args();
+    server_args = offloading_channel_args();
+  }
+
+  f = begin_test(config, test_name, client_args, server_args);
+  exchange_messages(&f, "/foo", nullptr, nullptr, false,
+                    /* ignored */ GRPC_COMPRESS_LEVEL_NONE, 0, request_payload,
+                    response_payload, &request_payload_recv,
+                    &response_payload_recv, &c, &s);
+
+  /* compressed on the wire, and handed over decompressed */
+  GPR_ASSERT(grpc_call_test_only_get_message_flags(s) &
+             GRPC_WRITE_INTERNAL_COMPRESS);
+  GPR_ASSERT(request_payload_recv->data.raw.compression == GRPC_COMPRESS_NONE);
+  GPR_ASSERT(byte_buffer_eq_string(request_payload_recv, request_str));
+  GPR_ASSERT(grpc_call_test_only_get_message_flags(c) &
+             GRPC_WRITE_INTERNAL_COMPRESS);
+  if (corrupt_response) {
+    GPR_ASSERT(response_payload_recv->data.raw.compression ==
+               GRPC_COMPRESS_GZIP);
+    grpc_byte_buffer_reader reader;
+    GPR_ASSERT(!grpc_byte_buffer_reader_init(&reader, response_payload_recv));
+  } else {
+    GPR_ASSERT(response_payload_recv->data.raw.compression ==
+               GRPC_COMPRESS_NONE);
+    GPR_ASSERT(byte_buffer_eq_string(response_payload_recv, response_str));
+  }
+
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+
+  grpc_slice_unref(request_payload_slice);
+  grpc_slice_unref(response_payload_slice);
+  grpc_byte_buffer_destroy(request_payload);
+  grpc_byte_buffer_destroy(request_payload_recv);
+  grpc_byte_buffer_destroy(response_payload);
+  grpc_byte_buffer_destroy(response_payload_recv);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_channel_args_destroy(client_args);
+    grpc_channel_args_destroy(server_args);
+  }
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+static void test_invoke_request_with_offloaded_compression(
+    grpc_end2end_test_config config) {
+  request_with_offloaded_compression(
+      config, "test_invoke_request_with_offloaded_compression", false);
+}
+
+static void test_invoke_request_with_offloaded_corrupt_payload(
+    grpc_end2end_test_config config) {
+  request_with_offloaded_compression(
+      config, "test_invoke_request_with_offloaded_corrupt_payload", true);
+}
+
+/* Cancels a call while the message it sends may still be compressed on the
+ * executor. */
+static void test_invoke_request_cancelled_during_offloaded_compression(
+    grpc_end2end_test_config config) {
+  grpc_call* c;
+  grpc_byte_buffer* request_payload;
+  grpc_byte_buffer* response_payload_recv = nullptr;
+  grpc_channel_args* client_args;
+  grpc_channel_args* server_args;
+  grpc_end2end_test_fixture f;
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_status_code status;
+  grpc_call_error error;
+  grpc_slice details;
+  cq_verifier* cqv;
+
+  /* large enough to be compressing when the call is cancelled */
+  const size_t length = 4 * 1024 * 1024;
+  grpc_slice request_payload_slice = grpc_slice_malloc(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(request_payload_slice);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = static_cast<uint8_t>('a' + (i * 7919 + i / 13) % 4);
+  }
+  request_payload = grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    client_args = offloading_channel_args();
+    server_args = offloading_channel_args();
+  }
+
+  f = begin_test(config,
+                 "test_invoke_request_cancelled_during_offloaded_compression",
+                 client_args, server_args);
+  cqv = cq_verifier_create(f.cq);
+
+  gpr_timespec deadline = five_seconds_from_now();
+  c = grpc_channel_create_call(f.client, nullptr, GRPC_PROPAGATE_DEFAULTS, f.cq,
+                               grpc_slice_from_static_string("/foo"), nullptr,
+                               deadline, nullptr);
+  GPR_ASSERT(c);
+
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = request_payload;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = &initial_metadata_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = &response_payload_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(c, ops, static_cast<size_t>(op - ops), tag(1),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  GPR_ASSERT(GRPC_CALL_OK == grpc_call_cancel(c, nullptr));
+
+  CQ_EXPECT_COMPLETION(cqv, tag(1), true);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_CANCELLED);
+  GPR_ASSERT(response_payload_recv == nullptr);
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+
+  grpc_call_unref(c);
+
+  cq_verifier_destroy(cqv);
+
+  grpc_slice_unref(request_payload_slice);
+  grpc_byte_buffer_destroy(request_payload);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_channel_args_destroy(client_args);
+    grpc_channel_args_destroy(server_args);
+  }
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+/* Both channels compress with gzip by default, except to local peers (such
+ * as the ones of the unix socket and loopback fixtures), to which messages
+ * are sent uncompressed unless the call asks for an algorithm explicitly (or
+ * the method's compressionPolicy does). Either way, both sides keep
+ * advertising the algorithms they accept. */
+static void request_with_local_bypass(grpc_end2end_test_config config,
+                                      const char* test_name,
+                                      bool request_algorithms) {
+  grpc_call* c;
+  grpc_call* s;
+  grpc_byte_buffer* request_payload;
+  grpc_byte_buffer* request_payload_recv;
+  grpc_byte_buffer* response_payload;
+  grpc_byte_buffer* response_payload_recv;
+  grpc_channel_args* client_args;
+  grpc_channel_args* server_args;
+  grpc_end2end_test_fixture f;
+  char request_str[1024];
+  char response_str[1024];
+  grpc_metadata gzip_compression_override;
+  const bool local_peer =
+      !(config.feature_mask & FEATURE_MASK_DOES_NOT_SUPPORT_LOCAL_PEER);
+
+  gzip_compression_override.key = GRPC_MDSTR_GRPC_INTERNAL_ENCODING_REQUEST;
+  gzip_compression_override.value = grpc_slice_from_static_string("gzip");
+  memset(&gzip_compression_override.internal_data, 0,
+         sizeof(gzip_compression_override.internal_data));
+
+  memset(request_str, 'x', 1023);
+  request_str[1023] = '\0';
+  memset(response_str, 'y', 1023);
+  response_str[1023] = '\0';
+  grpc_slice request_payload_slice = grpc_slice_from_copied_string(request_str);
+  grpc_slice response_payload_slice =
+      grpc_slice_from_copied_string(response_str);
+  request_payload = grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+  response_payload = grpc_raw_byte_buffer_create(&response_payload_slice, 1);
+
+  grpc_arg bypass_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_COMPRESSION_CHANNEL_BYPASS_LOCAL), 1);
+  grpc_channel_args* default_args =
+      grpc_channel_args_set_channel_default_compression_algorithm(
+          nullptr, GRPC_COMPRESS_GZIP);
+  client_args = grpc_channel_args_copy_and_add(default_args, &bypass_arg, 1);
+  server_args = grpc_channel_args_copy_and_add(default_args, &bypass_arg, 1);
+
+  f = begin_test(config, test_name, client_args, server_args);
+  exchange_messages(
+      &f, "/foo", request_algorithms ? &gzip_compression_override : nullptr,
+      nullptr, request_algorithms, GRPC_COMPRESS_LEVEL_HIGH, 0,
+      request_payload, response_payload, &request_payload_recv,
+      &response_payload_recv, &c, &s);
+
+  /* both sides still advertise what they accept */
+  GPR_ASSERT(GPR_BITGET(grpc_call_test_only_get_encodings_accepted_by_peer(s),
+                        GRPC_COMPRESS_GZIP) != 0);
+  GPR_ASSERT(GPR_BITGET(grpc_call_test_only_get_encodings_accepted_by_peer(c),
+                        GRPC_COMPRESS_GZIP) != 0);
+
+  GPR_ASSERT(byte_buffer_eq_string(request_payload_recv, request_str));
+  if (request_algorithms || !local_peer) {
+    GPR_ASSERT(request_payload_recv->data.raw.compression ==
+               GRPC_COMPRESS_GZIP);
+  } else {
+    GPR_ASSERT(request_payload_recv->data.raw.compression ==
+               GRPC_COMPRESS_NONE);
+  }
+  GPR_ASSERT(byte_buffer_eq_string(response_payload_recv, response_str));
+  if (request_algorithms || !local_peer) {
+    GPR_ASSERT(response_payload_recv->data.raw.compression !=
+               GRPC_COMPRESS_NONE);
+  } else {
+    GPR_ASSERT(response_payload_recv->data.raw.compression ==
+               GRPC_COMPRESS_NONE);
+  }
+
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+
+  grpc_slice_unref(request_payload_slice);
+  grpc_slice_unref(response_payload_slice);
+  grpc_byte_buffer_destroy(request_payload);
+  grpc_byte_buffer_destroy(request_payload_recv);
+  grpc_byte_buffer_destroy(response_payload);
+  grpc_byte_buffer_destroy(response_payload_recv);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_channel_args_destroy(default_args);
+    grpc_channel_args_destroy(client_args);
+    grpc_channel_args_destroy(server_args);
+  }
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+static void test_invoke_request_with_local_bypass(
+    grpc_end2end_test_config config) {
+  request_with_local_bypass(config, "test_invoke_request_with_local_bypass",
+                            false);
+}
+
+static void test_invoke_request_with_local_bypass_and_requested_algorithms(
+    grpc_end2end_test_config config) {
+  request_with_local_bypass(
+      config, "test_invoke_request_with_local_bypass_and_requested_algorithms",
+      true);
+}
+
+/* A response compressed by the application with a larger zstd window than
+ * the channels allow is compressed again within the cap before it is sent, so
+ * the client can still read it. */
+static void test_invoke_request_with_precompressed_payload_over_window_cap(
+    grpc_end2end_test_config config) {
+  grpc_call* c;
+  grpc_call* s;
+  grpc_byte_buffer* response_payload;
+  grpc_byte_buffer* response_payload_recv = nullptr;
+  grpc_channel_args* client_args;
+  grpc_channel_args* server_args;
+  grpc_end2end_test_fixture f;
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_call_error error;
+  grpc_slice details;
+  int was_cancelled = 2;
+  cq_verifier* cqv;
+
+  /* streamed without a cap, the frame's window is the level's default, far
+   * larger than 2^17 bytes */
+  const size_t length = 1024 * 1024;
+  grpc_slice response_payload_slice = grpc_slice_malloc(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(response_payload_slice);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = static_cast<uint8_t>('a' + (i * 7919 + i / 13) % 4);
+  }
+  response_payload =
+      create_request_payload(&response_payload_slice, GRPC_COMPRESS_ZSTD);
+
+  grpc_arg window_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_COMPRESSION_CHANNEL_ZSTD_WINDOW_LOG_MAX), 17);
+  client_args = grpc_channel_args_copy_and_add(nullptr, &window_arg, 1);
+  grpc_channel_args* server_default_args =
+      grpc_channel_args_set_channel_default_compression_algorithm(
+          nullptr, GRPC_COMPRESS_ZSTD);
+  server_args =
+      grpc_channel_args_copy_and_add(server_default_args, &window_arg, 1);
+
+  f = begin_test(config,
+                 "test_invoke_request_with_precompressed_payload_over_window_"
+                 "cap",
+                 client_args, server_args);
+  cqv = cq_verifier_create(f.cq);
+
+  gpr_timespec deadline = five_seconds_from_now();
+  c = grpc_channel_create_call(f.client, nullptr, GRPC_PROPAGATE_DEFAULTS, f.cq,
+                               grpc_slice_from_static_string("/foo"), nullptr,
+                               deadline, nullptr);
+  GPR_ASSERT(c);
+
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv);
+  grpc_call_details_init(&call_details);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = &initial_metadata_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = &response_payload_recv;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(c, ops, static_cast<size_t>(op - ops), tag(1),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  error =
+      grpc_server_request_call(f.server, &s, &call_details,
+                               &request_metadata_recv, f.cq, f.cq, tag(101));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(101), true);
+  cq_verify(cqv);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = response_payload;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_OK;
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+  op->data.send_status_from_server.status_details = &status_details;
+  op->flags = 0;
+  op->reserved = nullptr;
+  op++;
+  error = grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops), tag(102),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  CQ_EXPECT_COMPLETION(cqv, tag(102), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(1), true);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_OK);
+  GPR_ASSERT(response_payload_recv != nullptr);
+  GPR_ASSERT(response_payload_recv->data.raw.compression ==
+             GRPC_COMPRESS_ZSTD);
+  GPR_ASSERT(response_payload_recv->data.raw.zstd_window_log_max == 17);
+  GPR_ASSERT(byte_buffer_eq_slice(response_payload_recv,
+                                  response_payload_slice));
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+
+  cq_verifier_destroy(cqv);
+
+  grpc_slice_unref(response_payload_slice);
+  grpc_byte_buffer_destroy(response_payload);
+  grpc_byte_buffer_destroy(response_payload_recv);
+
+  {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_channel_args_destroy(client_args);
+    grpc_channel_args_destroy(server_default_args);
+    grpc_channel_args_destroy(server_args);
+  }
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+/* Service config setting the compression policy of two methods, each in one
+ * direction. */
+static const char* kCompressionPolicyServiceConfig =
+    "{\n"
+    "  \"methodConfig\": [ {\n"
+    "    \"name\": [ { \"service\": \"pkg.Service\", \"method\": \"Gzip\" } ],\n"
+    "    \"compressionPolicy\": {\n"
+    "      \"algorithm\": \"gzip\",\n"
+    "      \"minMessageBytes\": 100,\n"
+    "      \"direction\": \"REQUEST\"\n"
+    "    }\n"
+    "  }, {\n"
+    "    \"name\": [ { \"service\": \"pkg.Service\", \"method\": \"Zstd\" } ],\n"
+    "    \"compressionPolicy\": {\n"
+    "      \"algorithm\": \"zstd\",\n"
+    "      \"level\": 19,\n"
+    "      \"direction\": \"RESPONSE\"\n"
+    "    }\n"
+    "  } ]\n"
+    "}";
+
+/* Exchanges a request of \a request_length bytes and a response on \a method
+ * of kCompressionPolicyServiceConfig, which both channels use, and checks the
+ * algorithms that each message arrives compressed with. Either side may
+ * request an algorithm explicitly with \a client_override and
+ * \a server_override. */
+static void request_with_compression_policy(
+    grpc_end2end_test_config config, const char* test_name, const char* method,
+    size_t request_length, grpc_metadata* client_override,
+    grpc_metadata* server_override,
+    grpc_compression_algorithm expected_algorithm_from_client,
+    grpc_compression_algorithm expected_algorithm_from_server) {
+  grpc_byte_buffer* request_payload;
+  grpc_byte_buffer* request_payload_recv;
+  grpc_byte_buffer* response_payload;
+  grpc_byte_buffer* response_payload_recv;
+  grpc_end2end_test_fixture f;
+  char request_str[1024];
+  char response_str[1024];
+
+  GPR_ASSERT(request_length < sizeof(request_str));
+  memset(request_str, 'x', request_length);
+  request_str[request_length] = '\0';
+  memset(response_str, 'y', 1023);
+  response_str[1023] = '\0';
+  grpc_slice request_payload_slice = grpc_slice_from_copied_string(request_str);
+  grpc_slice response_payload_slice =
+      grpc_slice_from_copied_string(response_str);
+  request_payload = grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+  response_payload = grpc_raw_byte_buffer_create(&response_payload_slice, 1);
+
+  grpc_arg arg;
+  arg.type = GRPC_ARG_STRING;
+  arg.key = const_cast<char*>(GRPC_ARG_SERVICE_CONFIG);
+  arg.value.string = const_cast<char*>(kCompressionPolicyServiceConfig);
+  grpc_channel_args args = {1, &arg};
+
+  f = begin_test(config, test_name, &args, &args);
+  exchange_messages(&f, method, client_override, server_override, false,
+                    /* ignored */ GRPC_COMPRESS_LEVEL_NONE, 0, request_payload,
+                    response_payload, &request_payload_recv,
+                    &response_payload_recv, nullptr, nullptr);
+
+  GPR_ASSERT(byte_buffer_eq_string(request_payload_recv, request_str));
+  GPR_ASSERT(request_payload_recv->data.raw.compression ==
+             expected_algorithm_from_client);
+  GPR_ASSERT(byte_buffer_eq_string(response_payload_recv, response_str));
+  GPR_ASSERT(response_payload_recv->data.raw.compression ==
+             expected_algorithm_from_server);
+
+  grpc_slice_unref(request_payload_slice);
+  grpc_slice_unref(response_payload_slice);
+  grpc_byte_buffer_destroy(request_payload);
+  grpc_byte_buffer_destroy(request_payload_recv);
+  grpc_byte_buffer_destroy(response_payload);
+  grpc_byte_buffer_destroy(response_payload_recv);
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+static void test_invoke_request_with_compression_policy(
+    grpc_end2end_test_config config) {
+  grpc_metadata deflate_compression_override;
+  deflate_compression_override.key = GRPC_MDSTR_GRPC_INTERNAL_ENCODING_REQUEST;
+  deflate_compression_override.value = grpc_slice_from_static_string("deflate");
+  memset(&deflate_compression_override.internal_data, 0,
+         sizeof(deflate_compression_override.internal_data));
+
+  /* requests compressed with gzip, responses left alone */
+  request_with_compression_policy(
+      config, "test_invoke_request_with_compression_policy_request",
+      "/pkg.Service/Gzip", 1023, nullptr, nullptr, GRPC_COMPRESS_GZIP,
+      GRPC_COMPRESS_NONE);
+  /* requests below minMessageBytes left alone */
+  request_with_compression_policy(
+      config, "test_invoke_request_with_compression_policy_small_request",
+      "/pkg.Service/Gzip", 10, nullptr, nullptr, GRPC_COMPRESS_NONE,
+      GRPC_COMPRESS_NONE);
+  /* responses compressed with zstd at level 19, requests left alone */
+  request_with_compression_policy(
+      config, "test_invoke_request_with_compression_policy_response",
+      "/pkg.Service/Zstd", 1023, nullptr, nullptr, GRPC_COMPRESS_NONE,
+      GRPC_COMPRESS_ZSTD);
+  /* methods without a policy keep the channels' default */
+  request_with_compression_policy(
+      config, "test_invoke_request_with_compression_policy_other_method",
+      "/pkg.Service/Other", 1023, nullptr, nullptr, GRPC_COMPRESS_NONE,
+      GRPC_COMPRESS_NONE);
+  /* algorithms requested for the call take precedence, on either side */
+  request_with_compression_policy(
+      config, "test_invoke_request_with_compression_policy_override",
+      "/pkg.Service/Gzip", 1023, &deflate_compression_override,
+      &deflate_compression_override, GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_DEFLATE);
+  request_with_compression_policy(
+      config, "test_invoke_request_with_compression_policy_override_response",
+      "/pkg.Service/Zstd", 1023, nullptr, &deflate_compression_override,
+      GRPC_COMPRESS_NONE, GRPC_COMPRESS_DEFLATE);
+}
+
+#ifndef GPR_WINDOWS
+/* Sends \a str on \a method with \a flags, and has the server receive it and
+ * end the call. */
+static void send_request_on_method(grpc_end2end_test_fixture* f,
+                                   const char* method, uint32_t flags,
+                                   const char* str) {
+  grpc_byte_buffer* request_payload;
+  grpc_byte_buffer* request_payload_recv;
+  grpc_byte_buffer* response_payload_recv;
+
+  grpc_slice request_payload_slice = grpc_slice_from_copied_string(str);
+  request_payload = grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+
+  exchange_messages(f, method, nullptr, nullptr, false,
+                    /* ignored */ GRPC_COMPRESS_LEVEL_NONE, flags,
+                    request_payload, nullptr, &request_payload_recv,
+                    &response_payload_recv, nullptr, nullptr);
+  GPR_ASSERT(byte_buffer_eq_string(request_payload_recv, str));
+
+  grpc_slice_unref(request_payload_slice);
+  grpc_byte_buffer_destroy(request_payload);
+  grpc_byte_buffer_destroy(request_payload_recv);
+}
+
+/* Returns how many message samples of \a method are in \a dir, storing the
+ * contents of the last one in \a contents (of \a size bytes) if not null. */
+static size_t count_message_samples(const char* dir, const char* method,
+                                    char* contents, size_t size) {
+  const size_t method_length = strlen(method);
+  size_t count = 0;
+  DIR* d = opendir(dir);
+  GPR_ASSERT(d != nullptr);
+  struct dirent* entry;
+  while ((entry = readdir(d)) != nullptr) {
+    if (strncmp(entry->d_name, method, method_length) != 0 ||
+        entry->d_name[method_length] != '.') {
+      continue;
+    }
+    count++;
+    if (contents != nullptr) {
+      char* path;
+      gpr_asprintf(&path, "%s/%s", dir, entry->d_name);
+      FILE* file = fopen(path, "rb");
+      GPR_ASSERT(file != nullptr);
+      const size_t length = fread(contents, 1, size - 1, file);
+      contents[length] = '\0';
+      fclose(file);
+      gpr_free(path);
+    }
+  }
+  closedir(d);
+  return count;
+}
+
+/* Samples are written on the executor, after the message is sent: waits for
+ * \a count samples of \a method to show up in \a dir. */
+static void wait_for_message_samples(const char* dir, const char* method,
+                                     size_t count) {
+  gpr_timespec deadline = five_seconds_from_now();
+  while (count_message_samples(dir, method, nullptr, 0) < count) {
+    GPR_ASSERT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) < 0);
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(10));
+  }
+}
+
+/* Removes the message samples in \a dir, and \a dir itself. */
+static void remove_message_samples(const char* dir) {
+  DIR* d = opendir(dir);
+  GPR_ASSERT(d != nullptr);
+  struct dirent* entry;
+  while ((entry = readdir(d)) != nullptr) {
+    if (entry->d_name[0] == '.') continue;
+    char* path;
+    gpr_asprintf(&path, "%s/%s", dir, entry->d_name);
+    remove(path);
+    gpr_free(path);
+  }
+  closedir(d);
+  rmdir(dir);
+}
+
+/* A client sampling its messages writes each sample to a file named after the
+ * call's method, skips messages sent with GRPC_WRITE_NO_COMPRESS, and samples
+ * at most once per interval. */
+static void test_invoke_requests_with_message_samples(
+    grpc_end2end_test_config config) {
+  char dir[] = "/tmp/grpc_message_samples.XXXXXX";
+  GPR_ASSERT(mkdtemp(dir) != nullptr);
+
+  for (int rate_limited = 0; rate_limited <= 1; rate_limited++) {
+    grpc_arg client_arg_array[] = {
+        grpc_channel_arg_string_create(
+            const_cast<char*>(
+                GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_SAMPLE_DIR),
+            dir),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(
+                GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_SAMPLE_INTERVAL_MS),
+            rate_limited ? 3600 * 1000 : 0)};
+    grpc_channel_args client_args = {GPR_ARRAY_SIZE(client_arg_array),
+                                     client_arg_array};
+    grpc_end2end_test_fixture f =
+        begin_test(config,
+                   rate_limited
+                       ? "test_invoke_requests_with_rate_limited_message_"
+                         "samples"
+                       : "test_invoke_requests_with_message_samples",
+                   &client_args, nullptr);
+    if (rate_limited) {
+      /* only the first message is sampled */
+      send_request_on_method(&f, "/pkg.Service/Limited", 0, "first");
+      send_request_on_method(&f, "/pkg.Service/Limited", 0, "second");
+      send_request_on_method(&f, "/pkg.Service/Limited", 0, "third");
+      wait_for_message_samples(dir, "pkg.Service_Limited", 1);
+      char contents[64];
+      GPR_ASSERT(1 == count_message_samples(dir, "pkg.Service_Limited",
+                                            contents, sizeof(contents)));
+      GPR_ASSERT(strcmp(contents, "first") == 0);
+    } else {
+      send_request_on_method(&f, "/pkg.Service/Skipped",
+                             GRPC_WRITE_NO_COMPRESS, "skipped");
+      send_request_on_method(&f, "/pkg.Service/Foo", 0, "foo");
+      send_request_on_method(&f, "/pkg.Service/Bar", 0, "bar");
+      wait_for_message_samples(dir, "pkg.Service_Foo", 1);
+      wait_for_message_samples(dir, "pkg.Service_Bar", 1);
+      char contents[64];
+      GPR_ASSERT(1 == count_message_samples(dir, "pkg.Service_Foo", contents,
+                                            sizeof(contents)));
+      GPR_ASSERT(strcmp(contents, "foo") == 0);
+      GPR_ASSERT(1 == count_message_samples(dir, "pkg.Service_Bar", contents,
+                                            sizeof(contents)));
+      GPR_ASSERT(strcmp(contents, "bar") == 0);
+      GPR_ASSERT(0 ==
+                 count_message_samples(dir, "pkg.Service_Skipped", nullptr, 0));
+    }
+    end_test(&f);
+    config.tear_down_data(&f);
+  }
+
+  remove_message_samples(dir);
 }
+#endif
 
 static void test_invoke_request_with_disabled_algorithm(
     grpc_end2end_test_config config) {
@@ -644,6 +1977,20 @@ void compressed_payload(grpc_end2end_test_config config) {
   test_invoke_request_with_send_message_before_initial_metadata(config);
   test_invoke_request_with_server_level(config);
   test_invoke_request_with_compressed_payload_md_override(config);
+  test_invoke_request_with_precompressed_payload(config);
+  test_invoke_request_with_passthrough(config);
+  test_invoke_request_with_decompressed_length_limit(config);
+  test_invoke_request_with_offloaded_decompressed_length_limit(config);
+  test_invoke_request_with_precompressed_payload_over_window_cap(config);
+  test_invoke_request_with_offloaded_compression(config);
+  test_invoke_request_with_offloaded_corrupt_payload(config);
+  test_invoke_request_cancelled_during_offloaded_compression(config);
+  test_invoke_request_with_local_bypass(config);
+  test_invoke_request_with_local_bypass_and_requested_algorithms(config);
+  test_invoke_request_with_compression_policy(config);
+#ifndef GPR_WINDOWS
+  test_invoke_requests_with_message_samples(config);
+#endif
   test_invoke_request_with_disabled_algorithm(config);
 }
 
@@ -28,6 +28,7 @@
 #include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/slice_splitter.h"
 #include "test/core/util/test_config.h"
 
 #include <string.h>
@@ -237,6 +238,185 @@ static void test_read_deflate_compressed_slice(void) {
   read_compressed_slice(GRPC_COMPRESS_DEFLATE, INPUT_SIZE);
 }
 
+static void test_read_zstd_compressed_slice(void) {
+  const size_t INPUT_SIZE = 2048;
+  LOG_TEST("test_read_zstd_compressed_slice");
+  read_compressed_slice(GRPC_COMPRESS_ZSTD, INPUT_SIZE);
+}
+
+/* Returns a slice of data that compresses well, but not to almost nothing. */
+static grpc_slice compressible_slice(size_t length) {
+  grpc_slice slice = grpc_slice_malloc(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(slice);
+  for (size_t i = 0; i < length; i++) {
+    p[i] = static_cast<uint8_t>("abcdefgh"[(i * 7919 + i / 13) % 8]);
+  }
+  return slice;
+}
+
+/* Compresses 'input' into 'output', split into one byte slices the way a
+ * transport could deliver them. */
+static void compress_split(grpc_compression_algorithm algorithm,
+                           grpc_slice input, grpc_slice_buffer* output) {
+  grpc_slice_buffer sliceb_in;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer_init(&sliceb_in);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_add(&sliceb_in, grpc_slice_ref(input));
+  {
+    grpc_core::ExecCtx exec_ctx;
+    GPR_ASSERT(grpc_msg_compress(
+        grpc_compression_algorithm_to_message_compression_algorithm(algorithm),
+        &sliceb_in, &compressed));
+  }
+  grpc_split_slice_buffer(GRPC_SLICE_SPLIT_ONE_BYTE, &compressed, output);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&sliceb_in);
+}
+
+static void read_large_compressed_message(
+    grpc_compression_algorithm algorithm) {
+  const size_t input_size = 1024 * 1024;
+  grpc_slice input = compressible_slice(input_size);
+  grpc_slice_buffer compressed;
+  grpc_byte_buffer* buffer;
+  grpc_byte_buffer_reader reader;
+  grpc_slice* read_slice;
+  size_t read_count = 0;
+  size_t slice_count = 0;
+
+  grpc_slice_buffer_init(&compressed);
+  compress_split(algorithm, input, &compressed);
+  buffer = grpc_raw_compressed_byte_buffer_create(compressed.slices,
+                                                  compressed.count, algorithm);
+  GPR_ASSERT(grpc_byte_buffer_reader_init(&reader, buffer) &&
+             "Couldn't init byte buffer reader");
+  while (grpc_byte_buffer_reader_peek(&reader, &read_slice)) {
+    GPR_ASSERT(read_count + GRPC_SLICE_LENGTH(*read_slice) <= input_size);
+    GPR_ASSERT(memcmp(GRPC_SLICE_START_PTR(*read_slice),
+                      GRPC_SLICE_START_PTR(input) + read_count,
+                      GRPC_SLICE_LENGTH(*read_slice)) == 0);
+    read_count += GRPC_SLICE_LENGTH(*read_slice);
+    slice_count++;
+  }
+  GPR_ASSERT(read_count == input_size);
+  /* decompressed a part at a time, not all at once */
+  GPR_ASSERT(slice_count > 1);
+  GPR_ASSERT(!grpc_byte_buffer_reader_failed(&reader));
+  grpc_byte_buffer_reader_destroy(&reader);
+  grpc_byte_buffer_destroy(buffer);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_unref(input);
+}
+
+static void test_read_large_compressed_message(void) {
+  LOG_TEST("test_read_large_compressed_message");
+  read_large_compressed_message(GRPC_COMPRESS_DEFLATE);
+  read_large_compressed_message(GRPC_COMPRESS_GZIP);
+  read_large_compressed_message(GRPC_COMPRESS_ZSTD);
+}
+
+static void test_read_corrupted_large_message(void) {
+  const size_t input_size = 1024 * 1024;
+  grpc_slice input = compressible_slice(input_size);
+  grpc_slice_buffer compressed;
+  grpc_byte_buffer* buffer;
+  grpc_byte_buffer_reader reader;
+  grpc_slice read_slice;
+  size_t read_count = 0;
+
+  LOG_TEST("test_read_corrupted_large_message");
+  grpc_slice_buffer_init(&compressed);
+  compress_split(GRPC_COMPRESS_GZIP, input, &compressed);
+  /* the gzip checksum catches the damage once the end is reached */
+  grpc_slice* damaged = &compressed.slices[compressed.count * 3 / 4];
+  GRPC_SLICE_START_PTR(*damaged)[0] ^= 0xff;
+  buffer = grpc_raw_compressed_byte_buffer_create(
+      compressed.slices, compressed.count, GRPC_COMPRESS_GZIP);
+  /* the start of the message is fine */
+  GPR_ASSERT(grpc_byte_buffer_reader_init(&reader, buffer) &&
+             "Couldn't init byte buffer reader");
+  while (grpc_byte_buffer_reader_next(&reader, &read_slice)) {
+    read_count += GRPC_SLICE_LENGTH(read_slice);
+    grpc_slice_unref(read_slice);
+  }
+  GPR_ASSERT(grpc_byte_buffer_reader_failed(&reader));
+  GPR_ASSERT(!grpc_byte_buffer_reader_exceeded_limit(&reader));
+  GPR_ASSERT(read_count < input_size);
+  GPR_ASSERT(!grpc_byte_buffer_reader_next(&reader, &read_slice));
+  grpc_byte_buffer_reader_destroy(&reader);
+  grpc_byte_buffer_destroy(buffer);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_unref(input);
+}
+
+static void test_read_past_decompressed_limit(void) {
+  const size_t input_size = 1024 * 1024;
+  grpc_slice input = compressible_slice(input_size);
+  grpc_slice_buffer compressed;
+  grpc_byte_buffer* buffer;
+  grpc_byte_buffer_reader reader;
+  grpc_slice read_slice;
+  size_t read_count = 0;
+
+  LOG_TEST("test_read_past_decompressed_limit");
+  grpc_slice_buffer_init(&compressed);
+  compress_split(GRPC_COMPRESS_ZSTD, input, &compressed);
+  buffer = grpc_raw_compressed_byte_buffer_create(
+      compressed.slices, compressed.count, GRPC_COMPRESS_ZSTD);
+  buffer->data.raw.max_decompressed_length = 100;
+  /* even a limit the first slice exceeds is only reported once read */
+  GPR_ASSERT(grpc_byte_buffer_reader_init(&reader, buffer) &&
+             "Couldn't init byte buffer reader");
+  while (grpc_byte_buffer_reader_next(&reader, &read_slice)) {
+    read_count += GRPC_SLICE_LENGTH(read_slice);
+    grpc_slice_unref(read_slice);
+  }
+  GPR_ASSERT(read_count <= 100);
+  GPR_ASSERT(grpc_byte_buffer_reader_failed(&reader));
+  GPR_ASSERT(grpc_byte_buffer_reader_exceeded_limit(&reader));
+  grpc_byte_buffer_reader_destroy(&reader);
+  grpc_byte_buffer_destroy(buffer);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_unref(input);
+}
+
+static void test_readall_corrupted_large_message(void) {
+  const size_t input_size = 1024 * 1024;
+  grpc_slice input = compressible_slice(input_size);
+  grpc_slice_buffer compressed;
+  grpc_byte_buffer* buffer;
+  grpc_byte_buffer_reader reader;
+  grpc_slice slice_out;
+
+  LOG_TEST("test_readall_corrupted_large_message");
+  grpc_slice_buffer_init(&compressed);
+  compress_split(GRPC_COMPRESS_GZIP, input, &compressed);
+  grpc_slice* damaged = &compressed.slices[compressed.count * 3 / 4];
+  GRPC_SLICE_START_PTR(*damaged)[0] ^= 0xff;
+  buffer = grpc_raw_compressed_byte_buffer_create(
+      compressed.slices, compressed.count, GRPC_COMPRESS_GZIP);
+
+  /* neither hands out the part read before the damage */
+  GPR_ASSERT(grpc_byte_buffer_reader_init(&reader, buffer) &&
+             "Couldn't init byte buffer reader");
+  slice_out = grpc_byte_buffer_reader_readall(&reader);
+  GPR_ASSERT(grpc_byte_buffer_reader_failed(&reader));
+  GPR_ASSERT(GRPC_SLICE_LENGTH(slice_out) == 0);
+  grpc_slice_unref(slice_out);
+  grpc_byte_buffer_reader_destroy(&reader);
+
+  GPR_ASSERT(grpc_byte_buffer_reader_init(&reader, buffer) &&
+             "Couldn't init byte buffer reader");
+  GPR_ASSERT(grpc_raw_byte_buffer_from_reader(&reader) == nullptr);
+  GPR_ASSERT(grpc_byte_buffer_reader_failed(&reader));
+  grpc_byte_buffer_reader_destroy(&reader);
+
+  grpc_byte_buffer_destroy(buffer);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_unref(input);
+}
+
 static void test_byte_buffer_from_reader(void) {
   grpc_slice slice;
   grpc_byte_buffer *buffer, *buffer_from_reader;
@@ -344,7 +524,12 @@ int main(int argc, char** argv) {
   test_peek_none_compressed_slice();
   test_read_gzip_compressed_slice();
   test_read_deflate_compressed_slice();
+  test_read_zstd_compressed_slice();
+  test_read_large_compressed_message();
   test_read_corrupted_slice();
+  test_read_corrupted_large_message();
+  test_read_past_decompressed_limit();
+  test_readall_corrupted_large_message();
   test_byte_buffer_from_reader();
   test_byte_buffer_copy();
   test_readall();
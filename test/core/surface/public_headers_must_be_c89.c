@@ -77,6 +77,10 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_compression_options_enable_algorithm);
   printf("%lx", (unsigned long) grpc_compression_options_disable_algorithm);
   printf("%lx", (unsigned long) grpc_compression_options_is_algorithm_enabled);
+  printf("%lx", (unsigned long) grpc_zstd_dictionary_create);
+  printf("%lx", (unsigned long) grpc_zstd_dictionary_ref);
+  printf("%lx", (unsigned long) grpc_zstd_dictionary_unref);
+  printf("%lx", (unsigned long) grpc_zstd_dictionary_arg_vtable);
   printf("%lx", (unsigned long) grpc_metadata_array_init);
   printf("%lx", (unsigned long) grpc_metadata_array_destroy);
   printf("%lx", (unsigned long) grpc_call_details_init);
@@ -110,6 +114,7 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_call_arena_alloc);
   printf("%lx", (unsigned long) grpc_call_start_batch);
   printf("%lx", (unsigned long) grpc_call_get_peer);
+  printf("%lx", (unsigned long) grpc_call_compress_message);
   printf("%lx", (unsigned long) grpc_census_call_set_context);
   printf("%lx", (unsigned long) grpc_census_call_get_context);
   printf("%lx", (unsigned long) grpc_channel_get_target);
@@ -215,6 +220,9 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_tls_server_authorization_check_config_create);
   printf("%lx", (unsigned long) grpc_raw_byte_buffer_create);
   printf("%lx", (unsigned long) grpc_raw_compressed_byte_buffer_create);
+  printf("%lx", (unsigned long) grpc_byte_buffer_compressor_create);
+  printf("%lx", (unsigned long) grpc_byte_buffer_compressor_write);
+  printf("%lx", (unsigned long) grpc_byte_buffer_compressor_finish);
   printf("%lx", (unsigned long) grpc_byte_buffer_copy);
   printf("%lx", (unsigned long) grpc_byte_buffer_length);
   printf("%lx", (unsigned long) grpc_byte_buffer_destroy);
@@ -222,6 +230,8 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_byte_buffer_reader_destroy);
   printf("%lx", (unsigned long) grpc_byte_buffer_reader_next);
   printf("%lx", (unsigned long) grpc_byte_buffer_reader_peek);
+  printf("%lx", (unsigned long) grpc_byte_buffer_reader_failed);
+  printf("%lx", (unsigned long) grpc_byte_buffer_reader_exceeded_limit);
   printf("%lx", (unsigned long) grpc_byte_buffer_reader_readall);
   printf("%lx", (unsigned long) grpc_raw_byte_buffer_from_reader);
   printf("%lx", (unsigned long) gpr_log_severity_string);
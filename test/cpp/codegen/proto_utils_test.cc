@@ -16,6 +16,8 @@
  *
  */
 
+#include <string.h>
+
 #include <grpc/impl/codegen/byte_buffer.h>
 #include <grpc/slice.h>
 #include <grpcpp/impl/codegen/grpc_library.h>
@@ -23,6 +25,9 @@
 #include <grpcpp/impl/grpc_library.h>
 #include <gtest/gtest.h>
 
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
 namespace grpc {
 
 namespace internal {
@@ -44,6 +49,7 @@ class GrpcByteBufferPeer {
  public:
   explicit GrpcByteBufferPeer(ByteBuffer* bb) : bb_(bb) {}
   grpc_byte_buffer* c_buffer() { return bb_->c_buffer(); }
+  void set_buffer(grpc_byte_buffer* buf) { bb_->set_buffer(buf); }
 
  private:
   ByteBuffer* bb_;
@@ -88,6 +94,93 @@ TEST_F(ProtoUtilsTest, TinyBackupThenNext) {
 
 namespace {
 
+// Fills bb with total_size bytes of compressible data, compressed with
+// algorithm, and returns the uncompressed data.
+grpc_slice CompressedBuffer(grpc_compression_algorithm algorithm,
+                            int total_size, ByteBuffer* bb) {
+  grpc_slice slice = grpc_slice_malloc(total_size);
+  for (int i = 0; i < total_size; i++) {
+    GRPC_SLICE_START_PTR(slice)[i] = (i / 7) % 128;
+  }
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_add(&input, grpc_slice_ref(slice));
+  {
+    grpc_core::ExecCtx exec_ctx;
+    GPR_ASSERT(grpc_msg_compress(
+        grpc_compression_algorithm_to_message_compression_algorithm(algorithm),
+        &input, &compressed));
+  }
+  GrpcByteBufferPeer(bb).set_buffer(grpc_raw_compressed_byte_buffer_create(
+      compressed.slices, compressed.count, algorithm));
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  return slice;
+}
+
+}  // namespace
+
+// The reader decompresses a compressed buffer a chunk at a time, as the parser
+// asks for it.
+TEST_F(ProtoUtilsTest, ReadCompressedInChunks) {
+  const int total_size = 1024 * 1024;
+  ByteBuffer bb;
+  grpc_slice expected = CompressedBuffer(GRPC_COMPRESS_ZSTD, total_size, &bb);
+  ProtoBufferReader reader(&bb);
+  ASSERT_TRUE(reader.status().ok());
+
+  const void* data;
+  int size;
+  int read_bytes = 0;
+  int chunks = 0;
+  bool backed_up = false;
+  while (reader.Next(&data, &size)) {
+    ASSERT_LE(read_bytes + size, total_size);
+    EXPECT_EQ(0, memcmp(data, GRPC_SLICE_START_PTR(expected) + read_bytes,
+                        size));
+    if (!backed_up && size > 1) {
+      // Consume one byte and return the rest, as the parser does at the end
+      // of a message.
+      read_bytes++;
+      reader.BackUp(size - 1);
+      backed_up = true;
+      continue;
+    }
+    backed_up = false;
+    read_bytes += size;
+    chunks++;
+  }
+  EXPECT_TRUE(reader.status().ok());
+  EXPECT_EQ(total_size, read_bytes);
+  EXPECT_EQ(total_size, reader.ByteCount());
+  EXPECT_GT(chunks, 1);
+  grpc_slice_unref(expected);
+}
+
+TEST_F(ProtoUtilsTest, ReadCorruptCompressed) {
+  const int total_size = 1024 * 1024;
+  ByteBuffer bb;
+  grpc_slice expected = CompressedBuffer(GRPC_COMPRESS_GZIP, total_size, &bb);
+  // Damage the middle of the data: the gzip checksum catches it at the end.
+  grpc_slice_buffer* compressed =
+      &GrpcByteBufferPeer(&bb).c_buffer()->data.raw.slice_buffer;
+  GRPC_SLICE_START_PTR(compressed->slices[compressed->count / 2])[0] ^= 0xff;
+  ProtoBufferReader reader(&bb);
+  ASSERT_TRUE(reader.status().ok());
+
+  const void* data;
+  int size;
+  while (reader.Next(&data, &size)) {
+  }
+  EXPECT_EQ(StatusCode::INTERNAL, reader.status().error_code());
+  EXPECT_FALSE(reader.Next(&data, &size));
+  grpc_slice_unref(expected);
+}
+
+namespace {
+
 // Set backup_size to 0 to indicate no backup is needed.
 void BufferWriterTest(int block_size, int total_size, int backup_size) {
   ByteBuffer bb;
@@ -182,6 +275,88 @@ TEST_F(WriterTest, LargeBlockLargeBackup) {
   BufferWriterTest(4096, 8192, 4095);
 }
 
+// The message is compressed a block at a time as it is written, and reads
+// back whole.
+TEST_F(WriterTest, CompressWhileWriting) {
+  const int total_size = 256 * 1024;
+  ByteBuffer bb;
+  CompressingProtoBufferWriter writer(&bb, 4096, GRPC_COMPRESS_GZIP);
+  ASSERT_TRUE(writer.Valid());
+  int written_size = 0;
+  int blocks = 0;
+  void* data;
+  int size;
+  while (written_size < total_size) {
+    ASSERT_TRUE(writer.Next(&data, &size));
+    EXPECT_EQ(4096, size);
+    // Leave part of every other block unused, as the proto library does at
+    // the end of a message.
+    int write_size =
+        std::min(size - (blocks++ % 2), total_size - written_size);
+    for (int i = 0; i < write_size; i++) {
+      (static_cast<uint8_t*>(data))[i] = written_size % 128;
+      written_size++;
+    }
+    writer.BackUp(size - write_size);
+  }
+  EXPECT_EQ(total_size, writer.ByteCount());
+  ASSERT_TRUE(writer.Finish());
+  GrpcByteBufferPeer peer(&bb);
+  EXPECT_EQ(GRPC_COMPRESS_GZIP, peer.c_buffer()->data.raw.compression);
+  EXPECT_LT(bb.Length(), static_cast<size_t>(total_size));
+
+  grpc_byte_buffer_reader reader;
+  ASSERT_TRUE(grpc_byte_buffer_reader_init(&reader, peer.c_buffer()));
+  int read_bytes = 0;
+  grpc_slice s;
+  while (grpc_byte_buffer_reader_next(&reader, &s)) {
+    for (size_t i = 0; i < GRPC_SLICE_LENGTH(s); i++) {
+      EXPECT_EQ(GRPC_SLICE_START_PTR(s)[i], read_bytes % 128);
+      read_bytes++;
+    }
+    grpc_slice_unref(s);
+  }
+  EXPECT_EQ(total_size, read_bytes);
+  EXPECT_FALSE(grpc_byte_buffer_reader_failed(&reader));
+  grpc_byte_buffer_reader_destroy(&reader);
+}
+
+// Reading past the decompressed length limit of a received message fails
+// with RESOURCE_EXHAUSTED, unlike reading corrupt data.
+TEST_F(WriterTest, ReadPastDecompressedLimit) {
+  ByteBuffer bb;
+  CompressingProtoBufferWriter writer(&bb, 4096, GRPC_COMPRESS_GZIP);
+  ASSERT_TRUE(writer.Valid());
+  void* data;
+  int size;
+  for (int i = 0; i < 64; i++) {
+    ASSERT_TRUE(writer.Next(&data, &size));
+    memset(data, 'a', size);
+  }
+  ASSERT_TRUE(writer.Finish());
+  GrpcByteBufferPeer peer(&bb);
+  peer.c_buffer()->data.raw.max_decompressed_length = 16 * 1024;
+
+  ProtoBufferReader reader(&bb);
+  ASSERT_TRUE(reader.status().ok());
+  const void* read_data;
+  while (reader.Next(&read_data, &size)) {
+  }
+  EXPECT_LE(reader.ByteCount(), 16 * 1024);
+  EXPECT_EQ(StatusCode::RESOURCE_EXHAUSTED, reader.status().error_code());
+}
+
+TEST_F(WriterTest, CompressWhileWritingWithoutCompression) {
+  ByteBuffer bb;
+  CompressingProtoBufferWriter writer(&bb, 4096, GRPC_COMPRESS_NONE);
+  EXPECT_FALSE(writer.Valid());
+  void* data;
+  int size;
+  EXPECT_FALSE(writer.Next(&data, &size));
+  EXPECT_FALSE(writer.Finish());
+  EXPECT_FALSE(bb.Valid());
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace grpc
@@ -39,6 +39,7 @@
 
 #include "absl/strings/str_format.h"
 #include "src/core/ext/filters/client_channel/backup_poller.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/env.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/security/credentials/credentials.h"
@@ -1009,6 +1010,81 @@ TEST_P(End2endTest, RequestStreamTwoRequestsWithCoalescingApi) {
   EXPECT_TRUE(s.ok());
 }
 
+TEST_P(End2endTest, RequestStreamWithPipelinedWrites) {
+  MAYBE_SKIP_TEST;
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  ClientContext context;
+
+  context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
+  context.set_pipelined_writes(0);
+  auto stream = stub_->RequestStream(&context, &response);
+  grpc::string expected;
+  for (int i = 0; i < 10; i++) {
+    request.set_message("hello" + grpc::to_string(i));
+    expected += request.message();
+    EXPECT_TRUE(stream->Write(request));
+  }
+  request.set_message("last");
+  expected += request.message();
+  stream->WriteLast(request, WriteOptions());
+  Status s = stream->Finish();
+  EXPECT_EQ(response.message(), expected);
+  EXPECT_TRUE(s.ok());
+}
+
+// Pipelining the writes of a call does not change how its messages are
+// compressed: they are compressed ahead at the call's zstd level, just as the
+// filter would have compressed them.
+TEST_P(End2endTest, RequestStreamWithPipelinedWritesKeepsZstdLevel) {
+  MAYBE_SKIP_TEST;
+#if defined(GRPC_COLLECT_STATS) || !defined(NDEBUG)
+  ResetStub();
+  auto send_requests = [this](bool pipelined, int64_t* input_bytes,
+                              int64_t* output_bytes) {
+    EchoRequest request;
+    EchoResponse response;
+    ClientContext context;
+    context.set_compression_algorithm(GRPC_COMPRESS_ZSTD);
+    context.set_zstd_compression_level(19);
+    if (pipelined) context.set_pipelined_writes(0);
+    grpc_stats_data before;
+    grpc_stats_collect(&before);
+    auto stream = stub_->RequestStream(&context, &response);
+    // Larger than a compression block, so that they would have been
+    // compressed as they were serialized.
+    for (int i = 0; i < 4; i++) {
+      grpc::string message;
+      for (int j = 0; message.size() < 2 * 16 * 1024; j++) {
+        message += grpc::to_string(i * j % 97) + " ";
+      }
+      request.set_message(message);
+      EXPECT_TRUE(stream->Write(request));
+    }
+    EXPECT_TRUE(stream->WritesDone());
+    EXPECT_TRUE(stream->Finish().ok());
+    grpc_stats_data after;
+    grpc_stats_collect(&after);
+    *input_bytes =
+        after.counters[GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_INPUT_BYTES] -
+        before.counters[GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_INPUT_BYTES];
+    *output_bytes =
+        after
+            .counters[GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_OUTPUT_BYTES] -
+        before
+            .counters[GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_ZSTD_OUTPUT_BYTES];
+  };
+  int64_t input_bytes, output_bytes;
+  send_requests(false, &input_bytes, &output_bytes);
+  int64_t pipelined_input_bytes, pipelined_output_bytes;
+  send_requests(true, &pipelined_input_bytes, &pipelined_output_bytes);
+  EXPECT_GT(input_bytes, 0);
+  EXPECT_EQ(input_bytes, pipelined_input_bytes);
+  EXPECT_EQ(output_bytes, pipelined_output_bytes);
+#endif
+}
+
 TEST_P(End2endTest, ResponseStream) {
   MAYBE_SKIP_TEST;
   ResetStub();
@@ -1072,6 +1148,74 @@ TEST_P(End2endTest, ResponseStreamWithEverythingCoalesced) {
   EXPECT_TRUE(s.ok());
 }
 
+TEST_P(End2endTest, ResponseStreamWithPipelinedWrites) {
+  MAYBE_SKIP_TEST;
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  ClientContext context;
+  request.set_message("hello");
+  context.AddMetadata(kServerPipelinedWriteBytes, "0");
+  context.AddMetadata(kServerResponseStreamsToSend, "10");
+
+  auto stream = stub_->ResponseStream(&context, request);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message() + grpc::to_string(i));
+  }
+  EXPECT_FALSE(stream->Read(&response));
+
+  Status s = stream->Finish();
+  EXPECT_TRUE(s.ok());
+}
+
+// Pipelined responses are compressed before the ones ahead of them have been
+// sent. Over the inproc transport a response is only sent once the client
+// reads it, so the responses could not have been compressed as they were sent.
+TEST_P(End2endTest, ResponseStreamWithPipelinedWritesCompressesAhead) {
+  MAYBE_SKIP_TEST;
+#if defined(GRPC_COLLECT_STATS) || !defined(NDEBUG)
+  if (GetParam().callback_server) {
+    return;
+  }
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  ClientContext context;
+  request.set_message(grpc::string(4096, 'a'));
+  context.AddMetadata(kServerPipelinedWriteBytes, "1048576");
+  context.AddMetadata(kServerResponseStreamsToSend, "4");
+  context.AddMetadata(kServerCompressionAlgorithm,
+                      grpc::to_string(GRPC_COMPRESS_GZIP));
+
+  grpc_stats_data before;
+  grpc_stats_collect(&before);
+  auto stream = stub_->ResponseStream(&context, request);
+  // Wait, without reading, for every response to be compressed.
+  int64_t compressed = 0;
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+  while (compressed < 4 &&
+         gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) < 0) {
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(10));
+    grpc_stats_data after;
+    grpc_stats_collect(&after);
+    compressed =
+        after.counters[GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_COMPRESSED] -
+        before.counters[GRPC_STATS_COUNTER_MESSAGE_COMPRESSION_COMPRESSED];
+  }
+  EXPECT_GE(compressed, 4);
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message() + grpc::to_string(i));
+  }
+  EXPECT_FALSE(stream->Read(&response));
+
+  Status s = stream->Finish();
+  EXPECT_TRUE(s.ok());
+#endif
+}
+
 TEST_P(End2endTest, BidiStream) {
   MAYBE_SKIP_TEST;
   ResetStub();
@@ -319,6 +319,19 @@ Status TestServiceImpl::ResponseStream(ServerContext* context,
       kServerResponseStreamsToSend, context->client_metadata(),
       kServerDefaultResponseStreamsToSend);
 
+  int server_pipelined_write_bytes = GetIntValueFromMetadata(
+      kServerPipelinedWriteBytes, context->client_metadata(), -1);
+  if (server_pipelined_write_bytes >= 0) {
+    context->set_pipelined_writes(server_pipelined_write_bytes);
+  }
+
+  int server_compression_algorithm = GetIntValueFromMetadata(
+      kServerCompressionAlgorithm, context->client_metadata(), -1);
+  if (server_compression_algorithm >= 0) {
+    context->set_compression_algorithm(
+        static_cast<grpc_compression_algorithm>(server_compression_algorithm));
+  }
+
   if (server_try_cancel == CANCEL_BEFORE_PROCESSING) {
     ServerTryCancel(context);
     return Status::CANCELLED;
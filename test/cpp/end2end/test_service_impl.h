@@ -36,6 +36,8 @@ const char* const kServerTryCancelRequest = "server_try_cancel";
 const char* const kDebugInfoTrailerKey = "debug-info-bin";
 const char* const kServerFinishAfterNReads = "server_finish_after_n_reads";
 const char* const kServerUseCoalescingApi = "server_use_coalescing_api";
+const char* const kServerPipelinedWriteBytes = "server_pipelined_write_bytes";
+const char* const kServerCompressionAlgorithm = "server_compression_algorithm";
 const char* const kCheckClientInitialMetadataKey = "custom_client_metadata";
 const char* const kCheckClientInitialMetadataVal = "Value for client metadata";
 
@@ -0,0 +1,482 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark message compression and decompression */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <grpc/slice_buffer.h>
+#include <zstd.h>
+
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/compression/stream_compression.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "test/core/util/slice_splitter.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+// Kinds of message contents the benchmarks are run on.
+enum Corpus {
+  // Uniformly random bytes, which no algorithm can shrink.
+  kRandom,
+  // Words drawn from a small vocabulary, like protobuf string fields.
+  kText,
+  // Serialized records mixing tags, varints, fixed64 fields and short
+  // strings, like typical protobuf messages.
+  kProtobufLike,
+  // Text that was already deflated, like images or compressed payloads.
+  kCompressed,
+  kCorpusCount
+};
+
+static const char* kCorpusNames[] = {"random", "text", "protobuf",
+                                     "compressed"};
+
+// Small, deterministic random number generator, so that every run compresses
+// the same bytes.
+class Random {
+ public:
+  uint32_t Next() {
+    state_ = state_ * 1103515245 + 12345;
+    return state_ >> 16;
+  }
+
+ private:
+  uint32_t state_ = 1;
+};
+
+static const char* kWords[] = {"grpc ",   "zstd ",    "message ",
+                               "stream ", "channel ", "compression ",
+                               "call ",   "slice "};
+
+static void FillText(Random* random, uint8_t* p, size_t length) {
+  size_t i = 0;
+  while (i < length) {
+    const char* word = kWords[random->Next() % GPR_ARRAY_SIZE(kWords)];
+    size_t n = GPR_MIN(strlen(word), length - i);
+    memcpy(p + i, word, n);
+    i += n;
+  }
+}
+
+static void FillProtobufLike(Random* random, uint8_t* p, size_t length) {
+  uint8_t record[64];
+  size_t i = 0;
+  while (i < length) {
+    size_t n = 0;
+    // Field 1: a small varint, such as an enum or a count.
+    record[n++] = 0x08;
+    record[n++] = random->Next() % 100;
+    // Field 2: a fixed64, such as an id or a timestamp, half of it random.
+    record[n++] = 0x11;
+    for (int j = 0; j < 8; j++) {
+      record[n++] = j < 4 ? random->Next() & 0xff : 0;
+    }
+    // Field 3: a short string.
+    const char* word = kWords[random->Next() % GPR_ARRAY_SIZE(kWords)];
+    const size_t word_length = strlen(word);
+    record[n++] = 0x1a;
+    record[n++] = static_cast<uint8_t>(word_length);
+    memcpy(record + n, word, word_length);
+    n += word_length;
+    n = GPR_MIN(n, length - i);
+    memcpy(p + i, record, n);
+    i += n;
+  }
+}
+
+static void FillCompressed(Random* random, uint8_t* p, size_t length) {
+  // Text deflates about tenfold: deflate enough of it that the output does not
+  // need to be repeated, which would make it compressible again.
+  const size_t text_length = GPR_MAX(length * 16, 64 * 1024);
+  grpc_slice text = GRPC_SLICE_MALLOC(text_length);
+  FillText(random, GRPC_SLICE_START_PTR(text), text_length);
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, text);
+  GPR_ASSERT(grpc_msg_compress(GRPC_MESSAGE_COMPRESS_DEFLATE, &input, &output));
+  grpc_slice deflated = grpc_slice_merge(output.slices, output.count);
+  for (size_t i = 0; i < length;) {
+    size_t n = GPR_MIN(GRPC_SLICE_LENGTH(deflated), length - i);
+    memcpy(p + i, GRPC_SLICE_START_PTR(deflated), n);
+    i += n;
+  }
+  grpc_slice_unref_internal(deflated);
+  grpc_slice_buffer_destroy_internal(&input);
+  grpc_slice_buffer_destroy_internal(&output);
+}
+
+static grpc_slice MakeCorpus(Corpus corpus, size_t length) {
+  Random random;
+  grpc_slice slice = GRPC_SLICE_MALLOC(length);
+  uint8_t* p = GRPC_SLICE_START_PTR(slice);
+  switch (corpus) {
+    case kRandom:
+      for (size_t i = 0; i < length; i++) p[i] = random.Next() & 0xff;
+      break;
+    case kText:
+      FillText(&random, p, length);
+      break;
+    case kProtobufLike:
+      FillProtobufLike(&random, p, length);
+      break;
+    case kCompressed:
+    case kCorpusCount:
+      FillCompressed(&random, p, length);
+      break;
+  }
+  return slice;
+}
+
+// Appends a message of the given corpus and length to buffer, split into
+// slices of slice_size bytes, or in a single slice if slice_size is 0.
+static void MakeMessage(Corpus corpus, size_t length, size_t slice_size,
+                        grpc_slice_buffer* buffer) {
+  grpc_slice message = MakeCorpus(corpus, length);
+  if (slice_size == 0 || slice_size >= length) {
+    grpc_slice_buffer_add(buffer, message);
+    return;
+  }
+  for (size_t i = 0; i < length; i += slice_size) {
+    grpc_slice_buffer_add(
+        buffer,
+        grpc_slice_sub(message, i, GPR_MIN(i + slice_size, length)));
+  }
+  grpc_slice_unref_internal(message);
+}
+
+// Re-slices the contents of src into dst in slices of slice_size bytes, the
+// way a transport delivers a message read from the network.
+static void Fragment(grpc_slice_buffer* src, size_t slice_size,
+                     grpc_slice_buffer* dst) {
+  if (slice_size == 0) {
+    for (size_t i = 0; i < src->count; i++) {
+      grpc_slice_buffer_add(dst, grpc_slice_ref_internal(src->slices[i]));
+    }
+    return;
+  }
+  grpc_slice merged = grpc_slice_merge(src->slices, src->count);
+  const size_t length = GRPC_SLICE_LENGTH(merged);
+  for (size_t i = 0; i < length; i += slice_size) {
+    grpc_slice_buffer_add(
+        dst, grpc_slice_sub(merged, i, GPR_MIN(i + slice_size, length)));
+  }
+  grpc_slice_unref_internal(merged);
+}
+
+static void AddLabels(TrackCounters* track_counters, Corpus corpus,
+                      size_t slice_size) {
+  track_counters->AddLabel(kCorpusNames[corpus]);
+  if (slice_size != 0) {
+    track_counters->AddLabel(std::to_string(slice_size) + "B_slices");
+  }
+}
+
+// Arguments: algorithm, level (zstd only), message length, slice size (0 for
+// a single slice) and corpus.
+static void BM_MessageCompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  const auto algorithm =
+      static_cast<grpc_message_compression_algorithm>(state.range(0));
+  const int level = static_cast<int>(state.range(1));
+  const size_t length = state.range(2);
+  const size_t slice_size = state.range(3);
+  const Corpus corpus = static_cast<Corpus>(state.range(4));
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&output);
+  MakeMessage(corpus, length, slice_size, &input);
+  grpc_core::ExecCtx exec_ctx;
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  options.level = level;
+  size_t output_length = length;
+  for (auto _ : state) {
+    if (grpc_msg_compress_with_options(algorithm, &options, &input, &output)) {
+      output_length = output.length;
+    }
+    grpc_slice_buffer_reset_and_unref_internal(&output);
+  }
+  state.SetBytesProcessed(state.iterations() * length);
+  state.counters["ratio"] =
+      static_cast<double>(length) / static_cast<double>(output_length);
+  grpc_slice_buffer_destroy_internal(&input);
+  grpc_slice_buffer_destroy_internal(&output);
+  AddLabels(&track_counters, corpus, slice_size);
+  track_counters.Finish(state);
+}
+
+// Same arguments as BM_MessageCompress; the slice size applies to the
+// compressed message.
+static void BM_MessageDecompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  const auto algorithm =
+      static_cast<grpc_message_compression_algorithm>(state.range(0));
+  const int level = static_cast<int>(state.range(1));
+  const size_t length = state.range(2);
+  const size_t slice_size = state.range(3);
+  const Corpus corpus = static_cast<Corpus>(state.range(4));
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer fragmented;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&fragmented);
+  grpc_slice_buffer_init(&output);
+  MakeMessage(corpus, length, 0, &input);
+  grpc_core::ExecCtx exec_ctx;
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  options.level = level;
+  if (!grpc_msg_compress_with_options(algorithm, &options, &input,
+                                      &compressed)) {
+    // Messages that do not shrink are normally sent uncompressed. Compress
+    // them anyway, to measure what receiving one compressed would cost.
+    grpc_slice_buffer_reset_and_unref_internal(&compressed);
+    grpc_msg_compressor* compressor =
+        grpc_msg_compressor_create(algorithm, &options);
+    for (size_t i = 0; i < input.count; i++) {
+      GPR_ASSERT(grpc_msg_compressor_write(
+          compressor, GRPC_SLICE_START_PTR(input.slices[i]),
+          GRPC_SLICE_LENGTH(input.slices[i]), &compressed));
+    }
+    GPR_ASSERT(grpc_msg_compressor_finish(compressor, &compressed));
+    grpc_msg_compressor_destroy(compressor);
+  }
+  Fragment(&compressed, slice_size, &fragmented);
+  for (auto _ : state) {
+    GPR_ASSERT(grpc_msg_decompress(algorithm, &fragmented, &output));
+    grpc_slice_buffer_reset_and_unref_internal(&output);
+  }
+  state.SetBytesProcessed(state.iterations() * length);
+  state.counters["ratio"] =
+      static_cast<double>(length) / static_cast<double>(compressed.length);
+  grpc_slice_buffer_destroy_internal(&input);
+  grpc_slice_buffer_destroy_internal(&compressed);
+  grpc_slice_buffer_destroy_internal(&fragmented);
+  grpc_slice_buffer_destroy_internal(&output);
+  AddLabels(&track_counters, corpus, slice_size);
+  track_counters.Finish(state);
+}
+
+// Arguments: compression method, message length and corpus. Every message is
+// compressed on the same context and flushed, the way the chttp2 transport
+// compresses the messages of a stream. Successive messages are successive
+// parts of a corpus larger than the compression windows, so that the stream
+// does not get to refer back to identical messages.
+static void BM_StreamCompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  const auto method =
+      static_cast<grpc_stream_compression_method>(state.range(0));
+  const size_t length = state.range(1);
+  const Corpus corpus = static_cast<Corpus>(state.range(2));
+  const size_t messages = GPR_MAX(16 * 1024 * 1024 / length, 2);
+  grpc_slice stream = MakeCorpus(corpus, messages * length);
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&output);
+  grpc_core::ExecCtx exec_ctx;
+  grpc_stream_compression_context* ctx =
+      grpc_stream_compression_context_create(method);
+  size_t output_bytes = 0;
+  size_t offset = 0;
+  for (auto _ : state) {
+    grpc_slice_buffer_add(&input,
+                          grpc_slice_sub(stream, offset, offset + length));
+    offset = (offset + length) % (messages * length);
+    GPR_ASSERT(grpc_stream_compress(ctx, &input, &output, nullptr,
+                                    SIZE_MAX,
+                                    GRPC_STREAM_COMPRESSION_FLUSH_SYNC));
+    output_bytes += output.length;
+    grpc_slice_buffer_reset_and_unref_internal(&output);
+  }
+  grpc_stream_compression_context_destroy(ctx);
+  state.SetBytesProcessed(state.iterations() * length);
+  state.counters["ratio"] = static_cast<double>(state.iterations() * length) /
+                            static_cast<double>(output_bytes);
+  grpc_slice_unref_internal(stream);
+  grpc_slice_buffer_destroy_internal(&input);
+  grpc_slice_buffer_destroy_internal(&output);
+  track_counters.AddLabel(kCorpusNames[corpus]);
+  track_counters.Finish(state);
+}
+
+// Arguments: decompression method, message length and corpus. Every
+// iteration decompresses a whole compressed stream holding one message, on a
+// new context.
+static void BM_StreamDecompress(benchmark::State& state) {
+  TrackCounters track_counters;
+  const auto method =
+      static_cast<grpc_stream_compression_method>(state.range(0));
+  const size_t length = state.range(1);
+  const Corpus corpus = static_cast<Corpus>(state.range(2));
+  grpc_slice_buffer message;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&message);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&output);
+  MakeMessage(corpus, length, 0, &message);
+  grpc_core::ExecCtx exec_ctx;
+  // Decompression methods directly follow their compression method.
+  grpc_stream_compression_context* ctx = grpc_stream_compression_context_create(
+      static_cast<grpc_stream_compression_method>(method - 1));
+  GPR_ASSERT(grpc_stream_compress(ctx, &message, &compressed, nullptr,
+                                  SIZE_MAX,
+                                  GRPC_STREAM_COMPRESSION_FLUSH_FINISH));
+  grpc_stream_compression_context_destroy(ctx);
+  for (auto _ : state) {
+    for (size_t i = 0; i < compressed.count; i++) {
+      grpc_slice_buffer_add(&input,
+                            grpc_slice_ref_internal(compressed.slices[i]));
+    }
+    ctx = grpc_stream_compression_context_create(method);
+    bool end_of_context = false;
+    GPR_ASSERT(grpc_stream_decompress(ctx, &input, &output, nullptr,
+                                      SIZE_MAX, &end_of_context));
+    grpc_stream_compression_context_destroy(ctx);
+    grpc_slice_buffer_reset_and_unref_internal(&input);
+    grpc_slice_buffer_reset_and_unref_internal(&output);
+  }
+  state.SetBytesProcessed(state.iterations() * length);
+  state.counters["ratio"] =
+      static_cast<double>(length) / static_cast<double>(compressed.length);
+  grpc_slice_buffer_destroy_internal(&message);
+  grpc_slice_buffer_destroy_internal(&compressed);
+  grpc_slice_buffer_destroy_internal(&input);
+  grpc_slice_buffer_destroy_internal(&output);
+  track_counters.AddLabel(kCorpusNames[corpus]);
+  track_counters.Finish(state);
+}
+
+// Reference point for the context pools: the cost of creating and freeing a
+// zstd context per message, which is what every message paid before.
+static void BM_ZstdContextCreate(benchmark::State& state) {
+  TrackCounters track_counters;
+  for (auto _ : state) {
+    ZSTD_CCtx* cctx = ZSTD_createCCtx();
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, 5);
+    ZSTD_freeCCtx(cctx);
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ZstdContextCreate);
+
+// Every algorithm at its default level on text, from 64B to 64MB.
+static void MessageSizeArgs(benchmark::internal::Benchmark* b) {
+  for (int algorithm = GRPC_MESSAGE_COMPRESS_DEFLATE;
+       algorithm < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; algorithm++) {
+    for (int length = 64; length <= 64 * 1024 * 1024; length *= 16) {
+      b->Args({algorithm, GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL, length, 0,
+               kText});
+    }
+  }
+}
+
+// zstd levels, from the fastest negative level to the strongest levels that
+// are still fast enough for messages.
+static void ZstdLevelArgs(benchmark::internal::Benchmark* b) {
+  for (int level : {-5, -1, 1, 3, 9, 15, 19}) {
+    for (int length : {4 * 1024, 1024 * 1024}) {
+      for (int corpus : {kText, kProtobufLike}) {
+        b->Args({GRPC_MESSAGE_COMPRESS_ZSTD, level, length, 0, corpus});
+      }
+    }
+  }
+}
+
+// Every algorithm on every corpus.
+static void CorpusArgs(benchmark::internal::Benchmark* b) {
+  for (int algorithm = GRPC_MESSAGE_COMPRESS_DEFLATE;
+       algorithm < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; algorithm++) {
+    for (int corpus = 0; corpus < kCorpusCount; corpus++) {
+      for (int length : {1024, 256 * 1024}) {
+        b->Args({algorithm, GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL, length, 0,
+                 corpus});
+      }
+    }
+  }
+}
+
+// Messages split in many slices, as they are when serialized in chunks or
+// read from the network in frames.
+static void SliceSizeArgs(benchmark::internal::Benchmark* b) {
+  for (int algorithm = GRPC_MESSAGE_COMPRESS_DEFLATE;
+       algorithm < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; algorithm++) {
+    for (int slice_size : {64, 1024, 16 * 1024}) {
+      b->Args({algorithm, GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL, 1024 * 1024,
+               slice_size, kProtobufLike});
+    }
+  }
+}
+
+BENCHMARK(BM_MessageCompress)
+    ->Apply(MessageSizeArgs)
+    ->Apply(ZstdLevelArgs)
+    ->Apply(CorpusArgs)
+    ->Apply(SliceSizeArgs);
+BENCHMARK(BM_MessageDecompress)
+    ->Apply(MessageSizeArgs)
+    ->Apply(ZstdLevelArgs)
+    ->Apply(CorpusArgs)
+    ->Apply(SliceSizeArgs);
+
+static void StreamArgs(benchmark::internal::Benchmark* b, int method_offset) {
+  for (int method : {GRPC_STREAM_COMPRESSION_GZIP_COMPRESS,
+                     GRPC_STREAM_COMPRESSION_ZSTD_COMPRESS}) {
+    for (int length = 64; length <= 1024 * 1024; length *= 16) {
+      for (int corpus : {kText, kProtobufLike}) {
+        b->Args({method + method_offset, length, corpus});
+      }
+    }
+  }
+}
+static void StreamCompressArgs(benchmark::internal::Benchmark* b) {
+  StreamArgs(b, 0);
+}
+static void StreamDecompressArgs(benchmark::internal::Benchmark* b) {
+  StreamArgs(b, 1);
+}
+BENCHMARK(BM_StreamCompress)->Apply(StreamCompressArgs);
+BENCHMARK(BM_StreamDecompress)->Apply(StreamDecompressArgs);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -54,7 +54,8 @@ namespace testing {
 template <class RequestType>
 class ClientRequestCreator {
  public:
-  ClientRequestCreator(RequestType* /*req*/, const PayloadConfig&) {
+  ClientRequestCreator(RequestType* /*req*/, const PayloadConfig&,
+                       int /*incompressible_percent*/) {
     // this template must be specialized
     // fail with an assertion rather than a compile-time
     // check since these only happen at the beginning anyway
@@ -65,8 +66,8 @@ class ClientRequestCreator {
 template <>
 class ClientRequestCreator<SimpleRequest> {
  public:
-  ClientRequestCreator(SimpleRequest* req,
-                       const PayloadConfig& payload_config) {
+  ClientRequestCreator(SimpleRequest* req, const PayloadConfig& payload_config,
+                       int incompressible_percent) {
     if (payload_config.has_bytebuf_params()) {
       GPR_ASSERT(false);  // not appropriate for this specialization
     } else if (payload_config.has_simple_params()) {
@@ -76,6 +77,7 @@ class ClientRequestCreator<SimpleRequest> {
           grpc::testing::PayloadType::COMPRESSABLE);
       int size = payload_config.simple_params().req_size();
       std::unique_ptr<char[]> body(new char[size]);
+      Server::FillPayload(body.get(), size, incompressible_percent);
       req->mutable_payload()->set_body(body.get(), size);
     } else if (payload_config.has_complex_params()) {
       GPR_ASSERT(false);  // not appropriate for this specialization
@@ -92,12 +94,13 @@ class ClientRequestCreator<SimpleRequest> {
 template <>
 class ClientRequestCreator<ByteBuffer> {
  public:
-  ClientRequestCreator(ByteBuffer* req, const PayloadConfig& payload_config) {
+  ClientRequestCreator(ByteBuffer* req, const PayloadConfig& payload_config,
+                       int incompressible_percent) {
     if (payload_config.has_bytebuf_params()) {
       size_t req_sz =
           static_cast<size_t>(payload_config.bytebuf_params().req_size());
       std::unique_ptr<char[]> buf(new char[req_sz]);
-      memset(buf.get(), 0, req_sz);
+      Server::FillPayload(buf.get(), req_sz, incompressible_percent);
       Slice slice(buf.get(), req_sz);
       *req = ByteBuffer(&slice, 1);
     } else {
@@ -435,8 +438,9 @@ class ClientImpl : public Client {
     WaitForChannelsToConnect();
     median_latency_collection_interval_seconds_ =
         config.median_latency_collection_interval_millis() / 1e3;
-    ClientRequestCreator<RequestType> create_req(&request_,
-                                                 config.payload_config());
+    ClientRequestCreator<RequestType> create_req(
+        &request_, config.payload_config(),
+        config.compression_params().incompressible_percent());
   }
   virtual ~ClientImpl() {}
   const RequestType* request() { return &request_; }
@@ -551,6 +555,14 @@ class ClientImpl : public Client {
           gpr_log(GPR_ERROR, "Empty channel arg value.");
         }
       }
+      if (config.has_compression_params()) {
+        args->SetCompressionAlgorithm(
+            Server::CompressionAlgorithm(config.compression_params()));
+        if (config.compression_params().zstd_level() != 0) {
+          args->SetInt(GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL,
+                       config.compression_params().zstd_level());
+        }
+      }
     }
 
     std::shared_ptr<Channel> channel_;
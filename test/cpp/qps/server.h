@@ -19,12 +19,16 @@
 #ifndef TEST_QPS_SERVER_H
 #define TEST_QPS_SERVER_H
 
+#include <grpc/compression.h>
 #include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpcpp/channel.h>
 #include <grpcpp/resource_quota.h>
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server_builder.h>
+#include <string.h>
+
+#include <algorithm>
 #include <vector>
 
 #include "src/cpp/util/core_stats.h"
@@ -78,7 +82,8 @@ class Server {
     return stats;
   }
 
-  static bool SetPayload(PayloadType type, int size, Payload* payload) {
+  static bool SetPayload(PayloadType type, int size, int incompressible_percent,
+                         Payload* payload) {
     // TODO(yangg): Support UNCOMPRESSABLE payload.
     if (type != PayloadType::COMPRESSABLE) {
       return false;
@@ -87,11 +92,43 @@ class Server {
     // Don't waste time creating a new payload of identical size.
     if (payload->body().length() != static_cast<size_t>(size)) {
       std::unique_ptr<char[]> body(new char[size]());
+      FillPayload(body.get(), size, incompressible_percent);
       payload->set_body(body.get(), size);
     }
     return true;
   }
 
+  // Fills the size bytes of body with incompressible_percent percent of
+  // random bytes, followed by zeros.
+  static void FillPayload(char* body, size_t size, int incompressible_percent) {
+    const size_t random_bytes =
+        size * std::min(std::max(incompressible_percent, 0), 100) / 100;
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < random_bytes; i++) {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      body[i] = static_cast<char>(state);
+    }
+    memset(body + random_bytes, 0, size - random_bytes);
+  }
+
+  // Returns the algorithm named by params, or GRPC_COMPRESS_NONE if it is
+  // unknown.
+  static grpc_compression_algorithm CompressionAlgorithm(
+      const CompressionParams& params) {
+    grpc_compression_algorithm algorithm = GRPC_COMPRESS_NONE;
+    if (!params.algorithm().empty() &&
+        !grpc_compression_algorithm_parse(
+            grpc_slice_from_static_buffer(params.algorithm().data(),
+                                          params.algorithm().size()),
+            &algorithm)) {
+      gpr_log(GPR_ERROR, "Unknown compression algorithm '%s'",
+              params.algorithm().c_str());
+    }
+    return algorithm;
+  }
+
   int port() const { return port_; }
   int cores() const { return cores_; }
   static std::shared_ptr<ServerCredentials> CreateServerCredentials(
@@ -141,6 +178,14 @@ class Server {
           break;
       }
     }
+    if (config.has_compression_params()) {
+      builder->SetDefaultCompressionAlgorithm(
+          CompressionAlgorithm(config.compression_params()));
+      if (config.compression_params().zstd_level() != 0) {
+        builder->AddChannelArgument(GRPC_COMPRESSION_CHANNEL_ZSTD_LEVEL,
+                                    config.compression_params().zstd_level());
+      }
+    }
   }
 
  private:
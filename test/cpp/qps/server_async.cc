@@ -71,7 +71,7 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
                          ServerAsyncReaderWriter<ResponseType, RequestType>*,
                          CompletionQueue*, ServerCompletionQueue*, void*)>
           request_streaming_both_ways_function,
-      std::function<grpc::Status(const PayloadConfig&, RequestType*,
+      std::function<grpc::Status(const ServerConfig&, RequestType*,
                                  ResponseType*)>
           process_rpc)
       : Server(config) {
@@ -108,7 +108,7 @@ class AsyncQpsServerTest final : public grpc::testing::Server {
     server_ = builder->BuildAndStart();
 
     auto process_rpc_bound =
-        std::bind(process_rpc, config.payload_config(), std::placeholders::_1,
+        std::bind(process_rpc, config, std::placeholders::_1,
                   std::placeholders::_2);
 
     for (int i = 0; i < 5000; i++) {
@@ -536,11 +536,14 @@ static void RegisterGenericService(ServerBuilder* builder,
   builder->RegisterAsyncGenericService(service);
 }
 
-static Status ProcessSimpleRPC(const PayloadConfig&, SimpleRequest* request,
+static Status ProcessSimpleRPC(const ServerConfig& config,
+                               SimpleRequest* request,
                                SimpleResponse* response) {
   if (request->response_size() > 0) {
-    if (!Server::SetPayload(request->response_type(), request->response_size(),
-                            response->mutable_payload())) {
+    if (!Server::SetPayload(
+            request->response_type(), request->response_size(),
+            config.compression_params().incompressible_percent(),
+            response->mutable_payload())) {
       return Status(grpc::StatusCode::INTERNAL, "Error creating payload.");
     }
   }
@@ -550,14 +553,15 @@ static Status ProcessSimpleRPC(const PayloadConfig&, SimpleRequest* request,
   return Status::OK;
 }
 
-static Status ProcessGenericRPC(const PayloadConfig& payload_config,
+static Status ProcessGenericRPC(const ServerConfig& config,
                                 ByteBuffer* request, ByteBuffer* response) {
   // We are done using the request. Clear it to reduce working memory.
   // This proves to reduce cache misses in large message size cases.
   request->Clear();
-  int resp_size = payload_config.bytebuf_params().resp_size();
+  int resp_size = config.payload_config().bytebuf_params().resp_size();
   std::unique_ptr<char[]> buf(new char[resp_size]);
-  memset(buf.get(), 0, static_cast<size_t>(resp_size));
+  Server::FillPayload(buf.get(), static_cast<size_t>(resp_size),
+                      config.compression_params().incompressible_percent());
   Slice slice(buf.get(), resp_size);
   *response = ByteBuffer(&slice, 1);
   return Status::OK;
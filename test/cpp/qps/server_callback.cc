@@ -33,11 +33,14 @@ namespace testing {
 class BenchmarkCallbackServiceImpl final
     : public BenchmarkService::ExperimentalCallbackService {
  public:
+  explicit BenchmarkCallbackServiceImpl(int incompressible_percent)
+      : incompressible_percent_(incompressible_percent) {}
+
   ::grpc::experimental::ServerUnaryReactor* UnaryCall(
       ::grpc::experimental::CallbackServerContext* context,
       const SimpleRequest* request, SimpleResponse* response) override {
     auto* reactor = context->DefaultReactor();
-    reactor->Finish(SetResponse(request, response));
+    reactor->Finish(SetResponse(request, response, incompressible_percent_));
     return reactor;
   }
 
@@ -48,14 +51,17 @@ class BenchmarkCallbackServiceImpl final
         : public ::grpc::experimental::ServerBidiReactor<
               ::grpc::testing::SimpleRequest, ::grpc::testing::SimpleResponse> {
      public:
-      Reactor() { StartRead(&request_); }
+      explicit Reactor(int incompressible_percent)
+          : incompressible_percent_(incompressible_percent) {
+        StartRead(&request_);
+      }
 
       void OnReadDone(bool ok) override {
         if (!ok) {
           Finish(::grpc::Status::OK);
           return;
         }
-        auto s = SetResponse(&request_, &response_);
+        auto s = SetResponse(&request_, &response_, incompressible_percent_);
         if (!s.ok()) {
           Finish(s);
           return;
@@ -74,29 +80,35 @@ class BenchmarkCallbackServiceImpl final
       void OnDone() override { delete (this); }
 
      private:
+      const int incompressible_percent_;
       SimpleRequest request_;
       SimpleResponse response_;
     };
-    return new Reactor;
+    return new Reactor(incompressible_percent_);
   }
 
  private:
   static Status SetResponse(const SimpleRequest* request,
-                            SimpleResponse* response) {
+                            SimpleResponse* response,
+                            int incompressible_percent) {
     if (request->response_size() > 0) {
       if (!Server::SetPayload(request->response_type(),
-                              request->response_size(),
+                              request->response_size(), incompressible_percent,
                               response->mutable_payload())) {
         return Status(grpc::StatusCode::INTERNAL, "Error creating payload.");
       }
     }
     return Status::OK;
   }
+
+  const int incompressible_percent_;
 };
 
 class CallbackServer final : public grpc::testing::Server {
  public:
-  explicit CallbackServer(const ServerConfig& config) : Server(config) {
+  explicit CallbackServer(const ServerConfig& config)
+      : Server(config),
+        service_(config.compression_params().incompressible_percent()) {
     std::unique_ptr<ServerBuilder> builder = CreateQpsServerBuilder();
 
     auto port_num = port();
@@ -36,9 +36,12 @@ namespace testing {
 
 class BenchmarkServiceImpl final : public BenchmarkService::Service {
  public:
+  explicit BenchmarkServiceImpl(int incompressible_percent)
+      : incompressible_percent_(incompressible_percent) {}
+
   Status UnaryCall(ServerContext* /*context*/, const SimpleRequest* request,
                    SimpleResponse* response) override {
-    auto s = SetResponse(request, response);
+    auto s = SetResponse(request, response, incompressible_percent_);
     if (!s.ok()) {
       return s;
     }
@@ -50,7 +53,7 @@ class BenchmarkServiceImpl final : public BenchmarkService::Service {
     SimpleRequest request;
     while (stream->Read(&request)) {
       SimpleResponse response;
-      auto s = SetResponse(&request, &response);
+      auto s = SetResponse(&request, &response, incompressible_percent_);
       if (!s.ok()) {
         return s;
       }
@@ -63,7 +66,7 @@ class BenchmarkServiceImpl final : public BenchmarkService::Service {
   Status StreamingFromClient(ServerContext* context,
                              ServerReader<SimpleRequest>* stream,
                              SimpleResponse* response) override {
-    auto s = ClientPull(context, stream, response);
+    auto s = ClientPull(context, stream, response, incompressible_percent_);
     if (!s.ok()) {
       return s;
     }
@@ -73,7 +76,7 @@ class BenchmarkServiceImpl final : public BenchmarkService::Service {
                              const SimpleRequest* request,
                              ServerWriter<SimpleResponse>* stream) override {
     SimpleResponse response;
-    auto s = SetResponse(request, &response);
+    auto s = SetResponse(request, &response, incompressible_percent_);
     if (!s.ok()) {
       return s;
     }
@@ -88,7 +91,7 @@ class BenchmarkServiceImpl final : public BenchmarkService::Service {
       return Status::OK;
     }
     SimpleResponse response;
-    auto s = SetResponse(&request, &response);
+    auto s = SetResponse(&request, &response, incompressible_percent_);
     if (!s.ok()) {
       return s;
     }
@@ -100,7 +103,7 @@ class BenchmarkServiceImpl final : public BenchmarkService::Service {
       });
     });
     SimpleResponse dummy;
-    auto cp = ClientPull(context, stream, &dummy);
+    auto cp = ClientPull(context, stream, &dummy, incompressible_percent_);
     done.store(true, std::memory_order_relaxed);  // can be lazy
     t.join();
     if (!cp.ok()) {
@@ -115,12 +118,14 @@ class BenchmarkServiceImpl final : public BenchmarkService::Service {
  private:
   template <class R>
   static Status ClientPull(ServerContext* /*context*/, R* stream,
-                           SimpleResponse* response) {
+                           SimpleResponse* response,
+                           int incompressible_percent) {
     SimpleRequest request;
     while (stream->Read(&request)) {
     }
     if (request.response_size() > 0) {
       if (!Server::SetPayload(request.response_type(), request.response_size(),
+                              incompressible_percent,
                               response->mutable_payload())) {
         return Status(grpc::StatusCode::INTERNAL, "Error creating payload.");
       }
@@ -140,21 +145,26 @@ class BenchmarkServiceImpl final : public BenchmarkService::Service {
     return Status::OK;
   }
   static Status SetResponse(const SimpleRequest* request,
-                            SimpleResponse* response) {
+                            SimpleResponse* response,
+                            int incompressible_percent) {
     if (request->response_size() > 0) {
       if (!Server::SetPayload(request->response_type(),
-                              request->response_size(),
+                              request->response_size(), incompressible_percent,
                               response->mutable_payload())) {
         return Status(grpc::StatusCode::INTERNAL, "Error creating payload.");
       }
     }
     return Status::OK;
   }
+
+  const int incompressible_percent_;
 };
 
 class SynchronousServer final : public grpc::testing::Server {
  public:
-  explicit SynchronousServer(const ServerConfig& config) : Server(config) {
+  explicit SynchronousServer(const ServerConfig& config)
+      : Server(config),
+        service_(config.compression_params().incompressible_percent()) {
     std::unique_ptr<ServerBuilder> builder = CreateQpsServerBuilder();
 
     auto port_num = port();
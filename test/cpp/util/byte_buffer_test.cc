@@ -20,6 +20,7 @@
 #include <grpcpp/impl/grpc_library.h>
 
 #include <cstring>
+#include <string>
 #include <vector>
 
 #include <grpc/grpc.h>
@@ -104,6 +105,62 @@ TEST_F(ByteBufferTest, Dump) {
   EXPECT_TRUE(SliceEqual(slices[1], world));
 }
 
+std::string DumpToString(const ByteBuffer& buffer) {
+  std::vector<Slice> slices;
+  EXPECT_TRUE(buffer.Dump(&slices).ok());
+  std::string content;
+  for (const Slice& s : slices) {
+    content.append(reinterpret_cast<const char*>(s.begin()), s.size());
+  }
+  return content;
+}
+
+TEST_F(ByteBufferTest, Compress) {
+  grpc_slice hello = grpc_slice_from_copied_string(kContent1);
+  grpc_slice world = grpc_slice_from_copied_string(kContent2);
+  std::vector<Slice> slices;
+  slices.push_back(Slice(hello, Slice::STEAL_REF));
+  slices.push_back(Slice(world, Slice::STEAL_REF));
+  ByteBuffer buffer(&slices[0], 2);
+  ByteBuffer gzip;
+  EXPECT_TRUE(buffer.Compress(GRPC_COMPRESS_GZIP, &gzip).ok());
+  // Already compressed buffers are decompressed before being compressed
+  // again.
+  ByteBuffer deflate;
+  EXPECT_TRUE(gzip.Compress(GRPC_COMPRESS_DEFLATE, &deflate).ok());
+  EXPECT_EQ(std::string(kContent1) + kContent2, DumpToString(deflate));
+}
+
+TEST_F(ByteBufferTest, CreateCompressed) {
+  grpc_byte_buffer_compressor* compressor =
+      grpc_byte_buffer_compressor_create(
+          GRPC_COMPRESS_GZIP, GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL, 0);
+  ASSERT_TRUE(grpc_byte_buffer_compressor_write(compressor, kContent1,
+                                                strlen(kContent1)));
+  grpc_byte_buffer* gzip = grpc_byte_buffer_compressor_finish(compressor);
+  ASSERT_NE(nullptr, gzip);
+  std::vector<Slice> slices;
+  for (size_t i = 0; i < gzip->data.raw.slice_buffer.count; i++) {
+    slices.push_back(Slice(gzip->data.raw.slice_buffer.slices[i],
+                           Slice::ADD_REF));
+  }
+  grpc_byte_buffer_destroy(gzip);
+  ByteBuffer buffer(&slices[0], slices.size(), GRPC_COMPRESS_GZIP);
+  EXPECT_EQ(GRPC_COMPRESS_GZIP, buffer.compression_algorithm());
+  EXPECT_EQ(kContent1, DumpToString(buffer));
+  EXPECT_EQ(GRPC_COMPRESS_NONE, ByteBuffer().compression_algorithm());
+}
+
+TEST_F(ByteBufferTest, CompressWithStreamAlgorithm) {
+  Slice s(kContent1);
+  ByteBuffer buffer(&s, 1);
+  ByteBuffer compressed;
+  EXPECT_EQ(StatusCode::INVALID_ARGUMENT,
+            buffer.Compress(GRPC_COMPRESS_STREAM_GZIP, &compressed)
+                .error_code());
+  EXPECT_FALSE(compressed.Valid());
+}
+
 TEST_F(ByteBufferTest, SerializationMakesCopy) {
   grpc_slice hello = grpc_slice_from_copied_string(kContent1);
   grpc_slice world = grpc_slice_from_copied_string(kContent2);
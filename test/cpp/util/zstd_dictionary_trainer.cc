@@ -0,0 +1,279 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+  Trains per-method zstd dictionaries from the message samples that channels
+  write to GRPC_COMPRESSION_CHANNEL_ZSTD_DICTIONARY_SAMPLE_DIR, and reports what
+  each dictionary gains over plain zstd on the same messages.
+
+  Usage: zstd_dictionary_trainer --sample_dir=<dir> [--output_dir=<dir>]
+
+  For every method with enough samples, writes <output_dir>/<method>.dict,
+  which can be loaded with grpc_zstd_dictionary_create(). One sample in ten is
+  held out of training, and the reported ratio and speed are measured on those
+  held out samples, compressing through the same code path as the channels.
+*/
+
+#include <dirent.h>
+#include <stdio.h>
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <grpc/compression.h>
+#include <grpc/grpc.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/time.h>
+#include <zdict.h>
+
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "test/cpp/util/test_config.h"
+
+DEFINE_string(sample_dir, "", "Directory containing the message samples");
+DEFINE_string(output_dir, "",
+              "Directory to write the dictionaries to (default: sample_dir)");
+DEFINE_int32(dictionary_size, 112640, "Maximum size of each dictionary");
+DEFINE_int32(level, GRPC_ZSTD_DEFAULT_COMPRESSION_LEVEL,
+             "zstd compression level to evaluate the dictionaries at");
+DEFINE_int32(min_samples, 20, "Skip methods with fewer samples than this");
+DEFINE_int32(iterations, 10,
+             "Times each held out sample is compressed when measuring speed");
+
+namespace grpc {
+namespace testing {
+namespace {
+
+const char kSampleSuffix[] = ".sample";
+// One sample in kHoldOutInterval is used for evaluation instead of training.
+const size_t kHoldOutInterval = 10;
+
+struct MethodSamples {
+  std::vector<std::string> training;
+  std::vector<std::string> evaluation;
+};
+
+struct Measurement {
+  size_t input_bytes = 0;
+  size_t output_bytes = 0;
+  double compress_seconds = 0;
+  double decompress_seconds = 0;
+};
+
+// Sample names are "<method>.<unique id>.sample".
+bool MethodOfSample(const std::string& filename, std::string* method) {
+  const size_t suffix_length = sizeof(kSampleSuffix) - 1;
+  if (filename.size() <= suffix_length ||
+      filename.compare(filename.size() - suffix_length, suffix_length,
+                       kSampleSuffix) != 0) {
+    return false;
+  }
+  const size_t dot = filename.rfind('.', filename.size() - suffix_length - 1);
+  if (dot == std::string::npos || dot == 0) return false;
+  *method = filename.substr(0, dot);
+  return true;
+}
+
+bool ReadFile(const std::string& path, std::string* contents) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+  std::ostringstream buffer;
+  buffer << file.rdbuf();
+  *contents = buffer.str();
+  return !file.bad();
+}
+
+std::map<std::string, MethodSamples> ReadSamples(const std::string& dir) {
+  std::map<std::string, MethodSamples> samples;
+  DIR* directory = opendir(dir.c_str());
+  if (directory == nullptr) {
+    std::cerr << "Cannot open " << dir << std::endl;
+    return samples;
+  }
+  struct dirent* entry;
+  while ((entry = readdir(directory)) != nullptr) {
+    std::string method;
+    if (!MethodOfSample(entry->d_name, &method)) continue;
+    std::string contents;
+    if (!ReadFile(dir + "/" + entry->d_name, &contents)) {
+      std::cerr << "Cannot read " << entry->d_name << std::endl;
+      continue;
+    }
+    MethodSamples& method_samples = samples[method];
+    const size_t count =
+        method_samples.training.size() + method_samples.evaluation.size();
+    if (count % kHoldOutInterval == kHoldOutInterval - 1) {
+      method_samples.evaluation.push_back(std::move(contents));
+    } else {
+      method_samples.training.push_back(std::move(contents));
+    }
+  }
+  closedir(directory);
+  return samples;
+}
+
+// Returns the trained dictionary, or an empty string if training failed.
+std::string Train(const std::vector<std::string>& samples) {
+  std::string buffer;
+  std::vector<size_t> sizes;
+  for (const std::string& sample : samples) {
+    buffer += sample;
+    sizes.push_back(sample.size());
+  }
+  std::string dictionary(FLAGS_dictionary_size, '\0');
+  size_t size = ZDICT_trainFromBuffer(&dictionary[0], dictionary.size(),
+                                      buffer.data(), sizes.data(),
+                                      static_cast<unsigned>(sizes.size()));
+  if (ZDICT_isError(size)) {
+    std::cerr << "Training failed: " << ZDICT_getErrorName(size) << std::endl;
+    return "";
+  }
+  dictionary.resize(size);
+  return dictionary;
+}
+
+double SecondsSince(gpr_timespec start) {
+  return gpr_timespec_to_micros(
+             gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start)) /
+         1e6;
+}
+
+// Compresses and decompresses every sample the way the message_compress
+// filter does, with the given dictionary (or none).
+Measurement Measure(const std::vector<std::string>& samples,
+                    grpc_zstd_dictionary* dictionary) {
+  grpc_core::ExecCtx exec_ctx;
+  Measurement m;
+  grpc_msg_compress_options options;
+  grpc_msg_compress_options_init(&options);
+  options.level = FLAGS_level;
+  options.dictionary = dictionary;
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  for (const std::string& sample : samples) {
+    grpc_slice_buffer_add(&input, grpc_slice_from_copied_buffer(
+                                      sample.data(), sample.size()));
+    gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+    bool did_compress = false;
+    for (int i = 0; i < FLAGS_iterations; i++) {
+      grpc_slice_buffer_reset_and_unref_internal(&compressed);
+      did_compress = grpc_msg_compress_with_options(
+          GRPC_MESSAGE_COMPRESS_ZSTD, &options, &input, &compressed);
+    }
+    m.compress_seconds += SecondsSince(start);
+    m.input_bytes += sample.size();
+    if (did_compress) {
+      m.output_bytes += compressed.length;
+      start = gpr_now(GPR_CLOCK_MONOTONIC);
+      for (int i = 0; i < FLAGS_iterations; i++) {
+        grpc_slice_buffer_reset_and_unref_internal(&output);
+        GPR_ASSERT(grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_ZSTD, &compressed,
+                                       &output));
+      }
+      m.decompress_seconds += SecondsSince(start);
+    } else {
+      // Sent uncompressed.
+      m.output_bytes += sample.size();
+    }
+    grpc_slice_buffer_reset_and_unref_internal(&input);
+    grpc_slice_buffer_reset_and_unref_internal(&compressed);
+    grpc_slice_buffer_reset_and_unref_internal(&output);
+  }
+  grpc_slice_buffer_destroy_internal(&input);
+  grpc_slice_buffer_destroy_internal(&compressed);
+  grpc_slice_buffer_destroy_internal(&output);
+  return m;
+}
+
+std::string Describe(const Measurement& m) {
+  const double mb = m.input_bytes * static_cast<double>(FLAGS_iterations) / 1e6;
+  char buffer[128];
+  snprintf(buffer, sizeof(buffer),
+           "ratio %.2fx, compress %.1f MB/s, decompress %.1f MB/s",
+           static_cast<double>(m.input_bytes) / m.output_bytes,
+           mb / m.compress_seconds,
+           m.decompress_seconds > 0 ? mb / m.decompress_seconds : 0.0);
+  return buffer;
+}
+
+int Run() {
+  if (FLAGS_sample_dir.empty()) {
+    std::cerr << "--sample_dir is required" << std::endl;
+    return 1;
+  }
+  const std::string output_dir =
+      FLAGS_output_dir.empty() ? FLAGS_sample_dir : FLAGS_output_dir;
+  int status = 0;
+  for (const auto& p : ReadSamples(FLAGS_sample_dir)) {
+    const std::string& method = p.first;
+    const MethodSamples& samples = p.second;
+    const size_t count = samples.training.size() + samples.evaluation.size();
+    if (count < static_cast<size_t>(FLAGS_min_samples)) {
+      std::cout << method << ": " << count << " samples, skipped" << std::endl;
+      continue;
+    }
+    const std::string data = Train(samples.training);
+    if (data.empty()) {
+      status = 1;
+      continue;
+    }
+    const std::string path = output_dir + "/" + method + ".dict";
+    std::ofstream file(path, std::ios::binary);
+    file.write(data.data(), data.size());
+    file.close();
+    if (!file) {
+      std::cerr << "Cannot write " << path << std::endl;
+      status = 1;
+      continue;
+    }
+    grpc_zstd_dictionary* dictionary =
+        grpc_zstd_dictionary_create(data.data(), data.size());
+    GPR_ASSERT(dictionary != nullptr);
+    std::cout << method << ": " << count << " samples, " << data.size()
+              << " byte dictionary written to " << path << std::endl
+              << "  without dictionary: "
+              << Describe(Measure(samples.evaluation, nullptr)) << std::endl
+              << "  with dictionary:    "
+              << Describe(Measure(samples.evaluation, dictionary)) << std::endl;
+    grpc_zstd_dictionary_unref(dictionary);
+  }
+  return status;
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::InitTest(&argc, &argv, true);
+  grpc_init();
+  int status = grpc::testing::Run();
+  grpc_shutdown();
+  return status;
+}
@@ -71,6 +71,7 @@ CONFIG = [
     'deflate',
     'gzip',
     'zstd',
+    'lz4',
     'stream/gzip',
     'stream/zstd',
     # metadata elements
@@ -145,6 +146,7 @@ CONFIG = [
     ('grpc-encoding', 'gzip'),
     ('grpc-encoding', 'deflate'),
     ('grpc-encoding', 'zstd'),
+    ('grpc-encoding', 'lz4'),
     ('te', 'trailers'),
     ('content-type', 'application/grpc'),
     (':scheme', 'grpc'),
@@ -189,7 +191,8 @@ COMPRESSION_ALGORITHMS = [
     'identity',
     'deflate',
     'gzip',
-    'zstd'
+    'zstd',
+    'lz4'
 ]
 
 STREAM_COMPRESSION_ALGORITHMS = [
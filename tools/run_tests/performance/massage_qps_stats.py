@@ -317,6 +317,114 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_cq_ev_queue_transient_pop_failures"] = massage_qps_stats_helpers.counter(
                     core_stats, "cq_ev_queue_transient_pop_failures")
+            stats[
+                "core_message_compression_compressed"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_compressed")
+            stats[
+                "core_message_compression_skipped_small"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_skipped_small")
+            stats[
+                "core_message_compression_skipped_incompressible"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_skipped_incompressible")
+            stats[
+                "core_message_compression_not_smaller"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_not_smaller")
+            stats[
+                "core_message_compression_deflate_input_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_deflate_input_bytes")
+            stats[
+                "core_message_compression_deflate_output_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_deflate_output_bytes")
+            stats[
+                "core_message_compression_deflate_micros"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_deflate_micros")
+            stats[
+                "core_message_compression_deflate_not_smaller"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_deflate_not_smaller")
+            stats[
+                "core_message_compression_gzip_input_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_gzip_input_bytes")
+            stats[
+                "core_message_compression_gzip_output_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_gzip_output_bytes")
+            stats[
+                "core_message_compression_gzip_micros"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_gzip_micros")
+            stats[
+                "core_message_compression_gzip_not_smaller"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_gzip_not_smaller")
+            stats[
+                "core_message_compression_zstd_input_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_zstd_input_bytes")
+            stats[
+                "core_message_compression_zstd_output_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_zstd_output_bytes")
+            stats[
+                "core_message_compression_zstd_micros"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_zstd_micros")
+            stats[
+                "core_message_compression_zstd_not_smaller"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_zstd_not_smaller")
+            stats[
+                "core_message_decompression_deflate_input_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_deflate_input_bytes")
+            stats[
+                "core_message_decompression_deflate_output_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_deflate_output_bytes")
+            stats[
+                "core_message_decompression_deflate_micros"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_deflate_micros")
+            stats[
+                "core_message_decompression_gzip_input_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_gzip_input_bytes")
+            stats[
+                "core_message_decompression_gzip_output_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_gzip_output_bytes")
+            stats[
+                "core_message_decompression_gzip_micros"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_gzip_micros")
+            stats[
+                "core_message_decompression_zstd_input_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_zstd_input_bytes")
+            stats[
+                "core_message_decompression_zstd_output_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_zstd_output_bytes")
+            stats[
+                "core_message_decompression_zstd_micros"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_zstd_micros")
+            stats[
+                "core_message_compression_lz4_input_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_lz4_input_bytes")
+            stats[
+                "core_message_compression_lz4_output_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_lz4_output_bytes")
+            stats[
+                "core_message_compression_lz4_micros"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_lz4_micros")
+            stats[
+                "core_message_compression_lz4_not_smaller"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_lz4_not_smaller")
+            stats[
+                "core_message_decompression_lz4_input_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_lz4_input_bytes")
+            stats[
+                "core_message_decompression_lz4_output_bytes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_lz4_output_bytes")
+            stats[
+                "core_message_decompression_lz4_micros"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_lz4_micros")
+            stats[
+                "core_message_compression_skipped_memory_pressure"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_skipped_memory_pressure")
+            stats[
+                "core_message_compression_level_lowered_memory_pressure"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_compression_level_lowered_memory_pressure")
+            stats[
+                "core_message_decompression_window_rejected"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_window_rejected")
+            stats[
+                "core_message_decompression_limit_exceeded"] = massage_qps_stats_helpers.counter(
+                    core_stats, "message_decompression_limit_exceeded")
             h = massage_qps_stats_helpers.histogram(core_stats,
                                                     "call_initial_size")
             stats["core_call_initial_size"] = ",".join(
@@ -509,3 +617,123 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_server_cqs_checked_99p"] = massage_qps_stats_helpers.percentile(
                     h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "message_compression_deflate_ratio")
+            stats["core_message_compression_deflate_ratio"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_message_compression_deflate_ratio_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_message_compression_deflate_ratio_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_message_compression_deflate_ratio_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_message_compression_deflate_ratio_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "message_compression_gzip_ratio")
+            stats["core_message_compression_gzip_ratio"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_message_compression_gzip_ratio_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_message_compression_gzip_ratio_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_message_compression_gzip_ratio_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_message_compression_gzip_ratio_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "message_compression_zstd_ratio")
+            stats["core_message_compression_zstd_ratio"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_message_compression_zstd_ratio_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_message_compression_zstd_ratio_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_message_compression_zstd_ratio_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_message_compression_zstd_ratio_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "message_decompression_deflate_ratio")
+            stats["core_message_decompression_deflate_ratio"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_message_decompression_deflate_ratio_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_message_decompression_deflate_ratio_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_message_decompression_deflate_ratio_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_message_decompression_deflate_ratio_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "message_decompression_gzip_ratio")
+            stats["core_message_decompression_gzip_ratio"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_message_decompression_gzip_ratio_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_message_decompression_gzip_ratio_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_message_decompression_gzip_ratio_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_message_decompression_gzip_ratio_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "message_decompression_zstd_ratio")
+            stats["core_message_decompression_zstd_ratio"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_message_decompression_zstd_ratio_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_message_decompression_zstd_ratio_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_message_decompression_zstd_ratio_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_message_decompression_zstd_ratio_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "message_compression_lz4_ratio")
+            stats["core_message_compression_lz4_ratio"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_message_compression_lz4_ratio_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_message_compression_lz4_ratio_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_message_compression_lz4_ratio_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_message_compression_lz4_ratio_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "message_decompression_lz4_ratio")
+            stats["core_message_decompression_lz4_ratio"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_message_decompression_lz4_ratio_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_message_decompression_lz4_ratio_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_message_decompression_lz4_ratio_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_message_decompression_lz4_ratio_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
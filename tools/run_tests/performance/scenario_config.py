@@ -132,7 +132,10 @@ def _ping_pong_scenario(name,
                         messages_per_stream=None,
                         excluded_poll_engines=[],
                         minimal_stack=False,
-                        offered_load=None):
+                        offered_load=None,
+                        compression=None,
+                        zstd_level=0,
+                        incompressible_percent=0):
     """Creates a basic ping pong scenario."""
     scenario = {
         'name': name,
@@ -215,6 +218,16 @@ def _ping_pong_scenario(name,
 
     if messages_per_stream:
         scenario['client_config']['messages_per_stream'] = messages_per_stream
+    if compression:
+        if minimal_stack:
+            raise Exception('The minimal stack does not compress messages.')
+        compression_params = {
+            'algorithm': compression,
+            'zstd_level': zstd_level,
+            'incompressible_percent': incompressible_percent,
+        }
+        scenario['client_config']['compression_params'] = compression_params
+        scenario['server_config']['compression_params'] = compression_params
     if client_language:
         # the CLIENT_LANGUAGE field is recognized by run_performance_tests.py
         scenario['CLIENT_LANGUAGE'] = client_language
@@ -611,6 +624,40 @@ class CXXLanguage:
                                 channels=channels,
                                 outstanding=outstanding)
 
+        # Message compression, against the identity baseline, on payloads
+        # with a varying share of random bytes that do not compress.
+        for compression in ['identity', 'gzip', 'zstd']:
+            for size, size_str in [(1024, '1KB'), (1024 * 1024, '1MB')]:
+                for incompressible_percent in [0, 50]:
+                    suffix = '%s_%s_%dpct_incompressible' % (
+                        compression, size_str, incompressible_percent)
+                    yield _ping_pong_scenario(
+                        'cpp_protobuf_async_unary_ping_pong_compression_%s' %
+                        suffix,
+                        rpc_type='UNARY',
+                        client_type='ASYNC_CLIENT',
+                        server_type='ASYNC_SERVER',
+                        req_size=size,
+                        resp_size=size,
+                        secure=False,
+                        compression=compression,
+                        incompressible_percent=incompressible_percent,
+                        categories=[INPROC, SCALABLE])
+
+                    yield _ping_pong_scenario(
+                        'cpp_protobuf_async_streaming_qps_unconstrained_compression_%s'
+                        % suffix,
+                        rpc_type='STREAMING',
+                        client_type='ASYNC_CLIENT',
+                        server_type='ASYNC_SERVER',
+                        req_size=size,
+                        resp_size=size,
+                        unconstrained_client='async',
+                        secure=False,
+                        compression=compression,
+                        incompressible_percent=incompressible_percent,
+                        categories=[SCALABLE])
+
     def __str__(self):
         return 'c++'
 